@@ -7,7 +7,9 @@
  * - Agent StateMachine (Infotainment example)
  * - Transition tables
  * - Error recovery tables
+ * - State hierarchies (composite parent states)
  * - Action lists
+ * - Function Group processes (Execution Management stand-in)
  * 
  * Configuration is static (compile-time) for this implementation.
  * Production systems may load configuration from ARXML files.
@@ -16,6 +18,7 @@
  */
 
 #include "static_config.h"
+#include "config_validator.h"
 #include <cstddef>
 
 namespace ara {
@@ -34,7 +37,7 @@ namespace config {
  * 
  * @req [SWS_SM_00603-00607] StateMachine transition execution
  */
-const TransitionRule kControllerTransitions[] = {
+constexpr TransitionRule kControllerTransitions[] = {
     // ========================================================================
     // FROM INITIAL STATE
     // ========================================================================
@@ -52,21 +55,28 @@ const TransitionRule kControllerTransitions[] = {
     // ========================================================================
     {States::kRunning, Triggers::kShutdownRequest, States::kShutdown},
     {States::kRunning, Triggers::kRestartRequest, States::kRestart},
-    {States::kRunning, Triggers::kPrepareUpdateRequest, States::kPrepareUpdate},
+    // Only inside an update session that SMControlApplication allowed
+    {States::kRunning, Triggers::kPrepareUpdateRequest, States::kPrepareUpdate,
+        {Conditions::kUpdateAllowed | Conditions::kUpdateSessionActive, 0U}},
+    
+    // ========================================================================
+    // UPDATE SESSION (composite parent of PrepareUpdate, VerifyUpdate,
+    // ContinueUpdate - see kControllerStateHierarchy)
+    // ========================================================================
+    // Every update-cycle state can be rolled back
+    {States::kUpdateSession, Triggers::kPrepareRollbackRequest, States::kPrepareRollback},
     
     // ========================================================================
     // UPDATE CYCLE - PREPARE UPDATE
     // ========================================================================
-    // From PrepareUpdate can go to Verify or Rollback
+    // From PrepareUpdate can go to Verify (Rollback inherited)
     {States::kPrepareUpdate, Triggers::kVerifyUpdateRequest, States::kVerifyUpdate},
-    {States::kPrepareUpdate, Triggers::kPrepareRollbackRequest, States::kPrepareRollback},
     
     // ========================================================================
     // UPDATE CYCLE - VERIFY UPDATE
     // ========================================================================
-    // From VerifyUpdate can finish successfully or rollback
+    // From VerifyUpdate can finish successfully (Rollback inherited)
     {States::kVerifyUpdate, Triggers::kFinishUpdateRequest, States::kAfterUpdate},
-    {States::kVerifyUpdate, Triggers::kPrepareRollbackRequest, States::kPrepareRollback},
     
     // ========================================================================
     // UPDATE CYCLE - PREPARE ROLLBACK
@@ -85,8 +95,8 @@ const TransitionRule kControllerTransitions[] = {
     // CONTINUE UPDATE STATE (after machine restart during update)
     // ========================================================================
     // @req [SWS_SM_00657] Enter ContinueUpdate after restart during update
+    // (Rollback inherited from UpdateSession)
     {States::kContinueUpdate, Triggers::kVerifyUpdateRequest, States::kVerifyUpdate},
-    {States::kContinueUpdate, Triggers::kPrepareRollbackRequest, States::kPrepareRollback},
     
     // ========================================================================
     // RESTART STATE
@@ -110,7 +120,7 @@ const size_t kControllerTransitionsCount =
  * @req [SWS_SM_00601] StateMachine error notification reaction
  * @req [SWS_SM_CONSTR_00014] Handling of non-mapped ExecutionError (ANY rule)
  */
-const ErrorRecoveryRule kControllerErrorRecovery[] = {
+constexpr ErrorRecoveryRule kControllerErrorRecovery[] = {
     // ========================================================================
     // FROM RUNNING STATE
     // ========================================================================
@@ -138,26 +148,37 @@ const ErrorRecoveryRule kControllerErrorRecovery[] = {
     // Update failed -> rollback
     {States::kVerifyUpdate, ExecutionErrors::kUpdateFailed, States::kPrepareRollback},
     
-    // Any other error during verify -> rollback
-    {States::kVerifyUpdate, kExecutionErrorAny, States::kPrepareRollback},
-    
     // ========================================================================
-    // FROM PREPARE UPDATE STATE
+    // FROM ANY UPDATE-CYCLE STATE (UpdateSession)
     // ========================================================================
-    // Error during preparation -> rollback
-    {States::kPrepareUpdate, kExecutionErrorAny, States::kPrepareRollback},
+    // Any other error during prepare/verify/continue -> rollback
+    {States::kUpdateSession, kExecutionErrorAny, States::kPrepareRollback},
     
-    // ========================================================================
-    // GLOBAL CATCH-ALL (must be last)
-    // ========================================================================
-    // Default: any unmapped state + error -> stay in current state
-    // This is safer than blind shutdown for unknown states
-    {States::kRunning, kExecutionErrorAny, States::kShutdown},
+    // States without a rule here fall back to Off [SWS_SM_CONSTR_00014]
 };
 
 const size_t kControllerErrorRecoveryCount = 
     sizeof(kControllerErrorRecovery) / sizeof(ErrorRecoveryRule);
 
+// ============================================================================
+// CONTROLLER STATE HIERARCHY
+// ============================================================================
+
+/**
+ * @brief State hierarchy for Controller StateMachine
+ * 
+ * Update-cycle states share their rollback transition and error recovery
+ * through the composite UpdateSession state.
+ */
+constexpr StateHierarchyRule kControllerStateHierarchy[] = {
+    {States::kPrepareUpdate, States::kUpdateSession},
+    {States::kVerifyUpdate, States::kUpdateSession},
+    {States::kContinueUpdate, States::kUpdateSession},
+};
+
+const size_t kControllerStateHierarchyCount = 
+    sizeof(kControllerStateHierarchy) / sizeof(StateHierarchyRule);
+
 // ============================================================================
 // AGENT (INFOTAINMENT) TRANSITION REQUEST TABLE
 // ============================================================================
@@ -168,36 +189,38 @@ const size_t kControllerErrorRecoveryCount =
  * Agent manages application-level functionality (infotainment applications).
  * Agent cannot start/stop other StateMachines (only Controller can).
  */
-const TransitionRule kInfotainmentTransitions[] = {
+constexpr TransitionRule kInfotainmentTransitions[] = {
     // ========================================================================
     // FROM INITIAL STATE
     // ========================================================================
     {States::kInitial, Triggers::kGoToRunning, States::kRunning},
     {States::kInitial, Triggers::kUserRequest, States::kRunning},
     
+    // ========================================================================
+    // OPERATIONAL (composite parent of Running and Degraded)
+    // ========================================================================
+    {States::kOperational, Triggers::kShutdownRequest, States::kOff},
+    {States::kOperational, Triggers::kPrepareUpdateRequest, States::kPrepareUpdate},
+    
     // ========================================================================
     // FROM RUNNING STATE
     // ========================================================================
-    {States::kRunning, Triggers::kShutdownRequest, States::kOff},
     {States::kRunning, Triggers::kDegradeRequest, States::kDegraded},
-    {States::kRunning, Triggers::kPrepareUpdateRequest, States::kPrepareUpdate},
     
     // ========================================================================
     // FROM DEGRADED STATE
     // ========================================================================
     // Degraded mode allows recovery back to Running
     {States::kDegraded, Triggers::kGoToRunning, States::kRunning},
-    {States::kDegraded, Triggers::kShutdownRequest, States::kOff},
-    {States::kDegraded, Triggers::kPrepareUpdateRequest, States::kPrepareUpdate},
     
     // ========================================================================
-    // UPDATE CYCLE
+    // UPDATE CYCLE (Rollback inherited from UpdateSession)
     // ========================================================================
+    {States::kUpdateSession, Triggers::kPrepareRollbackRequest, States::kPrepareRollback},
+    
     {States::kPrepareUpdate, Triggers::kVerifyUpdateRequest, States::kVerifyUpdate},
-    {States::kPrepareUpdate, Triggers::kPrepareRollbackRequest, States::kPrepareRollback},
     
     {States::kVerifyUpdate, Triggers::kFinishUpdateRequest, States::kRunning},
-    {States::kVerifyUpdate, Triggers::kPrepareRollbackRequest, States::kPrepareRollback},
     
     {States::kPrepareRollback, Triggers::kFinishUpdateRequest, States::kRunning},
     
@@ -218,7 +241,7 @@ const size_t kInfotainmentTransitionsCount =
 /**
  * @brief Error recovery table for Infotainment Agent
  */
-const ErrorRecoveryRule kInfotainmentErrorRecovery[] = {
+constexpr ErrorRecoveryRule kInfotainmentErrorRecovery[] = {
     // ========================================================================
     // FROM RUNNING STATE
     // ========================================================================
@@ -242,7 +265,11 @@ const ErrorRecoveryRule kInfotainmentErrorRecovery[] = {
     // ========================================================================
     // Verification failed -> rollback
     {States::kVerifyUpdate, ExecutionErrors::kVerificationFailed, States::kPrepareRollback},
-    {States::kVerifyUpdate, kExecutionErrorAny, States::kPrepareRollback},
+    
+    // ========================================================================
+    // FROM ANY UPDATE-CYCLE STATE (UpdateSession)
+    // ========================================================================
+    {States::kUpdateSession, kExecutionErrorAny, States::kPrepareRollback},
     
     // ========================================================================
     // GLOBAL CATCH-ALL
@@ -253,6 +280,23 @@ const ErrorRecoveryRule kInfotainmentErrorRecovery[] = {
 const size_t kInfotainmentErrorRecoveryCount = 
     sizeof(kInfotainmentErrorRecovery) / sizeof(ErrorRecoveryRule);
 
+// ============================================================================
+// AGENT STATE HIERARCHY
+// ============================================================================
+
+/**
+ * @brief State hierarchy for Infotainment Agent
+ */
+constexpr StateHierarchyRule kInfotainmentStateHierarchy[] = {
+    {States::kRunning, States::kOperational},
+    {States::kDegraded, States::kOperational},
+    {States::kPrepareUpdate, States::kUpdateSession},
+    {States::kVerifyUpdate, States::kUpdateSession},
+};
+
+const size_t kInfotainmentStateHierarchyCount = 
+    sizeof(kInfotainmentStateHierarchy) / sizeof(StateHierarchyRule);
+
 // ============================================================================
 // ACTION LISTS - CONTROLLER
 // ============================================================================
@@ -278,8 +322,8 @@ static const ActionItem kInitialActions[] = {
     // Set MachineFG to Startup
     {ActionType::kSetFunctionGroupState, "MachineFG", "Startup", 0},
     
-    // Wait for startup to complete
-    {ActionType::kSync, nullptr, nullptr, 0},
+    // Wait for startup to complete (at most 3 s)
+    {ActionType::kSync, nullptr, nullptr, 0, 3000},
     
     // Start Infotainment Agent (will enter its Initial state)
     {ActionType::kStartStateMachine, "InfotainmentSM", "", 0},
@@ -312,27 +356,29 @@ static const ActionItem kRunningActions[] = {
     // Start Agent in Running mode
     {ActionType::kStartStateMachine, "InfotainmentSM", "Running", 0},
     
-    {ActionType::kSync, nullptr, nullptr, 0}
+    {ActionType::kSync, nullptr, nullptr, 0, 3000}
 };
 
 /**
  * @brief Action list for Shutdown state
  * 
+ * Declares dependencies instead of SYNC barriers: no Agent uses
+ * VehicleNetwork, so its graceful shutdown runs while the Agents stop.
+ * 
  * @req [SWS_SM_CONSTR_00017] ActionListItem "Function Group State" in Controller
  */
-static const ActionItem kShutdownActions[] = {
-    // Stop all Agents first
-    {ActionType::kStopStateMachine, "InfotainmentSM", nullptr, 0},
-    {ActionType::kSync, nullptr, nullptr, 0},
+static constexpr ActionItem kShutdownActions[] = {
+    // Stop all Agents
+    {ActionType::kStopStateMachine, "InfotainmentSM", nullptr, 0, 0, 0},
     
-    // Disable network
-    {ActionType::kSetNetworkHandle, "VehicleNetwork", "NoCom", 0},
+    // Disable network (critical path)
+    {ActionType::kSetNetworkHandle, "VehicleNetwork", "NoCom", 0, 0, 0},
     
     // Small delay for graceful network shutdown
-    {ActionType::kSleep, nullptr, nullptr, 500},
+    {ActionType::kSleep, nullptr, nullptr, 500, 0, DependsOn(1)},
     
-    // Finally shutdown machine
-    {ActionType::kSetFunctionGroupState, "MachineFG", "Shutdown", 0},
+    // Finally shutdown machine, once the Agents are stopped and the network is down
+    {ActionType::kSetFunctionGroupState, "MachineFG", "Shutdown", 0, 0, DependsOn(0) | DependsOn(2)},
 };
 
 /**
@@ -438,13 +484,15 @@ static const ActionItem kAfterUpdateActions[] = {
 /**
  * @brief Complete action table for Controller
  * 
- * Maps each state to its action list
+ * Maps each state to its action list. The boot lists have a 10 s
+ * deadline, so a hung function group fails the transition instead of
+ * stalling the Controller.
  */
-const ActionListEntry kActionTable[] = {
-    {States::kInitial, kInitialActions, 4},
-    {States::kStartup, kStartupActions, 2},
-    {States::kRunning, kRunningActions, 4},
-    {States::kShutdown, kShutdownActions, 5},
+constexpr ActionListEntry kActionTable[] = {
+    {States::kInitial, kInitialActions, 4, 10000},
+    {States::kStartup, kStartupActions, 2, 10000},
+    {States::kRunning, kRunningActions, 4, 10000},
+    {States::kShutdown, kShutdownActions, 4},
     {States::kRestart, kRestartActions, 3},
     {States::kPrepareUpdate, kPrepareUpdateActions, 5},
     {States::kVerifyUpdate, kVerifyUpdateActions, 3},
@@ -526,7 +574,7 @@ static const ActionItem kInfotainmentVerifyUpdateActions[] = {
  * @req [SWS_SM_CONSTR_00015] Completeness of controlled Function Groups
  * @req [SWS_SM_CONSTR_00032] Completeness of controlled NetworkHandles
  */
-const ActionListEntry kInfotainmentActionTable[] = {
+constexpr ActionListEntry kInfotainmentActionTable[] = {
     {States::kOff, kInfotainmentOffActions, 3},
     {States::kRunning, kInfotainmentRunningActions, 3},
     {States::kDegraded, kInfotainmentDegradedActions, 3},
@@ -537,6 +585,157 @@ const ActionListEntry kInfotainmentActionTable[] = {
 const size_t kInfotainmentActionTableCount = 
     sizeof(kInfotainmentActionTable) / sizeof(ActionListEntry);
 
+// ============================================================================
+// FUNCTION GROUP PROCESSES (EXECUTION MANAGEMENT STAND-IN)
+// ============================================================================
+
+/**
+ * @brief Processes of each Function Group state
+ * 
+ * Stand-ins built from /bin/sh so the boot sequence runs on any Linux
+ * host: daemons report readiness on the ready fd and then idle, init
+ * steps just exit 0. LogDaemon and MediaPlayer are configured in two
+ * states each and keep running across those state changes. Daemons
+ * started by a prelaunch wait for the release byte before reporting.
+ */
+namespace {
+constexpr const char* kShell = "/bin/sh";
+constexpr const char* kReadyThenIdle =
+    "[ -z \"$ARA_EM_RELEASE_FD\" ] || read -r _ <&4; printf R >&3; exec sleep 3600";
+constexpr const char* kExitOk = "exit 0";
+} // namespace
+
+constexpr ProcessItem kProcessTable[] = {
+    // MachineFG
+    {"MachineFG", "Startup", "LogDaemon", {kShell, "-c", kReadyThenIdle, nullptr}},
+    {"MachineFG", "Startup", "PersistencyInit", {kShell, "-c", kExitOk, nullptr}},
+    {"MachineFG", "Running", "LogDaemon", {kShell, "-c", kReadyThenIdle, nullptr}},
+    {"MachineFG", "Running", "DiagnosticManager", {kShell, "-c", kReadyThenIdle, nullptr}},
+    {"MachineFG", "Running", "PlatformHealth", {kShell, "-c", kReadyThenIdle, nullptr}},
+    {"MachineFG", "Verify", "UpdateVerifier", {kShell, "-c", kExitOk, nullptr}},
+    
+    // InfotainmentFG
+    {"InfotainmentFG", "Running", "MediaPlayer", {kShell, "-c", kReadyThenIdle, nullptr}},
+    {"InfotainmentFG", "Running", "Navigation", {kShell, "-c", kReadyThenIdle, nullptr}},
+    {"InfotainmentFG", "Degraded", "MediaPlayer", {kShell, "-c", kReadyThenIdle, nullptr}},
+};
+
+const size_t kProcessTableCount = sizeof(kProcessTable) / sizeof(ProcessItem);
+
+/**
+ * @brief Likely next state of each Function Group state
+ *
+ * Infotainment comes (back) up to Running from Off and Degraded; the
+ * machine goes from Startup to Running.
+ */
+constexpr PrelaunchItem kPrelaunchTable[] = {
+    {"MachineFG", "Startup", "Running"},
+    {"InfotainmentFG", "Off", "Running"},
+    {"InfotainmentFG", "Degraded", "Running"},
+};
+
+const size_t kPrelaunchTableCount = sizeof(kPrelaunchTable) / sizeof(PrelaunchItem);
+
+// ============================================================================
+// FUNCTION GROUP RESOURCE LIMITS (CGROUP V2)
+// ============================================================================
+
+/**
+ * @brief CPU/IO share of each Function Group state
+ *
+ * MachineFG outweighs infotainment 4:1, so its boot-critical starts keep
+ * their latency while both groups start in parallel. In the update
+ * session (PrepareUpdate/VerifyUpdate set the groups to Off/Verify) the
+ * update verifier gets the machine, and infotainment is confined to CPU 0
+ * with a minimal share.
+ */
+constexpr ResourceItem kResourceTable[] = {
+    {"MachineFG", nullptr, 400, 400, nullptr},
+    {"MachineFG", "Verify", 1000, 1000, nullptr},
+    {"InfotainmentFG", nullptr, 100, 100, nullptr},
+    {"InfotainmentFG", "Degraded", 50, 50, nullptr},
+    {"InfotainmentFG", "Verify", 20, 10, "0"},
+};
+
+const size_t kResourceTableCount = sizeof(kResourceTable) / sizeof(ResourceItem);
+
+// ============================================================================
+// BUILD-TIME VALIDATION
+// ============================================================================
+
+namespace {
+
+struct ControllerTables {
+    static constexpr const TransitionRule* kTransitions = kControllerTransitions;
+    static constexpr std::size_t kTransitionsCount =
+        sizeof(kControllerTransitions) / sizeof(TransitionRule);
+    static constexpr const ErrorRecoveryRule* kErrorRecovery = kControllerErrorRecovery;
+    static constexpr std::size_t kErrorRecoveryCount =
+        sizeof(kControllerErrorRecovery) / sizeof(ErrorRecoveryRule);
+    static constexpr const StateHierarchyRule* kStateHierarchy = kControllerStateHierarchy;
+    static constexpr std::size_t kStateHierarchyCount =
+        sizeof(kControllerStateHierarchy) / sizeof(StateHierarchyRule);
+    static constexpr const ActionListEntry* kActionTable = config::kActionTable;
+    static constexpr std::size_t kActionTableCount =
+        sizeof(config::kActionTable) / sizeof(ActionListEntry);
+};
+
+struct InfotainmentTables {
+    static constexpr const TransitionRule* kTransitions = kInfotainmentTransitions;
+    static constexpr std::size_t kTransitionsCount =
+        sizeof(kInfotainmentTransitions) / sizeof(TransitionRule);
+    static constexpr const ErrorRecoveryRule* kErrorRecovery = kInfotainmentErrorRecovery;
+    static constexpr std::size_t kErrorRecoveryCount =
+        sizeof(kInfotainmentErrorRecovery) / sizeof(ErrorRecoveryRule);
+    static constexpr const StateHierarchyRule* kStateHierarchy = kInfotainmentStateHierarchy;
+    static constexpr std::size_t kStateHierarchyCount =
+        sizeof(kInfotainmentStateHierarchy) / sizeof(StateHierarchyRule);
+    static constexpr const ActionListEntry* kActionTable = kInfotainmentActionTable;
+    static constexpr std::size_t kActionTableCount =
+        sizeof(kInfotainmentActionTable) / sizeof(ActionListEntry);
+};
+
+// Controller is started in Initial, or in ContinueUpdate after a restart
+// during an update session [SWS_SM_00657]
+constexpr uint32_t kControllerEntryStates[] = {States::kInitial, States::kContinueUpdate};
+constexpr uint32_t kInfotainmentEntryStates[] = {States::kInitial};
+
+using ControllerCheck = ConfigValidator<ControllerTables>;
+using InfotainmentCheck = ConfigValidator<InfotainmentTables>;
+
+static_assert(ControllerCheck::StatesInRange(), "Controller: state ID out of range");
+static_assert(ControllerCheck::TransitionKeysUnique(), "Controller: shadowed transition rule");
+static_assert(ControllerCheck::RecoveryKeysUnique(), "Controller: duplicate error recovery rule");
+static_assert(ControllerCheck::HierarchyWellFormed(), "Controller: malformed state hierarchy");
+static_assert(ControllerCheck::ActionListsWellFormed(), "Controller: malformed action table");
+static_assert(ActionDependenciesValid(kShutdownActions, 4U), "Controller: bad Shutdown dependencies");
+static_assert(ControllerCheck::NoDanglingStates(), "Controller: dangling target state");
+static_assert(ControllerCheck::AllStatesReachable(kControllerEntryStates),
+              "Controller: unreachable state");
+static_assert(ActionCountsMatch(kActionTable, ControllerTables::kActionTableCount,
+                                kInitialActions, kStartupActions, kRunningActions,
+                                kShutdownActions, kRestartActions, kPrepareUpdateActions,
+                                kVerifyUpdateActions, kPrepareRollbackActions,
+                                kContinueUpdateActions, kAfterUpdateActions),
+              "Controller: action count does not match action list");
+
+static_assert(InfotainmentCheck::StatesInRange(), "Infotainment: state ID out of range");
+static_assert(InfotainmentCheck::TransitionKeysUnique(), "Infotainment: shadowed transition rule");
+static_assert(InfotainmentCheck::RecoveryKeysUnique(),
+              "Infotainment: duplicate error recovery rule");
+static_assert(InfotainmentCheck::HierarchyWellFormed(), "Infotainment: malformed state hierarchy");
+static_assert(InfotainmentCheck::ActionListsWellFormed(), "Infotainment: malformed action table");
+static_assert(InfotainmentCheck::NoDanglingStates(), "Infotainment: dangling target state");
+static_assert(InfotainmentCheck::AllStatesReachable(kInfotainmentEntryStates),
+              "Infotainment: unreachable state");
+static_assert(ActionCountsMatch(kInfotainmentActionTable, InfotainmentTables::kActionTableCount,
+                                kInfotainmentOffActions, kInfotainmentRunningActions,
+                                kInfotainmentDegradedActions, kInfotainmentPrepareUpdateActions,
+                                kInfotainmentVerifyUpdateActions),
+              "Infotainment: action count does not match action list");
+
+} // namespace
+
 } // namespace config
 } // namespace sm
 } // namespace ara
@@ -53,6 +53,10 @@ namespace States {
     // Agent-specific states (example)
     constexpr uint32_t kDegraded = 30;         ///< Degraded operation mode
     
+    // Composite (parent) states - never entered, only inherited from
+    constexpr uint32_t kUpdateSession = 40;    ///< Parent of all update-cycle states
+    constexpr uint32_t kOperational = 41;      ///< Parent of Running and Degraded (Agent)
+    
     // Special state for internal use
     constexpr uint32_t kInTransition = 0xFFFFFFFE; ///< @req [SWS_SM_00616]
     constexpr uint32_t kInvalid = 0xFFFFFFFF;      ///< Invalid/uninitialized state
@@ -117,20 +121,67 @@ namespace ExecutionErrors {
  */
 constexpr ExecutionErrorType kExecutionErrorAny = 0xFFFFFFFF;
 
+// ============================================================================
+// CONDITION BITS
+// ============================================================================
+
+/**
+ * @brief Bitmask over the shared condition word
+ * @see ara::sm::ConditionWord
+ */
+using ConditionMask = uint32_t;
+
+/**
+ * @brief Namespace containing condition bits tested by transition guards
+ * 
+ * Each bit is owned and published by exactly one component
+ * (e.g. UpdateRequestService for the update related bits).
+ */
+namespace Conditions {
+    constexpr ConditionMask kUpdateAllowed = 1U << 0;       ///< UpdateAllowedType::kUpdateAllowed
+    constexpr ConditionMask kUpdateSessionActive = 1U << 1; ///< UCM update session running
+}
+
 // ============================================================================
 // CONFIGURATION STRUCTURES
 // ============================================================================
 
+/**
+ * @brief Guard condition of a transition rule
+ * 
+ * Precompiled predicate over the shared condition word:
+ * (word & allOf) == allOf && (word & noneOf) == 0.
+ * A zero-initialized guard is always true.
+ */
+struct TransitionGuard {
+    ConditionMask allOf;                ///< Bits that must be set
+    ConditionMask noneOf;               ///< Bits that must be clear
+};
+
+/**
+ * @brief Evaluate a transition guard
+ * @param guard Guard to evaluate
+ * @param conditions Current condition word
+ * @return true if the guard holds
+ */
+constexpr bool EvaluateGuard(const TransitionGuard& guard, ConditionMask conditions) {
+    return ((conditions & guard.allOf) == guard.allOf) &&
+           ((conditions & guard.noneOf) == 0U);
+}
+
 /**
  * @brief Transition rule entry in TransitionRequestTable
  * @req [SWS_SM_00603-00607]
  * 
- * Defines allowed state transitions based on current state and trigger
+ * Defines allowed state transitions based on current state and trigger.
+ * Several rules may share (fromState, trigger) with different guards;
+ * the first rule whose guard holds is taken.
  */
 struct TransitionRule {
     uint32_t fromState;                 ///< Current state
     TransitionRequestType trigger;      ///< Trigger/request value
     uint32_t toState;                   ///< Target state
+    TransitionGuard guard;              ///< Guard (omitted = unguarded)
 };
 
 /**
@@ -145,6 +196,20 @@ struct ErrorRecoveryRule {
     uint32_t toState;                   ///< Recovery state to transition to
 };
 
+/**
+ * @brief State hierarchy entry (child -> parent)
+ * 
+ * A state inherits every transition and error recovery rule of its
+ * parent (and transitively of all ancestors). Rules configured on the
+ * child itself take precedence over inherited ones. The hierarchy is
+ * flattened into plain lookup tables when the tables are compiled, so
+ * nesting has no cost on the lookup path.
+ */
+struct StateHierarchyRule {
+    uint32_t state;                     ///< Child state
+    uint32_t parentState;               ///< Parent (usually composite) state
+};
+
 /**
  * @brief Action item type enumeration
  * @req [SWS_SM_00608-00626]
@@ -162,23 +227,89 @@ enum class ActionType : uint8_t {
  * @brief Single action item in ActionList
  * @req [SWS_SM_00608-00626]
  * 
- * Represents one action to be executed when entering a state
+ * Represents one action to be executed when entering a state.
+ * Actions are issued without waiting, so a SYNC is where a hung
+ * function group shows up; its timeoutMs bounds that wait.
+ *
+ * Instead of SYNC barriers a list may declare dependencies: once any
+ * item has dependsOn set, the list has no SYNC items and every action
+ * or sleep starts as soon as the earlier items in its dependsOn are
+ * done (right away for none).
  */
 struct ActionItem {
     ActionType type;                    ///< Type of action
     const char* target;                 ///< Target (FG name, SM name, NetworkHandle name)
     const char* param;                  ///< Parameter (FG state, SM initial state, NM state)
     uint32_t sleepTimeMs;              ///< Sleep duration in ms (for kSleep only)
+    uint32_t timeoutMs;                 ///< Max. wait of a kSync in ms, 0 for the executor default
+    uint32_t dependsOn;                 ///< Bit i: wait for item i (< 32) of the same list
 };
 
+/// Bit of item index in ActionItem::dependsOn
+constexpr uint32_t DependsOn(uint32_t index)
+{
+    return 1U << index;
+}
+
 /**
  * @brief Action list entry mapping state to actions
  * @req [SWS_SM_00609], [SWS_SM_CONSTR_00015]
+ *
+ * With timeoutMs set, the transition fails once the list has run that
+ * long: waits and sleeps are cut at the deadline and the remaining
+ * actions are not issued.
  */
 struct ActionListEntry {
     uint32_t state;                     ///< State ID
     const ActionItem* actions;          ///< Pointer to action array
     size_t actionCount;                 ///< Number of actions in array
+    uint32_t timeoutMs;                 ///< Deadline of the whole list in ms, 0 for none
+};
+
+/// Maximum number of arguments of a configured process (argv[0] excluded)
+constexpr size_t kMaxProcessArgs = 3;
+
+/**
+ * @brief Process started in a Function Group state
+ *
+ * Used by the local Execution Management stand-in (LocalExecutionManager).
+ * A process is identified by function group and name; if the same name
+ * is configured in the old and the new state of its function group it
+ * keeps running across the state change.
+ */
+struct ProcessItem {
+    const char* functionGroup;          ///< Function Group name (e.g. "MachineFG")
+    const char* state;                  ///< Function Group state the process runs in
+    const char* name;                   ///< Process name, unique within the function group
+    const char* argv[kMaxProcessArgs + 2]; ///< Executable path and arguments, nullptr-terminated
+};
+
+/**
+ * @brief Function Group state to prelaunch while in another state
+ *
+ * While functionGroup is in fromState, the processes of nextState are
+ * started ahead of time and parked (see LocalExecutionManager::Prelaunch),
+ * so the transition to nextState only has to release them.
+ */
+struct PrelaunchItem {
+    const char* functionGroup;          ///< Function Group name
+    const char* fromState;              ///< Current Function Group state
+    const char* nextState;              ///< Likely next state, prelaunched
+};
+
+/**
+ * @brief cgroup v2 resource limits of a Function Group state
+ *
+ * Each function group has its own cgroup (see CgroupManager); the limits
+ * are rewritten whenever the group changes state. An entry with state
+ * nullptr applies to every state of the group without an own entry.
+ */
+struct ResourceItem {
+    const char* functionGroup;          ///< Function Group name
+    const char* state;                  ///< Function Group state, nullptr for all others
+    uint16_t cpuWeight;                 ///< cpu.weight (1-10000), 0 for the default (100)
+    uint16_t ioWeight;                  ///< io.weight (1-10000), 0 for the default (100)
+    const char* cpus;                   ///< cpuset.cpus (e.g. "0-1"), nullptr for all
 };
 
 // ============================================================================
@@ -192,6 +323,9 @@ extern const size_t kControllerTransitionsCount;
 extern const ErrorRecoveryRule kControllerErrorRecovery[];
 extern const size_t kControllerErrorRecoveryCount;
 
+extern const StateHierarchyRule kControllerStateHierarchy[];
+extern const size_t kControllerStateHierarchyCount;
+
 // Agent (Infotainment) configuration
 extern const TransitionRule kInfotainmentTransitions[];
 extern const size_t kInfotainmentTransitionsCount;
@@ -199,6 +333,9 @@ extern const size_t kInfotainmentTransitionsCount;
 extern const ErrorRecoveryRule kInfotainmentErrorRecovery[];
 extern const size_t kInfotainmentErrorRecoveryCount;
 
+extern const StateHierarchyRule kInfotainmentStateHierarchy[];
+extern const size_t kInfotainmentStateHierarchyCount;
+
 // Action table
 extern const ActionListEntry kActionTable[];
 extern const size_t kActionTableCount;
@@ -207,6 +344,17 @@ extern const size_t kActionTableCount;
 extern const ActionListEntry kInfotainmentActionTable[];
 extern const size_t kInfotainmentActionTableCount;
 
+// Function Group processes (Execution Management stand-in)
+extern const ProcessItem kProcessTable[];
+extern const size_t kProcessTableCount;
+
+extern const PrelaunchItem kPrelaunchTable[];
+extern const size_t kPrelaunchTableCount;
+
+// Function Group resource limits (cgroup v2)
+extern const ResourceItem kResourceTable[];
+extern const size_t kResourceTableCount;
+
 // ============================================================================
 // HELPER FUNCTIONS
 // ============================================================================
@@ -243,6 +391,16 @@ inline bool IsMandatoryUpdateState(uint32_t stateId) {
             stateId == States::kPrepareRollback);
 }
 
+/**
+ * @brief Check if state is a composite (parent-only) state
+ * @param stateId State ID to check
+ * @return true if state only groups other states and is never entered
+ */
+inline bool IsCompositeState(uint32_t stateId) {
+    return (stateId == States::kUpdateSession ||
+            stateId == States::kOperational);
+}
+
 /**
  * @brief Check if state is Controller-specific
  * @param stateId State ID to check
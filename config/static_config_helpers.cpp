@@ -35,6 +35,10 @@ const char* StateIdToString(uint32_t stateId) {
             return "AfterUpdate";
         case States::kDegraded:
             return "Degraded";
+        case States::kUpdateSession:
+            return "UpdateSession";
+        case States::kOperational:
+            return "Operational";
         case States::kInTransition:
             return "InTransition";
         case States::kInvalid:
@@ -0,0 +1,123 @@
+#ifndef ARA_SM_ACTION_ARENA_H
+#define ARA_SM_ACTION_ARENA_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "static_config.h"
+#include "symbol_table.h"
+#include "action_plan.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief Action item packed into 8 bytes
+ *
+ * Strings are replaced by symbol IDs (see SymbolTable). A sleep or SYNC
+ * has no target or parameter, so its duration (sleep) or timeout (SYNC)
+ * shares the operand field with the parameter ID of the other action
+ * types.
+ */
+struct PackedAction {
+    config::ActionType type;
+    uint8_t reserved;
+    SymbolId target;                    ///< ID in TargetKind(type), or kNoSymbol
+    uint32_t operand;                   ///< Param ID in ParamKind(type), sleep time or SYNC timeout (ms)
+
+    SymbolId GetParam() const
+    {
+        return type == config::ActionType::kSleep || type == config::ActionType::kSync
+            ? kNoSymbol : static_cast<SymbolId>(operand);
+    }
+
+    uint32_t GetSleepTimeMs() const
+    {
+        return type == config::ActionType::kSleep ? operand : 0U;
+    }
+
+    uint32_t GetTimeoutMs() const
+    {
+        return type == config::ActionType::kSync ? operand : 0U;
+    }
+};
+
+static_assert(sizeof(PackedAction) == 8U, "PackedAction must stay 8 bytes");
+
+/// Position of one action list in an ActionArena
+struct ActionSpan {
+    uint32_t offset;
+    uint32_t length;
+};
+
+/**
+ * @brief Resolved action list of one state
+ *
+ * Executor view into an ActionArena. Carries the original items too,
+ * so executors that still work on strings can be handed the same list.
+ */
+struct ResolvedActionList {
+    uint32_t state;
+    const PackedAction* actions;        ///< actionCount packed actions (arena memory)
+    const config::ActionItem* items;    ///< Same list as config::ActionItem
+    std::size_t actionCount;
+    const SymbolTable* symbols;         ///< Table the IDs refer to
+    ActionPlan plan;                    ///< Compiled execution plan of the list
+    uint32_t timeoutMs;                 ///< Deadline of the list (ms), 0 for none
+};
+
+/**
+ * @brief All action lists of a configuration in one contiguous array
+ *
+ * Lists are appended once at config load and addressed by ActionSpan;
+ * consecutive lists are adjacent, so running a boot sequence (Initial,
+ * Startup, Running) reads a couple of cache lines.
+ *
+ * Pointers returned by Get() stay valid until the next Append().
+ */
+class ActionArena {
+public:
+    ActionArena() = default;
+
+    /// Reserve room for a total number of actions
+    void Reserve(std::size_t actionCount) { actions_.reserve(actionCount); }
+
+    /**
+     * @brief Pack and append one action list
+     *
+     * @param items Action items
+     * @param count Number of items
+     * @param symbols Table the names are interned into
+     * @param[out] span Position of the list in the arena
+     * @return false if a symbol kind ran out of IDs (arena unchanged)
+     */
+    bool Append(const config::ActionItem* items, std::size_t count,
+                SymbolTable& symbols, ActionSpan& span);
+
+    const PackedAction* Get(const ActionSpan& span) const
+    {
+        return actions_.data() + span.offset;
+    }
+
+    const PackedAction* GetData() const { return actions_.data(); }
+    std::size_t GetSize() const { return actions_.size(); }
+
+    /**
+     * @brief Pack one action item
+     *
+     * @param item Action item
+     * @param symbols Table the names are interned into
+     * @param[out] packed Packed item
+     * @return false if a symbol kind ran out of IDs
+     */
+    static bool Pack(const config::ActionItem& item, SymbolTable& symbols, PackedAction& packed);
+
+private:
+    std::vector<PackedAction> actions_;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_ACTION_ARENA_H
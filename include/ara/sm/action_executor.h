@@ -1,15 +1,30 @@
 #ifndef ARA_SM_ACTION_EXECUTOR_H
 #define ARA_SM_ACTION_EXECUTOR_H
 
+#include <chrono>
 #include <cstddef>
-#include <string>
 #include <cstdint>
+#include <memory>
+#include <vector>
 #include "static_config.h"
-#include "i_action_executor.h"
+#include "i_batch_action_executor.h"
+#include "result.h"
+#include "symbol_table.h"
+#include "types.h"
 
 namespace ara {
 namespace sm {
 
+class NetworkManagementClient;
+
+/**
+ * @brief What ActionExecutor does when a segment of an action list fails
+ */
+enum class CompensationMode : uint8_t {
+    kNone = 0,              ///< Leave the completed actions as they are
+    kFailedSegment = 1      ///< Undo the actions issued since the last SYNC
+};
+
 /**
  * Concrete implementation of IActionExecutor used by SM.
  * For testing we will mock IActionExecutor.
@@ -24,8 +39,26 @@ namespace sm {
  * @req [SWS_SM_00624] Sleep action
  * @req [SWS_SM_00625] SetNetworkHandle FullCom
  * @req [SWS_SM_00626] SetNetworkHandle NoCom
+ *
+ * Targets and parameters are handled as symbol IDs throughout: the
+ * executor keeps a copy of the bound configuration's SymbolTable (same
+ * IDs, see BindSymbols()), and names of ActionItem lists are interned
+ * into it on the way in. Names are only looked up (by index) to log.
+ *
+ * Deadlines use the monotonic clock: a resolved list with a timeoutMs
+ * stops issuing actions once it has run that long and cuts sleeps at
+ * the deadline; backends bound their SYNC waits with GetWaitDeadline().
+ *
+ * A list fails (kTransitionFailed) when an action cannot be issued, a
+ * SYNC finds a failed action, or the deadline expires; the rest of the
+ * list is skipped. With CompensationMode::kFailedSegment the actions
+ * issued since the last successful SYNC are then undone in reverse
+ * order: function groups and network handles go back to their previous
+ * state, started StateMachines are stopped. Earlier segments are kept,
+ * and the function group state cache elides their requests when the
+ * transition is retried, so a retry only redoes the failed segment.
  */
-class ActionExecutor : public IActionExecutor {
+class ActionExecutor : public IBatchActionExecutor {
 public:
  // helpers (kept public for tests)
     ActionExecutor() = default;
@@ -34,25 +67,273 @@ public:
     /**
      * @brief Execute action list
      * 
+     * Items run in list order; a SYNC is added before an item that
+     * depends on an action not yet behind one.
+     * 
      * @param actions Array of actions
      * @param count Number of actions
+     * @return kTransitionFailed if an action failed
      */
-   void ExecuteActionList(const config::ActionItem* actions, std::size_t count) override;
+   Result ExecuteActionList(const config::ActionItem* actions, std::size_t count) override;
+
+    /**
+     * @brief Execute action list within a deadline
+     * 
+     * @param timeoutMs Deadline of the whole list (0: none)
+     * @return kTransitionFailed if an action failed or the deadline expired
+     */
+    Result ExecuteActionList(const config::ActionItem* actions, std::size_t count,
+                             uint32_t timeoutMs) override;
     
     /**
      * @brief Execute single action
      * 
      * @param action Action to execute
+     * @return kInvalidValue for a malformed action, kOperationFailed if
+     *         Network Management failed
+     */
+    Result ExecuteAction(const config::ActionItem& action) override;
+
+    /**
+     * @brief Execute the precompiled plan of a list (no string compares,
+     *        no terminator checks, one call per type group)
+     * 
+     * @param list Resolved action list
+     * @return kTransitionFailed if an action failed or the deadline expired
+     */
+    Result ExecuteResolvedActionList(const ResolvedActionList& list) override;
+
+    /**
+     * @brief Issue all actions of one type group of a segment
+     * 
+     * @param batch Actions of one group
+     * @return Error of the first action that failed (the rest is not issued)
+     */
+    Result ExecuteActionBatch(const ActionBatch& batch) override;
+
+    /**
+     * @brief Sleep and/or SYNC at the end of a segment
+     * 
+     * @param sleepMs Sleep time (ms), 0 for none
+     * @param sync Wait for all issued actions
+     * @param timeoutMs Max. wait of the SYNC (ms), 0 for the default
+     * @return kOperationFailed if Network Management failed
+     */
+    Result ExecuteSegmentBarrier(uint32_t sleepMs, bool sync, uint32_t timeoutMs) override;
+
+    /**
+     * @brief Schedule a dependency plan
+     * 
+     * Every node whose dependencies are done is started, highest rank
+     * first; runs of adjacent ready nodes of one type go out as one
+     * batch. Sleeps are timers, so independent chains overlap them.
+     * 
+     * @param list Resolved action list with a dependency plan
+     * @return kTransitionFailed if an action failed or the deadline expired
+     */
+    Result ExecuteActionGraph(const ResolvedActionList& list) override;
+
+    /**
+     * @brief Check the deadline of the current list
+     * 
+     * @return true once the deadline has expired (logged once)
+     */
+    bool ListAborted() override;
+
+    /**
+     * @brief Outcome of the last action list
+     * 
+     * @return kTransitionFailed if its deadline expired or an action failed
+     */
+    Result GetListResult() const;
+
+    /// Undo the failed segment of a list or not (default kNone)
+    void SetCompensationMode(CompensationMode mode) { compensation_ = mode; }
+    CompensationMode GetCompensationMode() const { return compensation_; }
+
+    /// Compensating actions executed so far
+    std::size_t GetCompensatedCount() const { return compensatedCount_; }
+
+    /**
+     * @brief Send SetNetworkHandle actions to Network Management
+     * 
+     * Requests are cached and batched by the client; they are flushed
+     * at every SYNC/sleep and at the end of an action list. Handles are
+     * registered with the client once per configuration.
+     * 
+     * @param client Connected client (nullptr: log only)
+     */
+    void SetNetworkManagement(NetworkManagementClient* client);
+
+    /**
+     * @brief State a function group is known to be in
+     * 
+     * Set when a request completes: here when it is issued, in backends
+     * that start asynchronously once the start has finished.
+     * 
+     * @param fgName Function Group name
+     * @return State name, or nullptr if unknown
      */
-    void ExecuteAction(const config::ActionItem& action) override;
+    const char* GetFunctionGroupState(const char* fgName) const;
+
+    /// Forget every function group state (next requests are issued)
+    void InvalidateFunctionGroupStates();
+
+    /// SetFunctionGroupState actions skipped as already active
+    std::size_t GetElidedCount() const { return elidedCount_; }
+    /// Skipped SetFunctionGroupState actions of one function group
+    std::size_t GetElidedCount(const char* fgName) const;
+
+protected:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Start a list: set its deadline and clear the list result
+     * 
+     * @param timeoutMs Deadline of the list (ms from now), 0 for none
+     */
+    void BeginList(uint32_t timeoutMs);
+
+    /**
+     * @brief End of a wait, capped at the list deadline
+     * 
+     * @param timeoutMs Max. wait (ms), 0 for no limit of its own
+     * @return Clock::time_point::max() if neither limit is set
+     */
+    Clock::time_point GetWaitDeadline(uint32_t timeoutMs) const;
+
+    /// Report the current list as kTransitionFailed
+    void FailList() { listFailed_ = true; }
+
+    /**
+     * @brief Complete a list: wait for whatever it still has pending
+     * 
+     * Also runs after a failed (and compensated) list.
+     * 
+     * @return Error if a pending action failed
+     */
+    virtual Result FinishList();
+
+    /**
+     * @brief Remember the action that undoes an issued one
+     * 
+     * Ignored while compensating. The log is cleared at every SYNC.
+     * 
+     * @param type Type of the undo action
+     * @param target Its target
+     * @param param Its parameter; kNoSymbol skips the undo of actions
+     *        that set a state (previous state unknown)
+     */
+    void RecordCompensation(config::ActionType type, SymbolId target, SymbolId param);
+
+    /**
+     * @brief Take over the names of a configuration's symbol table
+     * 
+     * The executor keeps its own copy with the same IDs, so per-target
+     * state is indexed by the IDs of packed actions and outlives the
+     * configuration. The copy is only rebuilt when the table changed
+     * (another configuration); otherwise this is one compare.
+     * 
+     * @param symbols Table of the actions about to be executed
+     */
+    void BindSymbols(const SymbolTable& symbols);
+
+    /// Names of the bound configuration, plus those interned since
+    const SymbolTable& GetSymbols() const { return *symbols_; }
+
+    /// ID of a name from an ActionItem (interned if new, kNoSymbol for nullptr/"")
+    SymbolId InternSymbol(SymbolKind kind, const char* name) { return symbols_->Intern(kind, name); }
+
+    /**
+     * @brief BindSymbols() replaced the copy: IDs have changed
+     * 
+     * @param previous Old copy, to carry per-target state over by name
+     */
+    virtual void OnSymbolsBound(const SymbolTable& previous);
+
+    /// Send the SetNetworkHandle requests queued in the current segment
+    Result FlushNetworkRequests();
+
+    /**
+     * @brief Dependency plans: has an issued action completed
+     * 
+     * Actions here complete when issued (after the Network Management
+     * flush); backends that start asynchronous work override this.
+     */
+    virtual bool IsActionDone(const PackedAction& action, const SymbolTable& symbols);
+
+    /**
+     * @brief Dependency plans: wait until an issued action may have completed
+     * 
+     * @param until Next sleep end or the list deadline (may be max())
+     * @return Error if an issued action failed
+     */
+    virtual Result WaitForActions(Clock::time_point until);
+
+    /**
+     * @brief Skip a request for the state a function group already has
+     * 
+     * Counts the elision when it returns true.
+     * 
+     * @return true if functionGroup is known to be in state
+     */
+    bool ElideFunctionGroupState(SymbolId functionGroup, SymbolId state);
+
+    /**
+     * @brief Record the state a function group has reached
+     * 
+     * @param functionGroup Function Group, in GetSymbols()
+     * @param state New state, kNoSymbol if unknown (request pending or
+     *        failed, process of the group terminated)
+     */
+    void SetFunctionGroupState(SymbolId functionGroup, SymbolId state);
+
+    /// State a function group is known to be in, kNoSymbol if unknown
+    SymbolId GetFunctionGroupState(SymbolId functionGroup) const;
     
 private:
-    void ExecuteSetFunctionGroupState(const char* fgName, const char* stateName);
-    void ExecuteStartStateMachine(const char* smName, const char* initialState);
-    void ExecuteStopStateMachine(const char* smName);
-    void ExecuteSync();
-    void ExecuteSleep(uint32_t milliseconds);
-    void ExecuteSetNetworkHandle(const char* handleName, const char* state);
+    Result ExecuteSetFunctionGroupState(SymbolId functionGroup, SymbolId state);
+    Result ExecuteStartStateMachine(SymbolId stateMachine, SymbolId initialState);
+    Result ExecuteStopStateMachine(SymbolId stateMachine);
+    Result ExecuteSync();
+    Result ExecuteSleep(uint32_t milliseconds);
+    Result ExecuteSetNetworkHandle(SymbolId handle, SymbolId state);
+    void MapNetworkSymbols();
+
+    Result EndList(const Result& result);
+    void Compensate();
+
+    NetworkManagementClient* networkManagement_{nullptr};
+
+    CompensationMode compensation_{CompensationMode::kNone};
+    std::vector<PackedAction> undo_;    ///< Since the last SYNC (whole list with dependencies), in issue order
+    bool compensating_{false};
+    std::size_t compensatedCount_{0U};
+
+    enum class NodeState : uint8_t { kWaiting, kIssued, kDone };
+
+    /// Dependency plan scratch, per node (kept to avoid allocations)
+    std::vector<NodeState> nodeStates_;
+    std::vector<uint16_t> nodeBlockers_;        ///< Dependencies not yet done
+    std::vector<Clock::time_point> nodeWake_;   ///< End of a started sleep
+
+    Clock::time_point listBegin_{};
+    Clock::time_point listDeadline_{Clock::time_point::max()};
+    bool deadlineExpired_{false};
+    bool listFailed_{false};
+
+    std::unique_ptr<SymbolTable> symbols_{std::make_unique<SymbolTable>()};
+    uint64_t boundGeneration_{0U};     ///< Generation of the table copied last
+
+    /// Network Management view of symbols_, mapped once per configuration
+    std::vector<SymbolId> nmHandles_;   ///< Client handle ID by handle ID
+    std::vector<int8_t> nmStates_;      ///< NmStateRequestEnum by state ID, -1 for other names
+    SymbolId nmStateSymbols_[2]{kNoSymbol, kNoSymbol};  ///< State ID by NmStateRequestEnum
+
+    /// Function group state cache, indexed by the IDs of symbols_
+    std::vector<SymbolId> fgStates_;    ///< State ID per group, kNoSymbol if unknown
+    std::vector<std::size_t> fgElided_;
+    std::size_t elidedCount_{0U};
 };
 
 } // namespace sm
@@ -0,0 +1,161 @@
+#ifndef ARA_SM_ACTION_PLAN_H
+#define ARA_SM_ACTION_PLAN_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "static_config.h"
+
+namespace ara {
+namespace sm {
+
+struct PackedAction;
+
+/**
+ * @brief Action types that are issued (everything but SYNC and sleep)
+ *
+ * Within a segment actions run in parallel [SWS_SM_00611], so a plan
+ * stores them grouped by type in this order.
+ */
+enum class ActionGroup : uint8_t {
+    kSetFunctionGroupState = 0,
+    kStartStateMachine,
+    kStopStateMachine,
+    kSetNetworkHandle,
+    kCount
+};
+
+constexpr std::size_t kActionGroupCount = static_cast<std::size_t>(ActionGroup::kCount);
+
+/**
+ * @brief Run of actions up to the next barrier
+ *
+ * The actions of a segment are issued group by group, then sleepMs is
+ * waited, then the SYNC barrier (if any) is taken, for at most
+ * timeoutMs if set.
+ */
+struct PlanSegment {
+    uint32_t offset;                            ///< First action in ActionPlan::actions
+    uint16_t groupEnd[kActionGroupCount];       ///< End of each group, relative to offset
+    uint32_t sleepMs;                           ///< Sleep after the actions
+    bool sync;                                  ///< SYNC barrier after the sleep
+    uint32_t timeoutMs;                         ///< Max. wait of the SYNC (ms), 0 for the default
+
+    std::size_t GroupBegin(ActionGroup group) const
+    {
+        const auto g = static_cast<std::size_t>(group);
+        return offset + (g == 0U ? 0U : groupEnd[g - 1U]);
+    }
+
+    std::size_t GroupEnd(ActionGroup group) const
+    {
+        return offset + groupEnd[static_cast<std::size_t>(group)];
+    }
+
+    std::size_t GetActionCount() const { return groupEnd[kActionGroupCount - 1U]; }
+};
+
+/**
+ * @brief Action or sleep of a dependency plan
+ *
+ * Starts once dependencyCount nodes are done. rank is the estimated
+ * time from its start to the end of the list along its longest chain
+ * of successors: a sleep counts its duration, an issued action 1 ms.
+ */
+struct PlanNode {
+    uint32_t action;                    ///< Index into ActionPlan::actions
+    uint32_t rank;                      ///< Estimated ms to the end of the list
+    uint32_t firstSuccessor;            ///< Index into ActionPlan::successors
+    uint16_t successorCount;
+    uint16_t dependencyCount;
+};
+
+/**
+ * @brief Immutable execution plan of one action list
+ *
+ * View into an ActionPlanSet. The source list's terminator is already
+ * applied and SYNC/sleep items are folded into the segments, so
+ * `actions` only holds actions to issue.
+ *
+ * A list with dependencies (see config::ActionItem::dependsOn) also
+ * gets a dependency plan: its nodes in critical-path order (highest
+ * rank first, which is also a topological order), with the actions of
+ * consecutive nodes adjacent in `actions`. Its segments are then a
+ * barrier linearization of the same graph, for executors that only
+ * walk segments: a SYNC is inserted before every action that depends
+ * on one not yet behind a barrier.
+ */
+struct ActionPlan {
+    const PlanSegment* segments;
+    std::size_t segmentCount;
+    const PackedAction* actions;
+    uint32_t totalSleepMs;              ///< Sum of all segment sleeps
+    const PlanNode* nodes;              ///< Dependency plan, nullptr for a list without one
+    std::size_t nodeCount;
+    const uint16_t* successors;         ///< Node indices
+    uint32_t criticalPathMs;            ///< Highest node rank
+};
+
+/**
+ * @brief Plans of every action list of a configuration
+ *
+ * Compiled once at config load:
+ *  - the list ends at the first terminator (no target, not SYNC/sleep)
+ *  - a SYNC closes the current segment with a barrier; a repeated SYNC
+ *    adds nothing but can shorten the barrier's timeout
+ *  - sleeps are summed and close the segment before the next action,
+ *    so an action after a sleep still starts after it
+ *  - actions of a segment are grouped by ActionGroup (stable)
+ *  - with dependencies, nodes are sorted by rank (stable)
+ *
+ * Get() views stay valid until the next Add().
+ */
+class ActionPlanSet {
+public:
+    ActionPlanSet() = default;
+
+    /**
+     * @brief Compile one packed action list
+     *
+     * @param actions Packed actions in list order
+     * @param count Number of actions
+     * @param items Source items for their dependencies (none if nullptr);
+     *              must pass ActionDependenciesValid()
+     * @return Plan index for Get()
+     */
+    std::size_t Add(const PackedAction* actions, std::size_t count,
+                    const config::ActionItem* items = nullptr);
+
+    /// View of a compiled plan
+    ActionPlan Get(std::size_t index) const;
+
+    std::size_t GetPlanCount() const { return plans_.size(); }
+
+    /// Group of an action type (kCount for SYNC and sleep)
+    static ActionGroup GroupOf(config::ActionType type);
+
+private:
+    struct PlanEntry {
+        uint32_t firstSegment;
+        uint32_t segmentCount;
+        uint32_t totalSleepMs;
+        uint32_t firstNode;
+        uint32_t nodeCount;
+        uint32_t criticalPathMs;
+    };
+
+    void AddNodes(const PackedAction* actions, std::size_t count,
+                  const config::ActionItem* items, PlanEntry& plan);
+
+    std::vector<PackedAction> actions_;
+    std::vector<PlanSegment> segments_;
+    std::vector<PlanNode> nodes_;
+    std::vector<uint16_t> successors_;
+    std::vector<PlanEntry> plans_;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_ACTION_PLAN_H
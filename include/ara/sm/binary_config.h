@@ -0,0 +1,187 @@
+#ifndef ARA_SM_BINARY_CONFIG_H
+#define ARA_SM_BINARY_CONFIG_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "result.h"
+#include "types.h"
+#include "static_config.h"
+
+namespace ara {
+namespace sm {
+
+// ============================================================================
+// On-disk format (little endian, all references are offsets from image start)
+// ============================================================================
+
+/// Section descriptor: offset of the first element and element count
+struct BinaryConfigSection {
+    uint32_t offset;
+    uint32_t count;
+};
+
+/**
+ * @brief Image header (at offset 0)
+ *
+ * The CRC-32 (IEEE) covers everything after the header up to imageSize.
+ */
+struct BinaryConfigHeader {
+    uint32_t magic;                     ///< BinaryConfigImage::kMagic
+    uint16_t version;                   ///< BinaryConfigImage::kVersion
+    uint16_t headerSize;                ///< sizeof(BinaryConfigHeader)
+    uint32_t imageSize;                 ///< Total image size in bytes
+    uint32_t crc32;                     ///< CRC of bytes [headerSize, imageSize)
+    uint32_t nameOffset;                ///< Machine config name (string pool offset)
+    BinaryConfigSection transitions;    ///< config::TransitionRule[]
+    BinaryConfigSection errorRecovery;  ///< config::ErrorRecoveryRule[]
+    BinaryConfigSection hierarchy;      ///< config::StateHierarchyRule[]
+    BinaryConfigSection actionLists;    ///< BinaryActionList[]
+    BinaryConfigSection actions;        ///< BinaryActionItem[]
+    BinaryConfigSection strings;        ///< char[] (count = bytes)
+};
+
+/// Action list: slice of the action section
+struct BinaryActionList {
+    uint32_t state;
+    uint32_t firstAction;
+    uint32_t actionCount;
+    uint32_t timeoutMs;                 ///< config::ActionListEntry::timeoutMs
+};
+
+/// Action item with string pool references (kNoString = nullptr)
+struct BinaryActionItem {
+    uint8_t type;                       ///< config::ActionType
+    uint8_t reserved[3];
+    uint32_t targetOffset;
+    uint32_t paramOffset;
+    uint32_t sleepTimeMs;
+    uint32_t timeoutMs;
+    uint32_t dependsOn;
+};
+
+/**
+ * @brief Read-only, memory-mapped binary machine configuration
+ *
+ * The image is mapped with mmap (MAP_SHARED, PROT_READ) and used in
+ * place: rule tables are returned as pointers into the mapping, and
+ * action strings point into its string pool. Any number of SM
+ * processes share one page-cached copy of these raw tables. On
+ * platforms without mmap the file is read into a private buffer.
+ *
+ * The image holds raw rules only, no prebuilt indices: every process
+ * that loads it into a ConfigSnapshot still copies the action items
+ * (without their strings) and compiles its own rule engines, symbol
+ * table, action arena and plans, as for tables from source.
+ *
+ * Open() checks magic, version, size, CRC and all section bounds once;
+ * accessors do no further checking.
+ */
+class BinaryConfigImage {
+public:
+    static constexpr uint32_t kMagic = 0x434D5341U;     ///< "ASMC"
+    static constexpr uint16_t kVersion = 3U;      ///< 2: action and list timeouts, 3: dependencies
+    static constexpr uint32_t kNoString = 0xFFFFFFFFU;
+
+    BinaryConfigImage() = default;
+    ~BinaryConfigImage();
+
+    BinaryConfigImage(const BinaryConfigImage&) = delete;
+    BinaryConfigImage& operator=(const BinaryConfigImage&) = delete;
+    BinaryConfigImage(BinaryConfigImage&& other) noexcept;
+    BinaryConfigImage& operator=(BinaryConfigImage&& other) noexcept;
+
+    /**
+     * @brief Map and validate an image file
+     *
+     * @param path Image file
+     * @return kOperationFailed on I/O errors, kInvalidValue on format errors
+     */
+    ara::core::Result<void, StateManagementErrc> Open(const std::string& path);
+
+    /**
+     * @brief Validate and use an image already in memory (not owned)
+     *
+     * @param data Image bytes (4-byte aligned, must outlive this object)
+     * @param size Image size
+     * @return kInvalidValue on format errors
+     */
+    ara::core::Result<void, StateManagementErrc> Attach(const void* data, std::size_t size);
+
+    /// Unmap / detach
+    void Close();
+
+    bool IsOpen() const { return data_ != nullptr; }
+
+    const char* GetName() const { return GetString(Header().nameOffset); }
+
+    const config::TransitionRule* GetTransitions() const;
+    std::size_t GetTransitionCount() const { return Header().transitions.count; }
+
+    const config::ErrorRecoveryRule* GetErrorRecovery() const;
+    std::size_t GetErrorRecoveryCount() const { return Header().errorRecovery.count; }
+
+    const config::StateHierarchyRule* GetHierarchy() const;
+    std::size_t GetHierarchyCount() const { return Header().hierarchy.count; }
+
+    const BinaryActionList* GetActionLists() const;
+    std::size_t GetActionListCount() const { return Header().actionLists.count; }
+
+    /**
+     * @brief Action as config::ActionItem (strings point into the image)
+     *
+     * @param index Index into the action section
+     * @return Action item
+     */
+    config::ActionItem GetAction(std::size_t index) const;
+
+    /// String pool lookup (nullptr for kNoString)
+    const char* GetString(uint32_t offset) const;
+
+    /// Raw image
+    const uint8_t* GetData() const { return data_; }
+    std::size_t GetSize() const { return size_; }
+
+    /// CRC-32 (IEEE 802.3)
+    static uint32_t Crc32(const uint8_t* data, std::size_t size);
+
+    /**
+     * @brief Serialize tables into an image
+     *
+     * @return Image bytes
+     */
+    static std::vector<uint8_t> Build(
+        const std::string& name,
+        const config::TransitionRule* transitions, std::size_t transitionCount,
+        const config::ErrorRecoveryRule* recovery, std::size_t recoveryCount,
+        const config::StateHierarchyRule* hierarchy, std::size_t hierarchyCount,
+        const config::ActionListEntry* actionTable, std::size_t actionTableCount);
+
+    /**
+     * @brief Write bytes to a file
+     *
+     * @return kOperationFailed on I/O errors
+     */
+    static ara::core::Result<void, StateManagementErrc> WriteFile(
+        const std::string& path, const std::vector<uint8_t>& image);
+
+private:
+    const BinaryConfigHeader& Header() const
+    {
+        return *reinterpret_cast<const BinaryConfigHeader*>(data_);
+    }
+
+    ara::core::Result<void, StateManagementErrc> Validate() const;
+
+    const uint8_t* data_ = nullptr;
+    std::size_t size_ = 0U;
+    bool mapped_ = false;               ///< data_ is an mmap mapping
+    std::vector<uint8_t> buffer_;       ///< fallback storage without mmap
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_BINARY_CONFIG_H
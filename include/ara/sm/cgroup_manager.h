@@ -0,0 +1,109 @@
+#ifndef ARA_SM_CGROUP_MANAGER_H
+#define ARA_SM_CGROUP_MANAGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "result.h"
+#include "static_config.h"
+#include "types.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief cgroup v2 resource isolation of function groups
+ *
+ * Every function group gets one cgroup below the root cgroup
+ * (<root>/<functionGroup>). ApplyState() writes the limits of the new
+ * Function Group state from the config::ResourceItem table (cpu.weight,
+ * io.weight, cpuset.cpus), so tightened limits of a state also apply to
+ * the processes that keep running across the state change; Attach()
+ * moves a started process into its group.
+ *
+ * Controllers that are not enabled for the root have no interface files
+ * and are skipped, so the manager degrades to plain grouping on hosts
+ * without them. Files are written through the root path only, so a
+ * plain directory can stand in for the cgroup file system in tests.
+ *
+ * Only available on Linux; elsewhere Open() fails.
+ */
+class CgroupManager {
+public:
+    using Result = ara::core::Result<void, StateManagementErrc>;
+
+    static constexpr const char* kRootName = "ara_sm";   ///< Root cgroup below the mount
+
+    /**
+     * @param resources Resource table (must outlive this object)
+     * @param count Number of entries
+     * @param root Root cgroup directory; empty for kRootName below the cgroup2 mount
+     */
+    CgroupManager(const config::ResourceItem* resources, std::size_t count,
+                  std::string root = std::string());
+    ~CgroupManager();
+
+    CgroupManager(const CgroupManager&) = delete;
+    CgroupManager& operator=(const CgroupManager&) = delete;
+
+    /**
+     * @brief Create the root cgroup and enable cpu, io and cpuset below it
+     *
+     * @return kOperationFailed if there is no cgroup2 mount or the root
+     *         cannot be created
+     */
+    Result Open();
+
+    /**
+     * @brief Write the limits of a Function Group state to its cgroup
+     *
+     * Unset limits are written as the defaults, so limits of the
+     * previous state do not linger.
+     *
+     * @param functionGroup Function Group name
+     * @param state Function Group state name
+     * @return kOperationFailed if not open, the cgroup cannot be created
+     *         or the kernel rejects a limit
+     */
+    Result ApplyState(const char* functionGroup, const char* state);
+
+    /**
+     * @brief Move a process into the cgroup of its function group
+     *
+     * @param functionGroup Function Group name
+     * @param pid Process ID
+     * @return kOperationFailed if not open or the process cannot be moved
+     */
+    Result Attach(const char* functionGroup, int pid);
+
+    /// Root cgroup directory (resolved by Open())
+    const std::string& GetRoot() const { return root_; }
+    std::string GetPath(const char* functionGroup) const;
+
+    /**
+     * @brief Limits of a Function Group state
+     *
+     * @return Entry of the state, else the group entry, else nullptr
+     */
+    const config::ResourceItem* FindLimits(const char* functionGroup, const char* state) const;
+
+    /// Mount point of the cgroup2 file system, empty if not mounted
+    static std::string FindMount();
+
+private:
+    bool CreateGroup(const char* functionGroup);
+
+    const config::ResourceItem* resources_;
+    std::size_t resourceCount_;
+    std::string root_;
+    bool open_{false};
+    bool createdRoot_{false};
+    std::vector<std::string> groups_;   ///< Function group cgroups in use
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_CGROUP_MANAGER_H
@@ -0,0 +1,232 @@
+#ifndef ARA_SM_COMPILED_RULE_TABLE_H
+#define ARA_SM_COMPILED_RULE_TABLE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "static_config.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief Flattened (state, key) -> state lookup table
+ *
+ * Built once from a TransitionRequestTable or ErrorRecoveryTable plus an
+ * optional state hierarchy. Inherited rules are resolved while compiling,
+ * so a lookup is a state index load plus one matrix cell load regardless
+ * of nesting depth.
+ *
+ * Resolution order for a state: its own rules first, then the rules of
+ * each ancestor, nearest first. On each level an exact key match wins
+ * over the wildcard (catch-all) key; a wildcard found on a level ends
+ * the search for all keys still unresolved. Of several wildcard rules
+ * on one level the last one wins, as in a linear scan of the table.
+ *
+ * Guarded rules stay in the resolution order: every cell points at a
+ * short contiguous run of candidates, and the first candidate whose
+ * guard holds for the given condition word is taken (a failing child
+ * guard falls through to the parent). The run ends at the first
+ * unguarded candidate, so unguarded tables test exactly one candidate.
+ *
+ * @req [SWS_SM_00603-00607] StateMachine transition execution
+ * @req [SWS_SM_00601], [SWS_SM_CONSTR_00014] Error recovery incl. ANY rule
+ */
+class CompiledRuleTable {
+public:
+    /// Returned by Find() when no rule matches
+    static constexpr uint8_t kNoMatch = 0xFFU;
+
+    /// Maximum ancestor chain length (guards against cyclic hierarchies)
+    static constexpr std::size_t kMaxHierarchyDepth = 16U;
+
+    /// Keys below this bound are mapped to columns by direct indexing
+    static constexpr uint32_t kDirectKeyLimit = 1024U;
+
+    /// One flattened (state, key) -> state edge (candidate)
+    struct Edge {
+        uint8_t fromState;
+        uint32_t key;
+        uint8_t toState;
+        config::TransitionGuard guard;
+        bool last;                      ///< Last candidate for (fromState, key)
+    };
+
+    /**
+     * @brief Precomputed set of keys that have a rule in one state
+     *
+     * A view of one bitset row of the table (bit i = dense key index i,
+     * see GetKey()), or of a sorted key run for tables too large for a
+     * dense matrix (FromSortedKeys). Only exact keys are represented, the
+     * wildcard is not; guards are not taken into account.
+     */
+    class KeySet {
+    public:
+        KeySet() = default;
+
+        /**
+         * @brief View of a sorted key run
+         *
+         * @param keys Keys in ascending order (not copied)
+         * @param count Number of keys
+         */
+        static KeySet FromSortedKeys(const uint32_t* keys, std::size_t count);
+
+        /// One bit test (plus key -> index mapping), or a binary search
+        bool Contains(uint32_t key) const;
+
+        /// Test by dense key index (bitset rows only)
+        bool ContainsIndex(std::size_t index) const
+        {
+            return index < bitCount_ &&
+                   (words_[index / 64U] >> (index % 64U) & 1U) != 0U;
+        }
+
+        /// Number of keys in the set
+        std::size_t Count() const;
+
+        /// Keys in ascending order
+        std::vector<uint32_t> ToVector() const;
+
+        /// Raw bitset words (nullptr when empty or a sorted key run)
+        const uint64_t* GetWords() const { return words_; }
+        std::size_t GetWordCount() const { return (bitCount_ + 63U) / 64U; }
+
+    private:
+        friend class CompiledRuleTable;
+
+        const CompiledRuleTable* table_ = nullptr;
+        const uint64_t* words_ = nullptr;
+        std::size_t bitCount_ = 0U;
+        const uint32_t* sortedKeys_ = nullptr;
+        std::size_t sortedCount_ = 0U;
+    };
+
+    CompiledRuleTable() = default;
+
+    /**
+     * @brief Compile a transition table
+     *
+     * @param rules Transition rules
+     * @param count Number of rules
+     * @param hierarchy State hierarchy (may be nullptr)
+     * @param hierarchyCount Number of hierarchy entries
+     * @return Compiled table
+     */
+    static CompiledRuleTable FromTransitions(
+        const config::TransitionRule* rules,
+        std::size_t count,
+        const config::StateHierarchyRule* hierarchy,
+        std::size_t hierarchyCount);
+
+    /**
+     * @brief Compile an error recovery table
+     *
+     * config::kExecutionErrorAny is treated as wildcard key.
+     *
+     * @param rules Error recovery rules
+     * @param count Number of rules
+     * @param hierarchy State hierarchy (may be nullptr)
+     * @param hierarchyCount Number of hierarchy entries
+     * @return Compiled table
+     */
+    static CompiledRuleTable FromErrorRecovery(
+        const config::ErrorRecoveryRule* rules,
+        std::size_t count,
+        const config::StateHierarchyRule* hierarchy,
+        std::size_t hierarchyCount);
+
+    /**
+     * @brief Look up target state
+     *
+     * @param state Current state
+     * @param key Trigger or error code
+     * @param conditions Condition word for guard evaluation
+     * @return Target state, or kNoMatch
+     */
+    uint8_t Find(uint8_t state, uint32_t key,
+                 config::ConditionMask conditions = 0U) const;
+
+    /// Number of states with a row in the flattened table
+    std::size_t GetStateCount() const { return rowStates_.size(); }
+
+    /// Number of distinct (non-wildcard) keys
+    std::size_t GetKeyCount() const { return keys_.size(); }
+
+    /// Key of a dense key index (index < GetKeyCount())
+    uint32_t GetKey(std::size_t index) const { return keys_[index]; }
+
+    /**
+     * @brief Keys that have a rule in a state
+     *
+     * @param state State
+     * @return Key set (empty for unknown states)
+     */
+    KeySet GetKeySet(uint8_t state) const;
+
+    /**
+     * @brief Enumerate all flattened exact-key edges
+     *
+     * Every candidate is listed regardless of its guard, ordered by
+     * state row, then key, then resolution order.
+     *
+     * @return Edge list
+     */
+    std::vector<Edge> GetEdges() const;
+
+    /**
+     * @brief Enumerate resolved wildcard candidates (one per state at most)
+     *
+     * @return Edges keyed with the wildcard key (empty for transition tables)
+     */
+    std::vector<Edge> GetCatchAllEdges() const;
+
+    /// Whether the table was compiled with a wildcard key
+    bool HasWildcard() const { return hasWildcard_; }
+
+    /// Wildcard key (valid if HasWildcard())
+    uint32_t GetWildcardKey() const { return wildcardKey_; }
+
+private:
+    struct Rule {
+        uint32_t fromState;
+        uint32_t key;
+        uint32_t toState;
+        config::TransitionGuard guard;
+    };
+
+    struct Candidate {
+        uint8_t toState;
+        bool last;                      ///< Last candidate of its run
+        config::TransitionGuard guard;
+    };
+
+    static constexpr uint32_t kNoCandidate = 0xFFFFFFFFU;
+
+    uint32_t AppendRun(const std::vector<Candidate>& run);
+
+    static CompiledRuleTable Compile(
+        const std::vector<Rule>& rules,
+        const config::StateHierarchyRule* hierarchy,
+        std::size_t hierarchyCount,
+        bool hasWildcard,
+        uint32_t wildcardKey);
+
+    int KeyColumn(uint32_t key) const;
+
+    uint8_t stateRow_[256] = {};        ///< state -> row + 1 (0 = no row)
+    std::vector<uint8_t> rowStates_;    ///< row -> state
+    std::vector<uint32_t> keys_;        ///< column -> key (sorted)
+    std::vector<int16_t> keyColumn_;    ///< key -> column (-1 = none), small keys only
+    std::vector<uint32_t> cells_;       ///< rows x columns -> first candidate
+    std::vector<uint32_t> catchAll_;    ///< row -> wildcard candidate
+    std::vector<Candidate> candidates_; ///< candidate runs
+    std::vector<uint64_t> keyMasks_;    ///< rows x words -> key bitset
+    bool hasWildcard_ = false;
+    uint32_t wildcardKey_ = 0U;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_COMPILED_RULE_TABLE_H
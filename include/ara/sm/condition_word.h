@@ -0,0 +1,76 @@
+#ifndef ARA_SM_CONDITION_WORD_H
+#define ARA_SM_CONDITION_WORD_H
+
+#include <atomic>
+#include <cstdint>
+#include "static_config.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief Shared condition word evaluated by transition guards
+ *
+ * One process-wide bitset. Components publish facts (update allowed,
+ * update session active, ...) as bits; guarded transition rules test
+ * them with a mask compare (see config::EvaluateGuard). Reading the
+ * word is a single acquire load; bits are published with release, so
+ * whatever a component wrote before setting a bit is visible to a
+ * guard that sees it.
+ */
+class ConditionWord {
+public:
+    /**
+     * @brief Set condition bits
+     * @param bits Bits to set
+     */
+    static void Set(config::ConditionMask bits) {
+        word_.fetch_or(bits, std::memory_order_release);
+    }
+
+    /**
+     * @brief Clear condition bits
+     * @param bits Bits to clear
+     */
+    static void Clear(config::ConditionMask bits) {
+        word_.fetch_and(~bits, std::memory_order_release);
+    }
+
+    /**
+     * @brief Set or clear condition bits
+     * @param bits Bits to change
+     * @param value true = set, false = clear
+     */
+    static void Assign(config::ConditionMask bits, bool value) {
+        if (value) {
+            Set(bits);
+        } else {
+            Clear(bits);
+        }
+    }
+
+    /**
+     * @brief Get current condition word
+     * @return Condition bits
+     */
+    static config::ConditionMask Get() {
+        return word_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Check that all given bits are set
+     * @param bits Bits to test
+     * @return true if all bits are set
+     */
+    static bool IsSet(config::ConditionMask bits) {
+        return (Get() & bits) == bits;
+    }
+
+private:
+    static inline std::atomic<config::ConditionMask> word_{0U};
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_CONDITION_WORD_H
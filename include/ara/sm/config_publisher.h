@@ -0,0 +1,150 @@
+#ifndef ARA_SM_CONFIG_PUBLISHER_H
+#define ARA_SM_CONFIG_PUBLISHER_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "result.h"
+#include "types.h"
+#include "config_snapshot.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief RCU-style publication of ConfigSnapshot tables (hot reload)
+ *
+ * Readers enter a read section with Read(): they announce the current
+ * global epoch in a free reader slot and load the current snapshot
+ * pointer - one CAS and two atomic loads, no locks. Publish() swaps the
+ * pointer, retires the old snapshot tagged with the epoch it was
+ * replaced in and advances the epoch. A retired snapshot is freed once
+ * no reader slot holds an epoch at or below its retire epoch, so
+ * in-flight readers always finish on the snapshot they started with.
+ *
+ * Writers (Publish, Reclaim) are serialized by a mutex that readers
+ * never touch.
+ */
+class ConfigPublisher {
+public:
+    /// Concurrent read sections (nested sections use one slot each)
+    static constexpr std::size_t kReaderSlots = 64U;
+
+    /**
+     * @brief Read section holding one snapshot alive
+     *
+     * Move-only; the snapshot stays valid until the guard is destroyed.
+     */
+    class ReadGuard {
+    public:
+        ReadGuard(ReadGuard&& other) noexcept;
+        ReadGuard& operator=(ReadGuard&&) = delete;
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        ~ReadGuard();
+
+        const ConfigSnapshot* Get() const { return snapshot_; }
+        const ConfigSnapshot* operator->() const { return snapshot_; }
+        const ConfigSnapshot& operator*() const { return *snapshot_; }
+        explicit operator bool() const { return snapshot_ != nullptr; }
+
+    private:
+        friend class ConfigPublisher;
+
+        ReadGuard(ConfigPublisher* publisher, std::size_t slot,
+                  const ConfigSnapshot* snapshot)
+            : publisher_(publisher), slot_(slot), snapshot_(snapshot) {}
+
+        ConfigPublisher* publisher_;
+        std::size_t slot_;
+        const ConfigSnapshot* snapshot_;
+    };
+
+    ConfigPublisher() = default;
+
+    /**
+     * @brief Start with an initial snapshot
+     *
+     * @param initial Loaded snapshot
+     */
+    explicit ConfigPublisher(std::unique_ptr<ConfigSnapshot> initial);
+
+    /// Frees all snapshots; no read section may be open
+    ~ConfigPublisher();
+
+    ConfigPublisher(const ConfigPublisher&) = delete;
+    ConfigPublisher& operator=(const ConfigPublisher&) = delete;
+
+    /**
+     * @brief Enter a read section (lock-free)
+     *
+     * @return Guard on the current snapshot (empty if nothing published)
+     */
+    ReadGuard Read();
+
+    /**
+     * @brief Atomically replace the current snapshot
+     *
+     * Readers that entered before the swap keep the old snapshot; it is
+     * reclaimed after the last of them leaves.
+     *
+     * @param snapshot Snapshot to publish
+     * @return kInvalidValue if the snapshot is missing or not loaded
+     */
+    ara::core::Result<void, StateManagementErrc> Publish(std::unique_ptr<ConfigSnapshot> snapshot);
+
+    /**
+     * @brief Build, validate and publish a table set
+     *
+     * @param tables Table set (copied)
+     * @return Validation error; the current snapshot stays in place
+     */
+    ara::core::Result<void, StateManagementErrc> Publish(const ConfigTables& tables);
+
+    /**
+     * @brief Free retired snapshots no reader can still see
+     *
+     * Called by Publish(); may be called again after readers finished.
+     *
+     * @return Number of snapshots still waiting for readers
+     */
+    std::size_t Reclaim();
+
+    /// Current epoch (incremented by every Publish)
+    uint64_t GetEpoch() const { return epoch_.load(std::memory_order_acquire); }
+
+    /// Retired snapshots not yet freed
+    std::size_t GetRetiredCount() const;
+
+private:
+    static constexpr uint64_t kIdle = 0U;
+
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch{kIdle};
+    };
+
+    struct Retired {
+        uint64_t epoch;
+        std::unique_ptr<ConfigSnapshot> snapshot;
+    };
+
+    void Leave(std::size_t slot);
+    std::size_t ReclaimLocked();
+
+    std::atomic<const ConfigSnapshot*> current_{nullptr};
+    std::atomic<uint64_t> epoch_{1U};
+    ReaderSlot slots_[kReaderSlots];
+
+    mutable std::mutex writerMutex_;
+    std::unique_ptr<ConfigSnapshot> owned_;     ///< Snapshot behind current_
+    std::vector<Retired> retired_;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_CONFIG_PUBLISHER_H
@@ -0,0 +1,236 @@
+#ifndef ARA_SM_CONFIG_SNAPSHOT_H
+#define ARA_SM_CONFIG_SNAPSHOT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "result.h"
+#include "types.h"
+#include "static_config.h"
+#include "action_arena.h"
+#include "action_plan.h"
+#include "compiled_rule_table.h"
+#include "rule_matcher.h"
+#include "symbol_table.h"
+#include "transition_planner.h"
+
+namespace ara {
+namespace sm {
+
+class BinaryConfigImage;
+
+/**
+ * @brief Raw table set of one machine configuration
+ *
+ * Plain views; ConfigSnapshot::Load() copies everything it needs.
+ */
+struct ConfigTables {
+    const char* name;
+    const config::TransitionRule* transitions;
+    std::size_t transitionCount;
+    const config::ErrorRecoveryRule* errorRecovery;
+    std::size_t errorRecoveryCount;
+    const config::StateHierarchyRule* hierarchy;
+    std::size_t hierarchyCount;
+    const config::ActionListEntry* actionLists;
+    std::size_t actionListCount;
+};
+
+/**
+ * @brief Immutable, self-contained set of transition, recovery and action tables
+ *
+ * A snapshot is validated and fully compiled by Load() (matchers,
+ * allowed-trigger sets, planner, per-state action index, interned
+ * action names, action plans) and never
+ * changes afterwards, so any number of threads may read it without
+ * synchronization. Hot reload builds a new snapshot and publishes it
+ * through a ConfigPublisher.
+ */
+class ConfigSnapshot {
+public:
+    /// Returned by FindTransition() / FindRecovery() when no rule matches
+    static constexpr uint8_t kNoMatch = CompiledRuleTable::kNoMatch;
+
+    ConfigSnapshot() = default;
+    ~ConfigSnapshot();
+
+    ConfigSnapshot(const ConfigSnapshot&) = delete;
+    ConfigSnapshot& operator=(const ConfigSnapshot&) = delete;
+
+    /**
+     * @brief Validate and compile a table set (tables are copied)
+     *
+     * @param tables Table set
+     * @return kInvalidValue if the tables are inconsistent,
+     *         kOperationRejected if the snapshot is already loaded
+     */
+    ara::core::Result<void, StateManagementErrc> Load(const ConfigTables& tables);
+
+    /**
+     * @brief Validate and compile an opened binary image
+     *
+     * Rules are used in place and action strings point into the image,
+     * which the snapshot keeps alive. Action items are copied, and rule
+     * engines, symbols and plans are compiled per snapshot; the image
+     * carries no prebuilt indices.
+     *
+     * @param image Opened image
+     * @return kInvalidValue if the image is closed or inconsistent,
+     *         kOperationRejected if the snapshot is already loaded
+     */
+    ara::core::Result<void, StateManagementErrc> Load(
+        std::shared_ptr<const BinaryConfigImage> image);
+
+    /**
+     * @brief Consistency check of a table set
+     *
+     * Checks table pointers, state IDs (0..254), action lists (one per
+     * state, non-empty action arrays, known action types) and that the
+     * hierarchy is acyclic and at most CompiledRuleTable::kMaxHierarchyDepth
+     * deep.
+     *
+     * @param tables Table set
+     * @return kInvalidValue on the first inconsistency
+     */
+    static ara::core::Result<void, StateManagementErrc> Validate(const ConfigTables& tables);
+
+    bool IsLoaded() const { return loaded_; }
+
+    const std::string& GetName() const { return name_; }
+
+    /**
+     * @brief Transition target
+     *
+     * @param state Current state
+     * @param trigger Transition request
+     * @param conditions Condition word for guard evaluation
+     * @return Target state, or kNoMatch
+     */
+    uint8_t FindTransition(uint8_t state, TransitionRequestType trigger,
+                           config::ConditionMask conditions) const
+    {
+        return transitions_.Find(state, trigger, conditions);
+    }
+
+    /**
+     * @brief Error recovery target
+     *
+     * @param state Current state
+     * @param error Execution error
+     * @return Recovery state, or kNoMatch
+     */
+    uint8_t FindRecovery(uint8_t state, ExecutionErrorType error) const
+    {
+        return recovery_.Find(state, error);
+    }
+
+    /// Engines serving FindTransition() / FindRecovery()
+    RuleMatcher::Engine GetTransitionEngine() const { return transitions_.GetEngine(); }
+    RuleMatcher::Engine GetRecoveryEngine() const { return recovery_.GetEngine(); }
+
+    /// Triggers that have a rule in a state (guards not evaluated)
+    CompiledRuleTable::KeySet GetAllowedTriggers(uint8_t state) const
+    {
+        const CompiledRuleTable* dense = transitions_.GetDenseTable();
+        if (dense != nullptr) {
+            return dense->GetKeySet(state);
+        }
+        if (allowedBegin_.empty()) {
+            return CompiledRuleTable::KeySet();
+        }
+        return CompiledRuleTable::KeySet::FromSortedKeys(
+            allowedKeys_.data() + allowedBegin_[state],
+            allowedBegin_[state + 1U] - allowedBegin_[state]);
+    }
+
+    /// Shortest trigger paths over the transition table
+    const TransitionPlanner& GetPlanner() const { return planner_; }
+
+    /**
+     * @brief Action list of a state
+     *
+     * @param state State
+     * @return Entry, or nullptr if the state has no action list
+     */
+    const config::ActionListEntry* FindActionList(uint8_t state) const
+    {
+        const uint16_t index = actionIndex_[state];
+        return index == 0U ? nullptr : &actionLists_[index - 1U];
+    }
+
+    /**
+     * @brief Action list of a state with names interned in GetSymbols()
+     *
+     * @param state State
+     * @return List, or nullptr if the state has no action list
+     */
+    const ResolvedActionList* FindResolvedActionList(uint8_t state) const
+    {
+        const uint16_t index = actionIndex_[state];
+        return index == 0U ? nullptr : &resolvedLists_[index - 1U];
+    }
+
+    /// Names of every action target and parameter of this snapshot
+    const SymbolTable& GetSymbols() const { return symbols_; }
+
+    /// Packed actions of every list of this snapshot
+    const ActionArena& GetActionArena() const { return arena_; }
+
+    std::size_t GetTransitionCount() const { return transitionCount_; }
+    std::size_t GetErrorRecoveryCount() const { return errorRecoveryCount_; }
+    std::size_t GetActionListCount() const { return actionLists_.size(); }
+
+private:
+    friend class MachineConfig;
+
+    /**
+     * @brief Load built-in tables with their build-time perfect hashes
+     *
+     * Only for MachineConfig::GetDefault(): the hashes are generated from
+     * the same static_config tables (tools/perfect_hash_gen) and cannot
+     * be checked against other tables cheaply, so reloads never pass them.
+     */
+    ara::core::Result<void, StateManagementErrc> LoadGenerated(
+        const ConfigTables& tables,
+        const PerfectHashTable* transitionHash, const PerfectHashTable* recoveryHash);
+
+    ara::core::Result<void, StateManagementErrc> Compile(
+        const ConfigTables& tables,
+        const PerfectHashTable* transitionHash = nullptr,
+        const PerfectHashTable* recoveryHash = nullptr);
+
+    std::string name_;
+    bool loaded_ = false;
+
+    // Owned copies (Load(ConfigTables)) or views into image_
+    std::vector<config::TransitionRule> transitionRules_;
+    std::vector<config::ErrorRecoveryRule> recoveryRules_;
+    std::vector<config::StateHierarchyRule> hierarchy_;
+    std::vector<config::ActionItem> actions_;
+    std::deque<std::string> strings_;
+    std::shared_ptr<const BinaryConfigImage> image_;
+
+    RuleMatcher transitions_;
+    RuleMatcher recovery_;
+    std::vector<uint32_t> allowedKeys_;   ///< Sorted keys per state (not dense only)
+    std::vector<uint32_t> allowedBegin_;  ///< state -> first allowed key (257 entries)
+    TransitionPlanner planner_;
+
+    std::vector<config::ActionListEntry> actionLists_;
+    SymbolTable symbols_;
+    ActionArena arena_;                                 ///< Every list, packed
+    ActionPlanSet plans_;                               ///< Parallel to actionLists_
+    std::vector<ResolvedActionList> resolvedLists_;     ///< Parallel to actionLists_
+    uint16_t actionIndex_[256] = {};    ///< state -> actionLists_ index + 1 (0 = none)
+    std::size_t transitionCount_ = 0U;
+    std::size_t errorRecoveryCount_ = 0U;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_CONFIG_SNAPSHOT_H
@@ -0,0 +1,404 @@
+#ifndef ARA_SM_CONFIG_VALIDATOR_H
+#define ARA_SM_CONFIG_VALIDATOR_H
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include "static_config.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief First defect found by ConfigValidator::FirstDefect
+ */
+enum class ConfigDefect : uint8_t {
+    kNone = 0,
+    kStateOutOfRange,           ///< State ID above 254 (0xFF is the no-match marker)
+    kDuplicateTransition,       ///< Rule shadowed by an earlier rule with the same key
+    kDuplicateRecovery,         ///< Two recovery rules for the same (state, error)
+    kBadHierarchy,              ///< Two parents, cycle or nesting deeper than 16
+    kBadActionList,             ///< Duplicate list, missing array or list on composite state
+    kDanglingState,             ///< Target is composite or has neither rules nor actions
+    kUnreachableState           ///< State cannot be entered from the entry states
+};
+
+/**
+ * @brief Build-time consistency checks over a static table set
+ *
+ * Config is a table set type with static constexpr members
+ *
+ *     kTransitions / kTransitionsCount           (config::TransitionRule)
+ *     kErrorRecovery / kErrorRecoveryCount       (config::ErrorRecoveryRule)
+ *     kStateHierarchy / kStateHierarchyCount     (config::StateHierarchyRule)
+ *     kActionTable / kActionTableCount           (config::ActionListEntry)
+ *
+ * Every check is a constant expression meant for static_assert, so a
+ * broken table fails the build instead of misbehaving at runtime.
+ * Engines specialized on a table set (StaticStateMachine) assert the
+ * structural checks and rely on them without runtime validation.
+ *
+ * States that are the parent of another state are composite: they only
+ * carry inherited rules and are never entered.
+ */
+template <typename Config>
+class ConfigValidator {
+public:
+    static constexpr uint32_t kMaxStateId = 0xFEU;
+    static constexpr std::size_t kMaxHierarchyDepth = 16U;
+
+    /// Every state ID fits the 8-bit state index of the compiled tables
+    static constexpr bool StatesInRange()
+    {
+        for (std::size_t i = 0; i < Config::kTransitionsCount; i++) {
+            if (Config::kTransitions[i].fromState > kMaxStateId ||
+                Config::kTransitions[i].toState > kMaxStateId) {
+                return false;
+            }
+        }
+        for (std::size_t i = 0; i < Config::kErrorRecoveryCount; i++) {
+            if (Config::kErrorRecovery[i].fromState > kMaxStateId ||
+                Config::kErrorRecovery[i].toState > kMaxStateId) {
+                return false;
+            }
+        }
+        for (std::size_t i = 0; i < Config::kStateHierarchyCount; i++) {
+            if (Config::kStateHierarchy[i].state > kMaxStateId ||
+                Config::kStateHierarchy[i].parentState > kMaxStateId) {
+                return false;
+            }
+        }
+        for (std::size_t i = 0; i < Config::kActionTableCount; i++) {
+            if (Config::kActionTable[i].state > kMaxStateId) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief No transition rule is dead
+     *
+     * A rule is dead when an earlier rule with the same (state, trigger)
+     * is unguarded or has the same guard.
+     */
+    static constexpr bool TransitionKeysUnique()
+    {
+        for (std::size_t j = 0; j < Config::kTransitionsCount; j++) {
+            const auto& rule = Config::kTransitions[j];
+            for (std::size_t i = 0; i < j; i++) {
+                const auto& earlier = Config::kTransitions[i];
+                if (earlier.fromState == rule.fromState && earlier.trigger == rule.trigger &&
+                    (IsUnguarded(earlier.guard) || SameGuard(earlier.guard, rule.guard))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// At most one recovery rule per (state, error), wildcard included
+    static constexpr bool RecoveryKeysUnique()
+    {
+        for (std::size_t j = 0; j < Config::kErrorRecoveryCount; j++) {
+            for (std::size_t i = 0; i < j; i++) {
+                if (Config::kErrorRecovery[i].fromState == Config::kErrorRecovery[j].fromState &&
+                    Config::kErrorRecovery[i].errorCode == Config::kErrorRecovery[j].errorCode) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// One parent per state, no cycle, at most kMaxHierarchyDepth levels
+    static constexpr bool HierarchyWellFormed()
+    {
+        if (!StatesInRange()) {
+            return false;
+        }
+        for (std::size_t j = 0; j < Config::kStateHierarchyCount; j++) {
+            for (std::size_t i = 0; i < j; i++) {
+                if (Config::kStateHierarchy[i].state == Config::kStateHierarchy[j].state) {
+                    return false;
+                }
+            }
+        }
+
+        const auto parent = BuildParents();
+        for (std::size_t i = 0; i < Config::kStateHierarchyCount; i++) {
+            uint32_t level = Config::kStateHierarchy[i].state;
+            std::size_t depth = 0U;
+            while (level != kNone) {
+                if (++depth > kMaxHierarchyDepth) {
+                    return false;
+                }
+                level = parent[level];
+            }
+        }
+        return true;
+    }
+
+    /// One list per state, array present for a non-empty list, never on a composite
+    static constexpr bool ActionListsWellFormed()
+    {
+        if (!StatesInRange()) {
+            return false;
+        }
+        const auto composite = BuildComposite();
+        for (std::size_t j = 0; j < Config::kActionTableCount; j++) {
+            const auto& entry = Config::kActionTable[j];
+            if ((entry.actions == nullptr && entry.actionCount != 0U) ||
+                composite[entry.state]) {
+                return false;
+            }
+            for (std::size_t i = 0; i < j; i++) {
+                if (Config::kActionTable[i].state == entry.state) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Every entered state is a real state
+     *
+     * Transition and recovery targets must not be composite and must own
+     * (or inherit) rules or an action list; a target that appears nowhere
+     * else is almost always a typo.
+     */
+    static constexpr bool NoDanglingStates()
+    {
+        if (!StatesInRange()) {
+            return false;
+        }
+        const auto composite = BuildComposite();
+        const auto defined = BuildDefined();
+        for (std::size_t i = 0; i < Config::kTransitionsCount; i++) {
+            const uint32_t to = Config::kTransitions[i].toState;
+            if (composite[to] || !defined[to]) {
+                return false;
+            }
+        }
+        for (std::size_t i = 0; i < Config::kErrorRecoveryCount; i++) {
+            const uint32_t to = Config::kErrorRecovery[i].toState;
+            if (composite[to] || !defined[to]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Every non-composite state can be entered
+     *
+     * Walks transitions (guards assumed satisfiable) and error recovery,
+     * both with inheritance, from the given entry states.
+     *
+     * @param entryStates States a machine may be started in
+     * @return true if every state owning rules, a parent or an action
+     *         list is reachable
+     */
+    template <std::size_t N>
+    static constexpr bool AllStatesReachable(const uint32_t (&entryStates)[N])
+    {
+        if (!HierarchyWellFormed()) {
+            return false;
+        }
+        const auto parent = BuildParents();
+        const auto composite = BuildComposite();
+
+        std::array<bool, 256> reached{};
+        for (std::size_t i = 0; i < N; i++) {
+            if (entryStates[i] > kMaxStateId) {
+                return false;
+            }
+            reached[entryStates[i]] = true;
+        }
+
+        // Fixed point; tables are small, so rescanning beats a work list here
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (std::size_t i = 0; i < Config::kTransitionsCount; i++) {
+                changed = Follow(reached, parent, Config::kTransitions[i].fromState,
+                                 Config::kTransitions[i].toState) || changed;
+            }
+            for (std::size_t i = 0; i < Config::kErrorRecoveryCount; i++) {
+                changed = Follow(reached, parent, Config::kErrorRecovery[i].fromState,
+                                 Config::kErrorRecovery[i].toState) || changed;
+            }
+        }
+
+        const auto defined = BuildDefined();
+        for (uint32_t state = 0; state <= kMaxStateId; state++) {
+            if (defined[state] && !composite[state] && !reached[state]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Structural checks an engine may rely on (everything but reachability)
+    static constexpr bool IsWellFormed()
+    {
+        return FirstDefect() == ConfigDefect::kNone;
+    }
+
+    /// First failing structural check, kNone if the table set is well formed
+    static constexpr ConfigDefect FirstDefect()
+    {
+        if (!StatesInRange()) {
+            return ConfigDefect::kStateOutOfRange;
+        }
+        if (!TransitionKeysUnique()) {
+            return ConfigDefect::kDuplicateTransition;
+        }
+        if (!RecoveryKeysUnique()) {
+            return ConfigDefect::kDuplicateRecovery;
+        }
+        if (!HierarchyWellFormed()) {
+            return ConfigDefect::kBadHierarchy;
+        }
+        if (!ActionListsWellFormed()) {
+            return ConfigDefect::kBadActionList;
+        }
+        if (!NoDanglingStates()) {
+            return ConfigDefect::kDanglingState;
+        }
+        return ConfigDefect::kNone;
+    }
+
+private:
+    static constexpr uint32_t kNone = 0xFFU;
+
+    static constexpr bool IsUnguarded(const config::TransitionGuard& guard)
+    {
+        return guard.allOf == 0U && guard.noneOf == 0U;
+    }
+
+    static constexpr bool SameGuard(const config::TransitionGuard& a,
+                                    const config::TransitionGuard& b)
+    {
+        return a.allOf == b.allOf && a.noneOf == b.noneOf;
+    }
+
+    static constexpr std::array<uint32_t, 256> BuildParents()
+    {
+        std::array<uint32_t, 256> parent{};
+        for (auto& entry : parent) {
+            entry = kNone;
+        }
+        for (std::size_t i = 0; i < Config::kStateHierarchyCount; i++) {
+            parent[Config::kStateHierarchy[i].state] = Config::kStateHierarchy[i].parentState;
+        }
+        return parent;
+    }
+
+    static constexpr std::array<bool, 256> BuildComposite()
+    {
+        std::array<bool, 256> composite{};
+        for (std::size_t i = 0; i < Config::kStateHierarchyCount; i++) {
+            composite[Config::kStateHierarchy[i].parentState] = true;
+        }
+        return composite;
+    }
+
+    /// States that own rules, take part in the hierarchy or have an action list
+    static constexpr std::array<bool, 256> BuildDefined()
+    {
+        std::array<bool, 256> defined{};
+        for (std::size_t i = 0; i < Config::kTransitionsCount; i++) {
+            defined[Config::kTransitions[i].fromState] = true;
+        }
+        for (std::size_t i = 0; i < Config::kErrorRecoveryCount; i++) {
+            defined[Config::kErrorRecovery[i].fromState] = true;
+        }
+        for (std::size_t i = 0; i < Config::kStateHierarchyCount; i++) {
+            defined[Config::kStateHierarchy[i].state] = true;
+            defined[Config::kStateHierarchy[i].parentState] = true;
+        }
+        for (std::size_t i = 0; i < Config::kActionTableCount; i++) {
+            defined[Config::kActionTable[i].state] = true;
+        }
+        return defined;
+    }
+
+    /// Mark `to` reached if `from` or a reached descendant of it is reached
+    static constexpr bool Follow(std::array<bool, 256>& reached,
+                                 const std::array<uint32_t, 256>& parent,
+                                 uint32_t from, uint32_t to)
+    {
+        if (reached[to]) {
+            return false;
+        }
+        for (uint32_t state = 0; state <= kMaxStateId; state++) {
+            if (!reached[state]) {
+                continue;
+            }
+            for (uint32_t level = state; level != kNone; level = parent[level]) {
+                if (level == from) {
+                    reached[to] = true;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief Dependencies of one action list are usable
+ *
+ * A list that declares dependencies (any ActionItem::dependsOn set) has
+ * no SYNC items, and every item only depends on earlier items. Action
+ * arrays are not constant expressions in general, so this is checked
+ * per list (constexpr arrays) and by ConfigSnapshot at load.
+ */
+constexpr bool ActionDependenciesValid(const config::ActionItem* actions, std::size_t count)
+{
+    bool hasDependencies = false;
+    bool hasSync = false;
+    for (std::size_t i = 0; i < count; i++) {
+        const uint32_t later = i < 32U ? ~((1U << i) - 1U) : 0U;
+        if ((actions[i].dependsOn & later) != 0U) {
+            return false;
+        }
+        hasDependencies = hasDependencies || actions[i].dependsOn != 0U;
+        hasSync = hasSync || actions[i].type == config::ActionType::kSync;
+    }
+    return !(hasDependencies && hasSync);
+}
+
+/**
+ * @brief Check hand-written action counts against the action arrays
+ *
+ * The action arrays must be passed in table order:
+ *
+ *     static_assert(ActionCountsMatch(kActionTable, kActionTableCount,
+ *                                     kInitialActions, kStartupActions, ...), "...");
+ *
+ * @return true if the table has one entry per array, each pointing at
+ *         its array with actionCount equal to the array size
+ */
+template <std::size_t... N>
+constexpr bool ActionCountsMatch(const config::ActionListEntry* table, std::size_t count,
+                                 const config::ActionItem (&... lists)[N])
+{
+    const config::ActionItem* const arrays[] = {lists...};
+    const std::size_t sizes[] = {N...};
+    if (count != sizeof...(N)) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (table[i].actions != arrays[i] || table[i].actionCount != sizes[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_CONFIG_VALIDATOR_H
@@ -6,6 +6,7 @@
 #include "static_config.h"            // from config/ (added to include dirs)
 #include "state_machine.h"
 #include  "types.h"     // for StateMachine::Category
+#include "rule_matcher.h"
 
 namespace ara {
 namespace sm {
@@ -56,6 +57,15 @@ public:
         uint8_t currentState, 
         ExecutionErrorType errorCode,
         StateMachine::Category category);
+
+    /**
+     * @brief Get recovery lookup engine (selected by table shape)
+     *
+     * @param category Controller or Agent
+     * @return Error recovery matcher
+     */
+    static const RuleMatcher& GetMatcher(
+        StateMachine::Category category);
 };
 
 // class ErrorRecoveryTable {
@@ -4,21 +4,38 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "action_arena.h"
+#include "result.h"
+#include "types.h"
+
 namespace ara {
 namespace sm {
 
-namespace config {
-    struct ActionItem;
-}
-
 class IActionExecutor {
 public:
+    using Result = ara::core::Result<void, StateManagementErrc>;
+
     virtual ~IActionExecutor() = default;
 
-    // Execute an array of actions (count items)
-    virtual void ExecuteActionList(const config::ActionItem* actions, std::size_t count) = 0;
+    // Execute an array of actions (count items); kTransitionFailed if
+    // the list failed
+    virtual Result ExecuteActionList(const config::ActionItem* actions, std::size_t count) = 0;
+
+    // Same, within timeoutMs for the whole list (0: no limit); the
+    // default does not bound the list
+    virtual Result ExecuteActionList(const config::ActionItem* actions, std::size_t count,
+                                     uint32_t /*timeoutMs*/)
+    {
+        return ExecuteActionList(actions, count);
+    }
     // Execute single action
-    virtual void ExecuteAction(const config::ActionItem& action) = 0;
+    virtual Result ExecuteAction(const config::ActionItem& action) = 0;
+    // Execute an action list by symbol IDs; the default hands the
+    // original items to ExecuteActionList()
+    virtual Result ExecuteResolvedActionList(const ResolvedActionList& list)
+    {
+        return ExecuteActionList(list.items, list.actionCount, list.timeoutMs);
+    }
 };
 
 } // namespace sm
@@ -0,0 +1,93 @@
+#ifndef ARA_SM_I_BATCH_ACTION_EXECUTOR_H
+#define ARA_SM_I_BATCH_ACTION_EXECUTOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "i_action_executor.h"
+#include "action_plan.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief Actions of one type between two barriers
+ *
+ * All actions of a batch may be issued at once [SWS_SM_00611], e.g. as
+ * one bulk request to Execution Management for every function group
+ * state of a segment.
+ */
+struct ActionBatch {
+    ActionGroup group;
+    const PackedAction* actions;        ///< count actions, all of group
+    std::size_t count;
+    const SymbolTable* symbols;         ///< Table the IDs refer to
+};
+
+/**
+ * @brief Executor that takes whole typed segments instead of items
+ *
+ * Walks the precompiled plan of a resolved list and hands each
+ * non-empty group of a segment to ExecuteActionBatch() in one call,
+ * followed by ExecuteSegmentBarrier() when the segment ends in a sleep
+ * or SYNC. Backends only override the two batch hooks; the item-based
+ * IActionExecutor entry points stay for lists without a plan. The walk
+ * stops at the first failed batch or barrier, or once ListAborted()
+ * returns true (checked before each segment and after the last one),
+ * and then reports kTransitionFailed.
+ *
+ * Lists with a dependency plan go to ExecuteActionGraph(); unless a
+ * backend schedules the graph itself, it walks the segments as well.
+ */
+class IBatchActionExecutor : public IActionExecutor {
+public:
+    ~IBatchActionExecutor() override = default;
+
+    // Issue every action of one batch
+    virtual Result ExecuteActionBatch(const ActionBatch& batch) = 0;
+    // Wait sleepMs, then for all issued actions if sync is set (at
+    // most timeoutMs if not 0)
+    virtual Result ExecuteSegmentBarrier(uint32_t sleepMs, bool sync, uint32_t timeoutMs) = 0;
+    // Checked before each segment and at the end; true fails the list
+    virtual bool ListAborted() { return false; }
+    // Run a list with a dependency plan (ActionPlan::nodes)
+    virtual Result ExecuteActionGraph(const ResolvedActionList& list) { return ExecuteSegments(list); }
+
+    Result ExecuteResolvedActionList(const ResolvedActionList& list) override
+    {
+        return list.plan.nodeCount != 0U ? ExecuteActionGraph(list) : ExecuteSegments(list);
+    }
+
+protected:
+    Result ExecuteSegments(const ResolvedActionList& list)
+    {
+        const Result failed(StateManagementErrc::kTransitionFailed);
+        const ActionPlan& plan = list.plan;
+        for (std::size_t i = 0; i < plan.segmentCount; i++) {
+            const PlanSegment& segment = plan.segments[i];
+            if (ListAborted()) {
+                return failed;
+            }
+            for (std::size_t g = 0; g < kActionGroupCount; g++) {
+                const auto group = static_cast<ActionGroup>(g);
+                const std::size_t begin = segment.GroupBegin(group);
+                const std::size_t end = segment.GroupEnd(group);
+                if (begin != end &&
+                    !ExecuteActionBatch({group, plan.actions + begin, end - begin, list.symbols}).HasValue()) {
+                    return failed;
+                }
+            }
+            if ((segment.sleepMs != 0U || segment.sync) &&
+                !ExecuteSegmentBarrier(segment.sleepMs, segment.sync, segment.timeoutMs).HasValue()) {
+                return failed;
+            }
+        }
+        // A deadline that cut the last sleep short
+        return ListAborted() ? failed : Result();
+    }
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_I_BATCH_ACTION_EXECUTOR_H
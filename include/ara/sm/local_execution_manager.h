@@ -0,0 +1,296 @@
+#ifndef ARA_SM_LOCAL_EXECUTION_MANAGER_H
+#define ARA_SM_LOCAL_EXECUTION_MANAGER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "action_executor.h"
+#include "result.h"
+#include "static_config.h"
+#include "types.h"
+
+namespace ara {
+namespace sm {
+
+class CgroupManager;
+class ProcessSupervisor;
+class StateMachine;
+
+/**
+ * @brief Start of one Function Group state, as measured by LocalExecutionManager
+ */
+struct FunctionGroupStartReport {
+    std::string functionGroup;
+    std::string state;
+    std::size_t processCount;               ///< Processes started for the state
+    std::size_t failedCount;                ///< Failed to spawn, exited non-zero or timed out
+    std::chrono::microseconds latency;      ///< Request to last process ready
+};
+
+/**
+ * @brief Execution Management stand-in for a plain Linux host
+ *
+ * Maps Function Group states to the processes of a config::ProcessItem
+ * table. A SetFunctionGroupState action stops the processes of the
+ * function group that are not configured in the new state and spawns
+ * the missing ones with posix_spawn, all without waiting; readiness is
+ * collected at the next SYNC (or at the end of the action list), so
+ * every function group requested in a segment starts in parallel.
+ *
+ * A process is ready when it writes a byte to kReadyFd, or when it
+ * exits with status 0 before that (one-shot init steps). Readiness
+ * pipes and pidfds of all starting processes are watched with a single
+ * epoll instance. Per-state start latency is kept in GetReports().
+ *
+ * Prelaunch() starts the processes of a likely next state ahead of time
+ * with kReleaseFdEnv set: such a process does its exec and dynamic
+ * linking, then parks reading kReleaseFd. A later request of that state
+ * releases it instead of spawning it: the manager closes the write end
+ * of the release pipe, so the parked read returns end of file (0), and
+ * the process continues. Nothing is ever written to kReleaseFd. With
+ * SetPrelaunchTable(), the next state of each config::PrelaunchItem is
+ * prelaunched automatically once its fromState is ready.
+ *
+ * With SetCgroupManager(), a state request first writes the resource
+ * limits of the new state to the cgroup of the function group, and every
+ * spawned process is moved into that cgroup right after posix_spawn
+ * (posix_spawn cannot start it there, so its exec runs in the parent's).
+ *
+ * With SetSupervisor(), processes that became ready are watched by a
+ * ProcessSupervisor on behalf of the owning StateMachine, and are
+ * unwatched again before a planned stop.
+ *
+ * In action lists, a SYNC waits at most its timeoutMs (and never past
+ * the list deadline, see ActionExecutor); processes not ready by then
+ * count as failed like on readyTimeout, and the list fails with
+ * kTransitionFailed. With CompensationMode::kFailedSegment the function
+ * groups of the failed segment are then requested back into their
+ * previous state before the list returns.
+ *
+ * In lists with dependencies, an action that depends on a
+ * SetFunctionGroupState starts as soon as that function group's
+ * processes are ready, while other function groups are still starting;
+ * each start is bounded by readyTimeout.
+ *
+ * SetFunctionGroupState actions for the state a function group is
+ * already in are elided (see ActionExecutor::GetElidedCount()). The
+ * state is recorded once its processes are ready: a request makes it
+ * unknown until then, so a repeated request within the segment is
+ * issued again, and a failed start or a terminated process leaves it
+ * unknown. RequestFunctionGroupState() itself always issues the request.
+ *
+ * Actions are handled by symbol ID (see ActionExecutor): the names of the
+ * process and prelaunch tables are interned once, and are only compared
+ * as strings again when the configuration changes.
+ *
+ * The other action types are executed by ActionExecutor. Only
+ * available on Linux (pidfd_open, 5.3+); elsewhere Open() fails.
+ */
+class LocalExecutionManager : public ActionExecutor {
+public:
+    using Result = ara::core::Result<void, StateManagementErrc>;
+
+    static constexpr int kReadyFd = 3;      ///< Readiness fd in the started process
+    static constexpr const char* kReadyFdEnv = "ARA_EM_READY_FD";
+    static constexpr int kReleaseFd = 4;    ///< Release fd in a prelaunched process
+    static constexpr const char* kReleaseFdEnv = "ARA_EM_RELEASE_FD";
+
+    /**
+     * @param processes Process table (must outlive this object)
+     * @param count Number of entries
+     * @param readyTimeout Time a started process has to become ready
+     * @param stopTimeout Time a stopped process has after SIGTERM before SIGKILL
+     */
+    LocalExecutionManager(const config::ProcessItem* processes, std::size_t count,
+                          std::chrono::milliseconds readyTimeout = std::chrono::milliseconds(5000),
+                          std::chrono::milliseconds stopTimeout = std::chrono::milliseconds(1000));
+    ~LocalExecutionManager() override;
+
+    LocalExecutionManager(const LocalExecutionManager&) = delete;
+    LocalExecutionManager& operator=(const LocalExecutionManager&) = delete;
+
+    /**
+     * @brief Create the epoll instance
+     *
+     * @return kOperationFailed if the host has no epoll/pidfd support
+     */
+    Result Open();
+
+    /**
+     * @brief Switch a function group to a state without waiting
+     *
+     * Stops (and reaps) the processes leaving the function group, then
+     * releases the prelaunched processes of the new state and spawns
+     * the other ones that are not running yet. Prelaunched processes of
+     * the function group that are not the next state of the new state
+     * are stopped.
+     *
+     * @param functionGroup Function Group name
+     * @param state Function Group state name
+     * @return kOperationFailed if not open or a process could not be spawned
+     */
+    Result RequestFunctionGroupState(const char* functionGroup, const char* state);
+
+    /**
+     * @brief Wait until every started process is ready, exited or timed out
+     *
+     * Appends one report per requested function group state.
+     *
+     * @return kTransitionFailed if a process failed or timed out
+     */
+    Result WaitReady();
+
+    /**
+     * @brief Start the processes of a function group state and park them
+     *
+     * Processes already running or parked in the function group are
+     * skipped. Does not wait for the processes to reach the park point.
+     *
+     * @param functionGroup Function Group name
+     * @param state Function Group state name
+     * @return kOperationFailed if not open or a process could not be spawned
+     */
+    Result Prelaunch(const char* functionGroup, const char* state);
+
+    /**
+     * @brief Prelaunch the next state whenever a fromState becomes ready
+     *
+     * @param table Prelaunch table (must outlive this object, nullptr: none)
+     * @param count Number of entries
+     */
+    void SetPrelaunchTable(const config::PrelaunchItem* table, std::size_t count);
+
+    /// Stop every parked process
+    void DropPrelaunched();
+
+    /// Stop every running and parked process (all function group states unknown)
+    void StopAll();
+
+    /// Reap terminated processes and take pending readiness (no wait)
+    void Reap();
+
+    /**
+     * @brief Report terminations of ready processes to an owner
+     *
+     * @param supervisor Supervisor to register processes with (nullptr: none)
+     * @param owner StateMachine that receives the error notifications
+     */
+    void SetSupervisor(ProcessSupervisor* supervisor, StateMachine* owner);
+
+    /**
+     * @brief Isolate function groups in cgroups
+     *
+     * @param cgroups Opened cgroup manager (nullptr: none)
+     */
+    void SetCgroupManager(CgroupManager* cgroups) { cgroups_ = cgroups; }
+
+    std::size_t GetRunningCount() const { return processes_.size(); }
+    std::size_t GetParkedCount() const { return parked_.size(); }
+    bool IsParked(const char* functionGroup, const char* name) const;
+    bool IsRunning(const char* functionGroup, const char* name) const;
+    /// Process ID, or -1 if not running
+    int GetPid(const char* functionGroup, const char* name) const;
+
+    const std::vector<FunctionGroupStartReport>& GetReports() const { return reports_; }
+    void ClearReports() { reports_.clear(); }
+
+    // IActionExecutor / IBatchActionExecutor
+    Result ExecuteAction(const config::ActionItem& action) override;
+    Result ExecuteActionBatch(const ActionBatch& batch) override;
+    Result ExecuteSegmentBarrier(uint32_t sleepMs, bool sync, uint32_t timeoutMs) override;
+
+protected:
+    /// End of an action list: wait for whatever is still starting
+    Result FinishList() override;
+    /// A SetFunctionGroupState is done once its processes are ready
+    bool IsActionDone(const PackedAction& action, const SymbolTable& symbols) override;
+    /// Wait until a function group start finishes, or until
+    Result WaitForActions(Clock::time_point until) override;
+    /// Intern the table names into the new copy, carry pending starts over
+    void OnSymbolsBound(const SymbolTable& previous) override;
+
+private:
+
+    struct Process {
+        const config::ProcessItem* item;
+        int pid;
+        int pidfd;
+        int readyFd;                        ///< Read end of the readiness pipe, -1 once closed
+        int releaseFd;                      ///< Write end of the release pipe while parked, else -1
+        std::size_t start;                  ///< Index into starts_ while starting
+        bool starting;
+        bool exited;
+    };
+
+    struct PendingStart {
+        SymbolId functionGroup;
+        SymbolId state;
+        Clock::time_point begin;
+        Clock::time_point end;
+        std::size_t processCount;
+        std::size_t waiting;
+        std::size_t failedCount;
+    };
+
+    Result WaitReady(Clock::time_point deadline);
+    Result WaitBarrier(uint32_t timeoutMs);
+    Result RequestFunctionGroupState(SymbolId functionGroup, SymbolId state);
+    Result IssueFunctionGroupState(SymbolId functionGroup, SymbolId state);
+    Result Prelaunch(SymbolId functionGroup, SymbolId state);
+    bool Spawn(const config::ProcessItem& item, std::size_t start, bool park);
+    bool Release(const config::ProcessItem& item, std::size_t start);
+    void PrelaunchNext(SymbolId functionGroup, SymbolId state);
+    SymbolId GetNextState(SymbolId functionGroup, SymbolId state) const;
+    void InternTables();
+    /// Index into table_ of a process's entry
+    std::size_t IndexOf(const Process& process) const
+    {
+        return static_cast<std::size_t>(process.item - table_);
+    }
+    bool IsRunning(std::size_t index) const;
+    bool IsParked(std::size_t index) const;
+    void Stop(std::vector<Process>& processes);
+    void HandleEvent(int fd);
+    void OnReady(Process& process, bool ok);
+    void ConfirmFunctionGroupState(SymbolId functionGroup);
+    void OnExit(Process& process);
+    void CloseFds(Process& process);
+    Process* FindByFd(int fd);
+
+    const config::ProcessItem* table_;
+    std::size_t tableCount_;
+    std::vector<SymbolId> itemGroups_;      ///< Per table_ entry, in GetSymbols()
+    std::vector<SymbolId> itemStates_;
+    std::vector<std::size_t> itemProcesses_; ///< First entry of the same function group and name
+    std::chrono::milliseconds readyTimeout_;
+    std::chrono::milliseconds stopTimeout_;
+
+    int epollFd_{-1};
+    std::vector<std::string> environment_;  ///< Own environment plus kReadyFdEnv
+    std::vector<char*> envp_;
+    std::vector<char*> parkEnvp_;           ///< envp_ plus kReleaseFdEnv
+    std::string releaseVar_;
+
+    const config::PrelaunchItem* prelaunchTable_{nullptr};
+    std::size_t prelaunchCount_{0U};
+    std::vector<SymbolId> prelaunchGroups_; ///< Per prelaunchTable_ entry, in GetSymbols()
+    std::vector<SymbolId> prelaunchFrom_;
+    std::vector<SymbolId> prelaunchNext_;
+
+    ProcessSupervisor* supervisor_{nullptr};
+    StateMachine* owner_{nullptr};
+    CgroupManager* cgroups_{nullptr};
+
+    std::vector<Process> processes_;
+    std::vector<Process> parked_;           ///< Prelaunched, waiting for release
+    std::vector<PendingStart> starts_;
+    std::vector<FunctionGroupStartReport> reports_;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_LOCAL_EXECUTION_MANAGER_H
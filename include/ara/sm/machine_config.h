@@ -0,0 +1,94 @@
+#ifndef ARA_SM_MACHINE_CONFIG_H
+#define ARA_SM_MACHINE_CONFIG_H
+
+#include <memory>
+#include <string>
+
+#include "result.h"
+#include "types.h"
+#include "state_machine.h"
+#include "config_snapshot.h"
+#include "config_publisher.h"
+
+namespace ara {
+namespace sm {
+
+class BinaryConfigImage;
+
+/**
+ * @brief Transition, recovery and action tables of one machine
+ *
+ * Passed to each StateMachine, so heterogeneous machines (e.g. several
+ * agents with different tables) each use their own pre-indexed tables.
+ * The StateMachine only follows its MachineConfig pointer; there is no
+ * category lookup on the request path.
+ *
+ * Every Load() validates and compiles a new ConfigSnapshot and
+ * publishes it: the first load configures the machine, later loads
+ * hot-reload it (see ConfigPublisher).
+ */
+class MachineConfig {
+public:
+    MachineConfig() = default;
+
+    MachineConfig(const MachineConfig&) = delete;
+    MachineConfig& operator=(const MachineConfig&) = delete;
+
+    /**
+     * @brief Load (or reload) from raw tables
+     *
+     * @param tables Table set (copied)
+     * @return kInvalidValue if the tables are inconsistent
+     */
+    ara::core::Result<void, StateManagementErrc> Load(const ConfigTables& tables);
+
+    /**
+     * @brief Load (or reload) from an opened binary image
+     *
+     * @param image Opened image (kept alive while its snapshot is in use)
+     * @return kInvalidValue if the image is closed or inconsistent
+     */
+    ara::core::Result<void, StateManagementErrc> Load(
+        std::shared_ptr<const BinaryConfigImage> image);
+
+    /**
+     * @brief Load (or reload) from a binary image file
+     *
+     * @param path Image file (see sm_config_compiler)
+     * @return kOperationFailed on I/O errors, kInvalidValue on format errors
+     */
+    ara::core::Result<void, StateManagementErrc> LoadFile(const std::string& path);
+
+    /**
+     * @brief Built-in configuration of a category (static_config tables)
+     *
+     * @param category Controller or Agent
+     * @return Shared default configuration
+     */
+    static MachineConfig& GetDefault(StateMachine::Category category);
+
+    /// Whether a table set has been published
+    bool IsLoaded() const { return loaded_; }
+
+    /// Enter a read section on the current tables (lock-free)
+    ConfigPublisher::ReadGuard Read() { return publisher_.Read(); }
+
+    ConfigPublisher& GetPublisher() { return publisher_; }
+
+private:
+    ara::core::Result<void, StateManagementErrc> Publish(
+        std::unique_ptr<ConfigSnapshot> snapshot);
+
+    /// Built-in tables, served from their generated perfect hashes
+    static MachineConfig* LoadBuiltIn(MachineConfig& config, const ConfigTables& tables,
+                                      const PerfectHashTable& transitionHash,
+                                      const PerfectHashTable& recoveryHash);
+
+    ConfigPublisher publisher_;
+    bool loaded_ = false;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_MACHINE_CONFIG_H
@@ -0,0 +1,215 @@
+#ifndef ARA_SM_NETWORK_MANAGEMENT_H
+#define ARA_SM_NETWORK_MANAGEMENT_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "result.h"
+#include "symbol_table.h"
+#include "types.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief Network Management stand-in daemon
+ *
+ * Serves NetworkHandle state requests on one end of a SOCK_SEQPACKET
+ * socket pair from its own thread. A request is one datagram with a
+ * "#<sequence>" line and then a "<handle> <FullCom|NoCom>" line per
+ * handle. It is answered with "OK #<sequence>" once every handle is set
+ * (or "ERR #<sequence>"), so each request is a full IPC round trip like
+ * a request to the real Network Management. The echoed sequence number
+ * lets a client tell a late reply from the reply to its next request.
+ *
+ * Only available on Linux; elsewhere Open() fails.
+ */
+class LocalNetworkManager {
+public:
+    using Result = ara::core::Result<void, StateManagementErrc>;
+
+    static constexpr std::size_t kMaxMessage = 4096;   ///< Max. request datagram
+
+    LocalNetworkManager() = default;
+    ~LocalNetworkManager();
+
+    LocalNetworkManager(const LocalNetworkManager&) = delete;
+    LocalNetworkManager& operator=(const LocalNetworkManager&) = delete;
+
+    /**
+     * @brief Create the socket pair and start serving
+     *
+     * @return kOperationFailed if the socket pair cannot be created
+     */
+    Result Open();
+
+    /// Stop serving and close both ends
+    void Close();
+
+    /// Client end of the socket pair (for NetworkManagementClient::Connect), -1 if closed
+    int GetClientFd() const { return clientFd_; }
+
+    /**
+     * @brief Current state of a handle
+     *
+     * @param handle NetworkHandle name
+     * @param state Set to the state if the handle was requested
+     * @return false if the handle was never requested
+     */
+    bool GetState(const std::string& handle, NmStateRequestEnum& state) const;
+
+    /**
+     * @brief Process each following request this much later (slow daemon)
+     *
+     * @param delay Wait before the handles are set and the reply is sent
+     */
+    void SetReplyDelay(std::chrono::milliseconds delay);
+
+    /// Requests (round trips) served
+    std::size_t GetRequestCount() const;
+    /// Handle state changes applied over all requests
+    std::size_t GetUpdateCount() const;
+
+private:
+    void Serve();
+
+    int serverFd_{-1};
+    int clientFd_{-1};
+    std::thread thread_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, NmStateRequestEnum> states_;
+    std::chrono::milliseconds replyDelay_{0};
+    std::size_t requestCount_{0U};
+    std::size_t updateCount_{0U};
+};
+
+/**
+ * @brief Cached, batched SetNetworkHandle requests
+ *
+ * Keeps the last requested NmStateRequestEnum per NetworkHandle, with
+ * handle names interned into dense IDs. Request() drops requests for
+ * the state a handle already has (or already has pending) and queues
+ * the others; Flush() sends everything queued as one request to the
+ * Network Management. ActionExecutor flushes at every SYNC/sleep and
+ * at the end of an action list, so the handle changes of one segment
+ * cost a single round trip. Callers that know their handles up front
+ * register them once and request by ID, without a lookup per request.
+ *
+ * The cache assumes this client is the only requester of its handles;
+ * Invalidate() forgets it. Not thread-safe: share one client between
+ * the StateMachines driven by one thread.
+ */
+class NetworkManagementClient {
+public:
+    using Result = ara::core::Result<void, StateManagementErrc>;
+
+    /**
+     * @param replyTimeout Max. wait for the answer to a request
+     */
+    explicit NetworkManagementClient(
+        std::chrono::milliseconds replyTimeout = std::chrono::milliseconds(1000));
+
+    NetworkManagementClient(const NetworkManagementClient&) = delete;
+    NetworkManagementClient& operator=(const NetworkManagementClient&) = delete;
+
+    /**
+     * @brief Use a connected Network Management socket
+     *
+     * @param fd SOCK_SEQPACKET socket (not owned)
+     */
+    void Connect(int fd) { fd_ = fd; }
+
+    /**
+     * @brief ID of a handle for the ID overloads (interned once)
+     *
+     * @param handle NetworkHandle name
+     * @return kNoSymbol for a null handle, or if no more handles fit
+     */
+    SymbolId RegisterHandle(const char* handle);
+
+    /**
+     * @brief Queue a handle state change
+     *
+     * @param handle NetworkHandle name
+     * @param state Requested state
+     * @return kInvalidValue for a null handle, or if no more handles fit
+     */
+    Result Request(const char* handle, NmStateRequestEnum state);
+
+    /**
+     * @brief Queue a handle state change
+     *
+     * @param handle ID from RegisterHandle()
+     * @param state Requested state
+     * @return kInvalidValue for an unregistered handle
+     */
+    Result Request(SymbolId handle, NmStateRequestEnum state);
+
+    /**
+     * @brief Send the queued changes as one request
+     *
+     * Nothing is sent if no queued change differs from the cache. On
+     * failure the affected handles are forgotten, so they are requested
+     * again next time. Replies to earlier requests that came in after
+     * their timeout are skipped by sequence number.
+     *
+     * @return kOperationFailed if not connected or the request failed
+     */
+    Result Flush();
+
+    /// Forget all known handle states (and drop the queue)
+    void Invalidate();
+
+    /**
+     * @brief State a handle has, or will have once the queue is flushed
+     *
+     * @param handle NetworkHandle name
+     * @param state Set to the queued, else the confirmed state
+     * @return false if the state is unknown
+     */
+    bool GetState(const char* handle, NmStateRequestEnum& state) const;
+    /// GetState() of a handle ID from RegisterHandle()
+    bool GetState(SymbolId handle, NmStateRequestEnum& state) const;
+
+    /**
+     * @brief State name of an action parameter
+     *
+     * @param name "FullCom" or "NoCom"
+     * @param state Set to the state
+     * @return false for any other name
+     */
+    static bool ParseState(const char* name, NmStateRequestEnum& state);
+
+    std::size_t GetPendingCount() const { return pending_.size(); }
+    std::size_t GetRequestCount() const { return requestCount_; }   ///< Request() calls
+    std::size_t GetSkippedCount() const { return skippedCount_; }   ///< Dropped as no-op
+    std::size_t GetRoundTripCount() const { return roundTrips_; }   ///< Requests sent
+
+private:
+    static constexpr int8_t kUnknown = -1;
+
+    std::chrono::milliseconds replyTimeout_;
+    int fd_{-1};
+    uint32_t sequence_{0U};             ///< Tag of the last request sent
+
+    SymbolTable handles_;
+    std::vector<int8_t> current_;       ///< By handle ID: confirmed state or kUnknown
+    std::vector<int8_t> queued_;        ///< By handle ID: queued state or kUnknown
+    std::vector<SymbolId> pending_;     ///< Handles with a queued state, in request order
+
+    std::size_t requestCount_{0U};
+    std::size_t skippedCount_{0U};
+    std::size_t roundTrips_{0U};
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_NETWORK_MANAGEMENT_H
@@ -0,0 +1,200 @@
+#ifndef ARA_SM_PERFECT_HASH_H
+#define ARA_SM_PERFECT_HASH_H
+
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "static_config.h"
+#include "compiled_rule_table.h"
+
+namespace ara {
+namespace sm {
+
+/// One resolved rule candidate (see CompiledRuleTable)
+struct PerfectHashCandidate {
+    uint8_t toState;
+    bool last;                          ///< Last candidate of its run
+    config::TransitionGuard guard;
+};
+
+/**
+ * @brief Minimal perfect hash over (state, key) pairs
+ *
+ * Hash-and-displace layout: a key is hashed with the table seed into a
+ * bucket, the bucket's displacement seed hashes it into one of exactly
+ * slotCount slots (one per key, no empty slots). The slot stores the
+ * packed key for verification and the first candidate of its run, so a
+ * lookup is two hashes and one compare regardless of how sparse the
+ * 32-bit key space is.
+ *
+ * Plain view over arrays; tables generated at build time (see
+ * tools/perfect_hash_gen.cpp) are constexpr, tables built at runtime are
+ * owned by PerfectHashData.
+ *
+ * @req [SWS_SM_00603-00607] StateMachine transition execution
+ * @req [SWS_SM_00601], [SWS_SM_CONSTR_00014] Error recovery incl. ANY rule
+ */
+struct PerfectHashTable {
+    /// Returned by Find() when no rule matches
+    static constexpr uint8_t kNoMatch = 0xFFU;
+
+    /// Returned by FindRun() for unknown keys
+    static constexpr uint16_t kNoRun = 0xFFFFU;
+
+    uint32_t seed;                          ///< Bucket hash seed
+    const uint32_t* displacements;          ///< bucket -> slot hash seed
+    uint32_t bucketCount;
+    const uint64_t* slotKeys;               ///< slot -> packed (state, key)
+    const uint16_t* slotRuns;               ///< slot -> first candidate
+    uint32_t slotCount;
+    const PerfectHashCandidate* candidates; ///< candidate runs
+    bool hasWildcard;
+    uint32_t wildcardKey;
+
+    /// Pack (state, key) into one 64-bit hash key
+    static constexpr uint64_t PackKey(uint8_t state, uint32_t key)
+    {
+        return (static_cast<uint64_t>(state) << 32U) | key;
+    }
+
+    /// 64-bit finalizer (splitmix64) folded to 32 bits
+    static constexpr uint32_t Hash(uint64_t packed, uint32_t seed)
+    {
+        uint64_t x = packed ^ (static_cast<uint64_t>(seed) * 0x9E3779B97F4A7C15ULL);
+        x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+        x ^= x >> 31U;
+        return static_cast<uint32_t>(x ^ (x >> 32U));
+    }
+
+    /**
+     * @brief Slot lookup
+     *
+     * @param packed Packed (state, key)
+     * @return First candidate index, or kNoRun
+     */
+    constexpr uint16_t FindRun(uint64_t packed) const
+    {
+        if (slotCount == 0U) {
+            return kNoRun;
+        }
+        const uint32_t bucket = Hash(packed, seed) % bucketCount;
+        const uint32_t slot = Hash(packed, displacements[bucket]) % slotCount;
+        return (slotKeys[slot] == packed) ? slotRuns[slot] : kNoRun;
+    }
+
+    /**
+     * @brief Look up target state
+     *
+     * Exact key first; if the state has no run for the key, its wildcard
+     * run (if any). Same resolution as CompiledRuleTable::Find().
+     *
+     * @param state Current state
+     * @param key Trigger or error code
+     * @param conditions Condition word for guard evaluation
+     * @return Target state, or kNoMatch
+     */
+    constexpr uint8_t Find(uint8_t state, uint32_t key,
+                           config::ConditionMask conditions = 0U) const
+    {
+        uint16_t index = FindRun(PackKey(state, key));
+        if (index == kNoRun && hasWildcard) {
+            index = FindRun(PackKey(state, wildcardKey));
+        }
+        if (index == kNoRun) {
+            return kNoMatch;
+        }
+
+        for (;;) {
+            const PerfectHashCandidate& candidate = candidates[index];
+            if (config::EvaluateGuard(candidate.guard, conditions)) {
+                return candidate.toState;
+            }
+            if (candidate.last) {
+                return kNoMatch;
+            }
+            index++;
+        }
+    }
+
+    /**
+     * @brief Enumerate stored exact-key candidates
+     *
+     * Same edges as CompiledRuleTable::GetEdges() (ordered by state, then
+     * key, then resolution order), read back from the slots. Wildcard
+     * runs are not listed.
+     *
+     * @return Edges
+     */
+    std::vector<CompiledRuleTable::Edge> GetEdges() const;
+};
+
+/**
+ * @brief Owning storage for a perfect hash built at runtime
+ *
+ * Used by the build-time generator and for tables that are not known
+ * at compile time.
+ */
+class PerfectHashData {
+public:
+    /// Seeds tried before giving up
+    static constexpr uint32_t kMaxSeeds = 64U;
+
+    /// Displacements tried per bucket before trying the next seed
+    static constexpr uint32_t kMaxDisplacements = 1U << 16U;
+
+    PerfectHashData() = default;
+
+    /**
+     * @brief Build from a compiled table (hierarchy already resolved)
+     *
+     * @param table Compiled transition or error recovery table
+     * @return Hash data (check IsValid())
+     */
+    static PerfectHashData FromRuleTable(const CompiledRuleTable& table);
+
+    /// False if no collision-free layout was found
+    bool IsValid() const { return valid_; }
+
+    /// View usable for lookups (valid while this object lives)
+    PerfectHashTable View() const;
+
+    /**
+     * @brief Write as constexpr C++ definitions (for code generators)
+     *
+     * Emits <name>Displacements, <name>SlotKeys, <name>SlotRuns,
+     * <name>Candidates and the PerfectHashTable <name>. The output must be
+     * placed inside namespace ara::sm (or a namespace nested in it).
+     *
+     * @param out Output stream
+     * @param name Identifier of the table
+     */
+    void Emit(std::ostream& out, const std::string& name) const;
+
+    uint32_t GetSeed() const { return seed_; }
+    const std::vector<uint32_t>& GetDisplacements() const { return displacements_; }
+    const std::vector<uint64_t>& GetSlotKeys() const { return slotKeys_; }
+    const std::vector<uint16_t>& GetSlotRuns() const { return slotRuns_; }
+    const std::vector<PerfectHashCandidate>& GetCandidates() const { return candidates_; }
+    bool HasWildcard() const { return hasWildcard_; }
+    uint32_t GetWildcardKey() const { return wildcardKey_; }
+
+private:
+    bool Place(const std::vector<uint64_t>& keys, uint32_t seed);
+
+    bool valid_ = false;
+    uint32_t seed_ = 0U;
+    std::vector<uint32_t> displacements_;
+    std::vector<uint64_t> slotKeys_;
+    std::vector<uint16_t> slotRuns_;
+    std::vector<PerfectHashCandidate> candidates_;
+    bool hasWildcard_ = false;
+    uint32_t wildcardKey_ = 0U;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_PERFECT_HASH_H
@@ -0,0 +1,146 @@
+#ifndef ARA_SM_PROCESS_SUPERVISOR_H
+#define ARA_SM_PROCESS_SUPERVISOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "result.h"
+#include "types.h"
+
+namespace ara {
+namespace sm {
+
+class StateMachine;
+
+/**
+ * @brief Event-driven crash detection for function group processes
+ *
+ * Every watched process has a pidfd in one epoll instance; the epoll
+ * data is the watch slot, so an exit is dispatched in O(1) no matter
+ * how many processes are watched, and nothing is polled.
+ *
+ * Dispatch() blocks until a watched process terminates, translates the
+ * termination into an ExecutionErrorType (see ClassifyExit()) and calls
+ * HandleErrorNotification() of the owning StateMachine. StateMachine is
+ * not thread-safe, so Dispatch() runs on the thread driving the SM;
+ * GetFd() can be added to an outer event loop instead of blocking.
+ *
+ * Exit status is read with WNOWAIT: the parent of the process (e.g.
+ * LocalExecutionManager) still reaps it, and passes the status on with
+ * SetExitStatus() if it gets there first. For processes that are not
+ * children of this process the status is unknown and kProcessCrashed
+ * is reported. Planned stops must Unwatch() before signalling.
+ *
+ * Only available on Linux (pidfd_open, 5.3+); elsewhere Open() fails.
+ *
+ * @req [SWS_SM_00601] Error notification reaction
+ */
+class ProcessSupervisor {
+public:
+    using Result = ara::core::Result<void, StateManagementErrc>;
+
+    ProcessSupervisor() = default;
+    ~ProcessSupervisor();
+
+    ProcessSupervisor(const ProcessSupervisor&) = delete;
+    ProcessSupervisor& operator=(const ProcessSupervisor&) = delete;
+
+    /**
+     * @brief Create the epoll instance
+     *
+     * @return kOperationFailed if the host has no epoll/pidfd support
+     */
+    Result Open();
+
+    /**
+     * @brief Start watching a running process
+     *
+     * @param pid Process ID
+     * @param functionGroup Function Group of the process (for logging)
+     * @param name Process name (for logging)
+     * @param owner StateMachine notified when the process terminates
+     * @return kOperationFailed if not open or the process is gone;
+     *         kInvalidValue if pid is already watched
+     */
+    Result Watch(int pid, const char* functionGroup, const char* name, StateMachine* owner);
+
+    /**
+     * @brief Stop watching (planned stop)
+     *
+     * @param pid Process ID
+     * @return false if pid was not watched
+     */
+    bool Unwatch(int pid);
+
+    /**
+     * @brief Exit status of a watched process, taken by its parent
+     *
+     * A parent that reaps the process before Dispatch() passes the
+     * status on here, so the exit is still classified exactly.
+     *
+     * @param pid Process ID
+     * @param code siginfo_t::si_code
+     * @param status siginfo_t::si_status
+     */
+    void SetExitStatus(int pid, int code, int status);
+
+    /**
+     * @brief Wait for terminations and notify the owners
+     *
+     * @param timeoutMs Max. wait, -1 to block, 0 to only take pending ones
+     * @return Number of notifications delivered
+     */
+    std::size_t Dispatch(int timeoutMs);
+
+    /// epoll fd, readable while a termination is pending
+    int GetFd() const { return epollFd_; }
+
+    std::size_t GetWatchCount() const { return slotByPid_.size(); }
+    bool IsWatched(int pid) const { return slotByPid_.count(pid) != 0U; }
+
+    /**
+     * @brief Execution error for a process termination
+     *
+     * Killed by SIGSEGV/SIGBUS -> kMemoryViolation; any other signal or
+     * exit (a supervised process is not expected to end) -> kProcessCrashed.
+     *
+     * @param code siginfo_t::si_code (CLD_EXITED, CLD_KILLED, CLD_DUMPED)
+     * @param status siginfo_t::si_status (exit status or signal)
+     * @return Execution error
+     */
+    static ExecutionErrorType ClassifyExit(int code, int status);
+
+    /**
+     * @brief pidfd_open(2)
+     *
+     * @param pid Process ID
+     * @return pidfd (close-on-exec), or -1
+     */
+    static int OpenPidfd(int pid);
+
+private:
+    struct WatchEntry {
+        int pid;
+        int pidfd;
+        const char* functionGroup;
+        const char* name;
+        StateMachine* owner;
+        bool exitKnown;                 ///< Set by SetExitStatus()
+        int exitCode;
+        int exitStatus;
+    };
+
+    void Release(uint32_t slot);
+
+    int epollFd_{-1};
+    std::vector<WatchEntry> watches_;
+    std::vector<uint32_t> freeSlots_;
+    std::unordered_map<int, uint32_t> slotByPid_;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_PROCESS_SUPERVISOR_H
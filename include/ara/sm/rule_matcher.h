@@ -0,0 +1,142 @@
+#ifndef ARA_SM_RULE_MATCHER_H
+#define ARA_SM_RULE_MATCHER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include "static_config.h"
+#include "compiled_rule_table.h"
+#include "vector_rule_table.h"
+#include "perfect_hash.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief Rule lookup with engine selected by table shape
+ *
+ * Small and medium tables use the dense CompiledRuleTable. When the
+ * state x key matrix would exceed kDenseCellLimit cells, or the rule
+ * count exceeds kDenseRuleLimit, the SIMD
+ * VectorRuleTable is used instead. Tables known at build time can be
+ * served from a generated PerfectHashTable (FromPerfectHash). All
+ * engines resolve rules identically.
+ */
+class RuleMatcher {
+public:
+    /// Lookup engine
+    enum class Engine : uint8_t {
+        kDense = 0,
+        kVector = 1,
+        kPerfectHash = 2
+    };
+
+    /// Largest dense matrix (states x keys) before switching to kVector
+    static constexpr std::size_t kDenseCellLimit = 32U * 1024U;
+
+    /// Largest rule count for the dense engine (the flattened hierarchy
+    /// copies a rule once per descendant, so the candidate array grows
+    /// faster than the rule count)
+    static constexpr std::size_t kDenseRuleLimit = 8U * 1024U;
+
+    RuleMatcher() = default;
+
+    /**
+     * @brief Build from a transition table
+     *
+     * @param rules Transition rules
+     * @param count Number of rules
+     * @param hierarchy State hierarchy (may be nullptr)
+     * @param hierarchyCount Number of hierarchy entries
+     * @return Matcher
+     */
+    static RuleMatcher FromTransitions(
+        const config::TransitionRule* rules,
+        std::size_t count,
+        const config::StateHierarchyRule* hierarchy,
+        std::size_t hierarchyCount);
+
+    /**
+     * @brief Build from an error recovery table
+     *
+     * @param rules Error recovery rules
+     * @param count Number of rules
+     * @param hierarchy State hierarchy (may be nullptr)
+     * @param hierarchyCount Number of hierarchy entries
+     * @return Matcher
+     */
+    static RuleMatcher FromErrorRecovery(
+        const config::ErrorRecoveryRule* rules,
+        std::size_t count,
+        const config::StateHierarchyRule* hierarchy,
+        std::size_t hierarchyCount);
+
+    /**
+     * @brief Serve lookups from a perfect hash table
+     *
+     * @param table Hash table (generated constexpr tables or a view of
+     *              PerfectHashData that outlives the matcher)
+     * @return Matcher
+     */
+    static RuleMatcher FromPerfectHash(const PerfectHashTable& table);
+
+    /**
+     * @brief Choose engine for a table shape
+     *
+     * @param stateCount Distinct states (rule owners and hierarchy)
+     * @param keyCount Distinct non-wildcard keys
+     * @param ruleCount Number of rules
+     * @return Engine
+     */
+    static Engine SelectEngine(std::size_t stateCount,
+                               std::size_t keyCount,
+                               std::size_t ruleCount);
+
+    /**
+     * @brief Look up target state
+     *
+     * @param state Current state
+     * @param key Trigger or error code
+     * @param conditions Condition word for guard evaluation
+     * @return Target state, or CompiledRuleTable::kNoMatch
+     */
+    uint8_t Find(uint8_t state, uint32_t key,
+                 config::ConditionMask conditions = 0U) const
+    {
+        switch (engine_) {
+            case Engine::kDense: return dense_->Find(state, key, conditions);
+            case Engine::kVector: return vector_->Find(state, key, conditions);
+            default: return hash_.Find(state, key, conditions);
+        }
+    }
+
+    /// Selected engine
+    Engine GetEngine() const { return engine_; }
+
+    /// Dense table, or nullptr when kDense was not selected
+    const CompiledRuleTable* GetDenseTable() const { return dense_.get(); }
+
+    /// Vector table, or nullptr when kVector was not selected
+    const VectorRuleTable* GetVectorTable() const { return vector_.get(); }
+
+    /**
+     * @brief Enumerate resolved exact-key candidates of the selected engine
+     *
+     * See CompiledRuleTable::GetEdges(); used to build planners and
+     * allowed-trigger sets without a second table.
+     *
+     * @return Edges ordered by state, then key, then resolution order
+     */
+    std::vector<CompiledRuleTable::Edge> GetEdges() const;
+
+private:
+    Engine engine_ = Engine::kDense;
+    std::shared_ptr<const CompiledRuleTable> dense_;
+    std::shared_ptr<const VectorRuleTable> vector_;
+    PerfectHashTable hash_{};
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_RULE_MATCHER_H
@@ -3,14 +3,19 @@
 
 #include <string>
 #include <cstdint>
+#include <cstddef>
 
 #include "types.h"
 #include "result.h"
 #include "i_action_executor.h"
+#include "compiled_rule_table.h"
 
 namespace ara {
 namespace sm {
 
+class ConfigSnapshot;
+class MachineConfig;
+
 class StateMachine {
 public:
     enum class State : uint8_t {
@@ -37,6 +42,20 @@ public:
                           Category category,
                           IActionExecutor* executor);
 
+    /**
+     * @brief Construct with its own table set
+     *
+     * @param name StateMachine name
+     * @param category Controller or Agent
+     * @param config Transition, recovery and action tables (must outlive
+     *               the StateMachine)
+     * @param executor Action executor (may be nullptr)
+     */
+    StateMachine(const std::string& name,
+                 Category category,
+                 MachineConfig& config,
+                 IActionExecutor* executor = nullptr);
+
     // Konstruktor uproszczony (bez ActionExecutor)
     explicit StateMachine(const std::string& name,
                           Category category)
@@ -51,6 +70,53 @@ public:
 
     ara::core::Result<void, StateManagementErrc> RequestTransition(TransitionRequestType request);
 
+    /// Longest trigger chain accepted by RequestTargetState()
+    static constexpr std::size_t kMaxTargetHops = 16U;
+
+    /**
+     * @brief Move to a target state over the shortest trigger chain
+     *
+     * The chain comes from the planner precomputed at config load. Every
+     * hop is checked against the current ConditionWord before the first
+     * one runs; the hops then execute back to back without returning to
+     * the caller in between.
+     *
+     * Hops are not rolled back: if the action list of a later hop fails,
+     * the machine stays in the last state it reached, which may be an
+     * intermediate state of the chain.
+     *
+     * @param targetState Target state (config::States value)
+     * @return Success, kTransitionNotAllowed if the target is not a valid
+     *         state ID or no (permitted) path exists, kTransitionFailed if
+     *         the action list of a hop failed
+     */
+    ara::core::Result<void, StateManagementErrc> RequestTargetState(uint32_t targetState);
+
+    /**
+     * @brief Triggers that have a rule in the current state
+     *
+     * Precomputed per state from the transition table; clients may cache
+     * it per state and filter locally. Guards are not evaluated, so a
+     * trigger in the set can still be rejected by its guard.
+     *
+     * The set refers to the current table snapshot. When tables may be
+     * reloaded concurrently, use it inside a read section of GetConfig().
+     *
+     * @return Allowed trigger set (see ConfigSnapshot::GetAllowedTriggers)
+     */
+    CompiledRuleTable::KeySet GetAllowedTriggers() const;
+
+    /**
+     * @brief Table set the StateMachine reads from
+     *
+     * MachineConfig::GetDefault(category) unless one was passed to the
+     * constructor. Every request reads one snapshot and finishes on it,
+     * even if the config is reloaded meanwhile.
+     *
+     * @return Machine configuration
+     */
+    MachineConfig& GetConfig() const;
+
     StateMachineStateNameType GetCurrentState() const;
     State GetCurrentStateEnum() const;
 
@@ -71,9 +137,11 @@ public:
     ara::core::Result<void, StateManagementErrc> PrepareRollback(const std::vector<std::string>& functionGroups);
 
 private:
-    void ExecuteActionList();
+    ara::core::Result<void, StateManagementErrc> ExecuteActionList(State state,
+                                                                   const ConfigSnapshot& config);
     ara::core::Result<void, StateManagementErrc> TransitionTo(State newState);
-    bool IsTransitionAllowed(TransitionRequestType request) const;
+    ara::core::Result<void, StateManagementErrc> TransitionTo(State newState,
+                                                              const ConfigSnapshot& config);
     static std::string StateToString(State state);
 
 private:
@@ -86,6 +154,7 @@ private:
     bool impactedByUpdate_;
 
     IActionExecutor* actionExecutor_;
+    MachineConfig* config_;
 };
 
 } // namespace sm
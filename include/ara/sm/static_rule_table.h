@@ -0,0 +1,408 @@
+#ifndef ARA_SM_STATIC_RULE_TABLE_H
+#define ARA_SM_STATIC_RULE_TABLE_H
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include "static_config.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief Rule source adapters for StaticRuleTable
+ *
+ * A source exposes a constexpr rule count, a normalized rule accessor and
+ * the wildcard key; Config is a table set type as described at
+ * StaticStateMachine.
+ */
+struct StaticRule {
+    uint32_t fromState;
+    uint32_t key;
+    uint32_t toState;
+    config::TransitionGuard guard;
+};
+
+template <typename Config>
+struct StaticTransitionSource {
+    using Tables = Config;
+    static constexpr std::size_t kCount = Config::kTransitionsCount;
+    static constexpr bool kHasWildcard = false;
+    static constexpr uint32_t kWildcardKey = 0U;
+
+    static constexpr StaticRule Get(std::size_t i)
+    {
+        return {Config::kTransitions[i].fromState, Config::kTransitions[i].trigger,
+                Config::kTransitions[i].toState, Config::kTransitions[i].guard};
+    }
+};
+
+template <typename Config>
+struct StaticRecoverySource {
+    using Tables = Config;
+    static constexpr std::size_t kCount = Config::kErrorRecoveryCount;
+    static constexpr bool kHasWildcard = true;
+    static constexpr uint32_t kWildcardKey = config::kExecutionErrorAny;
+
+    static constexpr StaticRule Get(std::size_t i)
+    {
+        return {Config::kErrorRecovery[i].fromState, Config::kErrorRecovery[i].errorCode,
+                Config::kErrorRecovery[i].toState, {0U, 0U}};
+    }
+};
+
+/**
+ * @brief CompiledRuleTable built entirely at compile time
+ *
+ * Same resolution rules as CompiledRuleTable (own rules before inherited
+ * ones, exact key before the level's wildcard, guarded candidate runs),
+ * but every array is a constexpr member sized from the table itself.
+ * A lookup is a state row load, a key column load (direct index for
+ * keys below kDirectKeyLimit) and one cell load; tables without guards
+ * skip the candidate loop entirely.
+ *
+ * Flattening runs in the constant evaluator, so it is meant for small,
+ * fixed configurations (tens to a few hundred rules).
+ */
+template <typename Source>
+class StaticRuleTable {
+public:
+    static constexpr uint8_t kNoMatch = 0xFFU;
+    static constexpr std::size_t kMaxHierarchyDepth = 16U;
+    static constexpr uint32_t kDirectKeyLimit = 1024U;
+
+private:
+    using Tables = typename Source::Tables;
+    static constexpr uint16_t kNoCandidate = 0xFFFFU;
+
+    struct Candidate {
+        uint8_t toState;
+        bool last;
+        config::TransitionGuard guard;
+    };
+
+    static constexpr bool IsWildcard(uint32_t key)
+    {
+        return Source::kHasWildcard && key == Source::kWildcardKey;
+    }
+
+    // ------------------------------------------------------------------
+    // Hierarchy (first entry for a child wins, as in CompiledRuleTable)
+    // ------------------------------------------------------------------
+
+    static constexpr std::array<uint8_t, 256> BuildParents()
+    {
+        std::array<uint8_t, 256> parent{};
+        for (auto& entry : parent) {
+            entry = kNoMatch;
+        }
+        for (std::size_t i = 0; i < Tables::kStateHierarchyCount; i++) {
+            const auto child = static_cast<uint8_t>(Tables::kStateHierarchy[i].state);
+            if (parent[child] == kNoMatch) {
+                parent[child] = static_cast<uint8_t>(Tables::kStateHierarchy[i].parentState);
+            }
+        }
+        return parent;
+    }
+
+    static constexpr std::array<uint8_t, 256> kParent = BuildParents();
+
+    // ------------------------------------------------------------------
+    // Rows: every state that owns rules or takes part in the hierarchy
+    // ------------------------------------------------------------------
+
+    struct Rows {
+        std::array<uint8_t, 256> stateRow{};    ///< state -> row + 1
+        std::array<uint8_t, 256> rowState{};
+        std::size_t count = 0U;
+
+        constexpr void Add(uint32_t state)
+        {
+            const auto id = static_cast<uint8_t>(state);
+            if (stateRow[id] == 0U) {
+                rowState[count] = id;
+                stateRow[id] = static_cast<uint8_t>(++count);
+            }
+        }
+    };
+
+    static constexpr Rows BuildRows()
+    {
+        Rows rows;
+        for (std::size_t i = 0; i < Source::kCount; i++) {
+            rows.Add(Source::Get(i).fromState);
+        }
+        for (std::size_t i = 0; i < Tables::kStateHierarchyCount; i++) {
+            rows.Add(Tables::kStateHierarchy[i].state);
+            rows.Add(Tables::kStateHierarchy[i].parentState);
+        }
+        return rows;
+    }
+
+    static constexpr Rows kRowMap = BuildRows();
+
+    // ------------------------------------------------------------------
+    // Columns: distinct non-wildcard keys, sorted
+    // ------------------------------------------------------------------
+
+    static constexpr std::size_t CountKeys()
+    {
+        std::size_t count = 0U;
+        for (std::size_t i = 0; i < Source::kCount; i++) {
+            const uint32_t key = Source::Get(i).key;
+            bool seen = IsWildcard(key);
+            for (std::size_t j = 0; j < i && !seen; j++) {
+                seen = (Source::Get(j).key == key);
+            }
+            count += seen ? 0U : 1U;
+        }
+        return count;
+    }
+
+public:
+    static constexpr std::size_t kRowCount = kRowMap.count;
+    static constexpr std::size_t kKeyCount = CountKeys();
+
+private:
+    static constexpr std::size_t kKeySlots = kKeyCount > 0U ? kKeyCount : 1U;
+    static constexpr std::size_t kRowSlots = kRowCount > 0U ? kRowCount : 1U;
+
+    static constexpr std::array<uint32_t, kKeySlots> BuildKeys()
+    {
+        std::array<uint32_t, kKeySlots> keys{};
+        std::size_t count = 0U;
+        for (std::size_t i = 0; i < Source::kCount; i++) {
+            const uint32_t key = Source::Get(i).key;
+            bool seen = IsWildcard(key);
+            for (std::size_t j = 0; j < count && !seen; j++) {
+                seen = (keys[j] == key);
+            }
+            if (!seen) {
+                // Insertion sort keeps the column order of CompiledRuleTable
+                std::size_t pos = count++;
+                while (pos > 0U && keys[pos - 1U] > key) {
+                    keys[pos] = keys[pos - 1U];
+                    pos--;
+                }
+                keys[pos] = key;
+            }
+        }
+        return keys;
+    }
+
+    static constexpr std::array<uint32_t, kKeySlots> kKeys = BuildKeys();
+
+    static constexpr bool kDirectKeys =
+        kKeyCount > 0U && kKeys[kKeyCount - 1U] < kDirectKeyLimit;
+    static constexpr std::size_t kKeyColumnSlots = kDirectKeys ? kKeys[kKeyCount - 1U] + 1U : 1U;
+
+    static constexpr std::array<int16_t, kKeyColumnSlots> BuildKeyColumns()
+    {
+        std::array<int16_t, kKeyColumnSlots> columns{};
+        for (auto& column : columns) {
+            column = -1;
+        }
+        if (kDirectKeys) {
+            for (std::size_t i = 0; i < kKeyCount; i++) {
+                columns[kKeys[i]] = static_cast<int16_t>(i);
+            }
+        }
+        return columns;
+    }
+
+    static constexpr std::array<int16_t, kKeyColumnSlots> kKeyColumn = BuildKeyColumns();
+
+    // ------------------------------------------------------------------
+    // Candidate runs (first pass counts, second pass emits)
+    // ------------------------------------------------------------------
+
+    template <std::size_t N>
+    struct Layout {
+        std::array<uint16_t, kRowSlots * kKeySlots> cells{};
+        std::array<uint16_t, kRowSlots> catchAll{};
+        std::array<Candidate, N> candidates{};
+        std::size_t candidateCount = 0U;
+        bool guarded = false;
+        bool cyclic = false;
+
+        constexpr void Append(const Candidate& candidate)
+        {
+            if (candidateCount < N) {
+                candidates[candidateCount] = candidate;
+            }
+            candidateCount++;
+            if (candidate.guard.allOf != 0U || candidate.guard.noneOf != 0U) {
+                guarded = true;
+            }
+        }
+
+        constexpr uint16_t Close(std::size_t first)
+        {
+            if (first == candidateCount) {
+                return kNoCandidate;
+            }
+            if (candidateCount - 1U < N) {
+                candidates[candidateCount - 1U].last = true;
+            }
+            return static_cast<uint16_t>(first);
+        }
+    };
+
+    template <std::size_t N>
+    static constexpr Layout<N> Flatten()
+    {
+        Layout<N> layout;
+
+        for (std::size_t row = 0; row < kRowCount; row++) {
+            // Exact keys: own rules, then each ancestor; a level's wildcard ends the search
+            for (std::size_t column = 0; column < kKeyCount; column++) {
+                const std::size_t first = layout.candidateCount;
+                uint8_t level = kRowMap.rowState[row];
+                std::size_t depth = 0U;
+                bool closed = false;
+
+                while (!closed && level != kNoMatch && depth < kMaxHierarchyDepth) {
+                    const StaticRule* any = nullptr;
+                    StaticRule wildcard{};
+
+                    for (std::size_t i = 0; i < Source::kCount && !closed; i++) {
+                        const StaticRule rule = Source::Get(i);
+                        if (static_cast<uint8_t>(rule.fromState) != level) {
+                            continue;
+                        }
+                        if (IsWildcard(rule.key)) {
+                            wildcard = rule;        // Last one of the level wins
+                            any = &wildcard;
+                            continue;
+                        }
+                        if (rule.key == kKeys[column]) {
+                            layout.Append({static_cast<uint8_t>(rule.toState), false, rule.guard});
+                            closed = (rule.guard.allOf == 0U && rule.guard.noneOf == 0U);
+                        }
+                    }
+
+                    if (!closed && any != nullptr) {
+                        layout.Append({static_cast<uint8_t>(any->toState), false, {0U, 0U}});
+                        closed = true;
+                    }
+
+                    level = kParent[level];
+                    depth++;
+                }
+                layout.cyclic = layout.cyclic || depth == kMaxHierarchyDepth;
+                layout.cells[row * kKeySlots + column] = layout.Close(first);
+            }
+
+            // Unknown keys: nearest wildcard (the last one of its level)
+            const std::size_t first = layout.candidateCount;
+            uint8_t level = kRowMap.rowState[row];
+            for (std::size_t depth = 0U;
+                 level != kNoMatch && depth < kMaxHierarchyDepth && first == layout.candidateCount;
+                 depth++) {
+                for (std::size_t i = Source::kCount; i-- > 0U;) {
+                    const StaticRule rule = Source::Get(i);
+                    if (static_cast<uint8_t>(rule.fromState) == level && IsWildcard(rule.key)) {
+                        layout.Append({static_cast<uint8_t>(rule.toState), false, {0U, 0U}});
+                        break;
+                    }
+                }
+                level = kParent[level];
+            }
+            layout.catchAll[row] = layout.Close(first);
+        }
+
+        return layout;
+    }
+
+    static constexpr Layout<1U> kSizing = Flatten<1U>();
+
+public:
+    /// Total candidates over all cells
+    static constexpr std::size_t kCandidateCount = kSizing.candidateCount;
+
+    /// Whether any candidate carries a guard
+    static constexpr bool kGuarded = kSizing.guarded;
+
+    /// Whether an ancestor chain hit kMaxHierarchyDepth (cycle)
+    static constexpr bool kHierarchyTruncated = kSizing.cyclic;
+
+private:
+    static constexpr Layout<(kCandidateCount > 0U ? kCandidateCount : 1U)> kLayout =
+        Flatten<(kCandidateCount > 0U ? kCandidateCount : 1U)>();
+
+    static constexpr int Column(uint32_t key)
+    {
+        if (kDirectKeys) {
+            return key < kKeyColumnSlots ? kKeyColumn[key] : -1;
+        }
+        std::size_t low = 0U;
+        std::size_t high = kKeyCount;
+        while (low < high) {
+            const std::size_t mid = (low + high) / 2U;
+            if (kKeys[mid] < key) {
+                low = mid + 1U;
+            } else {
+                high = mid;
+            }
+        }
+        return (low < kKeyCount && kKeys[low] == key) ? static_cast<int>(low) : -1;
+    }
+
+public:
+    /**
+     * @brief Look up target state (usable in constant expressions)
+     *
+     * @param state Current state
+     * @param key Trigger or error code
+     * @param conditions Condition word for guard evaluation
+     * @return Target state, or kNoMatch
+     */
+    static constexpr uint8_t Find(uint8_t state, uint32_t key,
+                                  config::ConditionMask conditions = 0U)
+    {
+        const uint8_t row = kRowMap.stateRow[state];
+        if (row == 0U) {
+            return kNoMatch;
+        }
+
+        const int column = Column(key);
+        std::size_t index = (column < 0)
+            ? kLayout.catchAll[row - 1U]
+            : kLayout.cells[(row - 1U) * kKeySlots + static_cast<std::size_t>(column)];
+
+        if (index == kNoCandidate) {
+            return kNoMatch;
+        }
+        if (!kGuarded) {
+            return kLayout.candidates[index].toState;
+        }
+
+        for (;;) {
+            const Candidate& candidate = kLayout.candidates[index];
+            if (config::EvaluateGuard(candidate.guard, conditions)) {
+                return candidate.toState;
+            }
+            if (candidate.last) {
+                return kNoMatch;
+            }
+            index++;
+        }
+    }
+
+    /**
+     * @brief Whether a state has a rule for a key (guards not evaluated)
+     */
+    static constexpr bool HasKey(uint8_t state, uint32_t key)
+    {
+        const uint8_t row = kRowMap.stateRow[state];
+        const int column = Column(key);
+        return row != 0U && column >= 0 &&
+               kLayout.cells[(row - 1U) * kKeySlots + static_cast<std::size_t>(column)] !=
+                   kNoCandidate;
+    }
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_STATIC_RULE_TABLE_H
@@ -0,0 +1,209 @@
+#ifndef ARA_SM_STATIC_STATE_MACHINE_H
+#define ARA_SM_STATIC_STATE_MACHINE_H
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+#include "types.h"
+#include "result.h"
+#include "static_config.h"
+#include "i_action_executor.h"
+#include "condition_word.h"
+#include "config_validator.h"
+#include "static_rule_table.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief StateMachine specialized at compile time for one fixed config
+ *
+ * Config is a table set type with static constexpr members
+ *
+ *     kTransitions / kTransitionsCount           (config::TransitionRule)
+ *     kErrorRecovery / kErrorRecoveryCount       (config::ErrorRecoveryRule)
+ *     kStateHierarchy / kStateHierarchyCount     (config::StateHierarchyRule)
+ *     kActionTable / kActionTableCount           (config::ActionListEntry)
+ *
+ * as emitted by sm_config_compiler (generated::<machine>::Tables). The
+ * tables are checked by ConfigValidator and flattened by the compiler
+ * into StaticRuleTable jump tables; a lookup never scans or hashes.
+ *
+ * Same request semantics and Result API as the dynamic StateMachine
+ * (update and recovery blocking, guards against ConditionWord, action
+ * list executed on each transition), but states are config state IDs,
+ * nothing is logged and nothing is allocated.
+ */
+template <typename Config>
+class StaticStateMachine {
+public:
+    using TransitionTable = StaticRuleTable<StaticTransitionSource<Config>>;
+    using RecoveryTable = StaticRuleTable<StaticRecoverySource<Config>>;
+
+    static constexpr uint8_t kNoMatch = TransitionTable::kNoMatch;
+
+private:
+    using Validator = ConfigValidator<Config>;
+
+    static_assert(Config::kTransitionsCount > 0U, "StaticStateMachine: empty transition table");
+    static_assert(Validator::StatesInRange(), "StaticStateMachine: state ID out of range (0..254)");
+    static_assert(Validator::TransitionKeysUnique(), "StaticStateMachine: shadowed transition rule");
+    static_assert(Validator::RecoveryKeysUnique(), "StaticStateMachine: duplicate recovery rule");
+    static_assert(Validator::HierarchyWellFormed(),
+                  "StaticStateMachine: state hierarchy cyclic or too deep");
+    static_assert(Validator::ActionListsWellFormed(), "StaticStateMachine: malformed action table");
+    static_assert(Validator::NoDanglingStates(), "StaticStateMachine: dangling target state");
+    static_assert(TransitionTable::kCandidateCount < 0xFFFFU &&
+                  RecoveryTable::kCandidateCount < 0xFFFFU,
+                  "StaticStateMachine: table too large for 16-bit candidate index");
+
+    static constexpr std::array<uint8_t, 256> BuildActionIndex()
+    {
+        std::array<uint8_t, 256> index{};
+        for (std::size_t i = 0; i < Config::kActionTableCount; i++) {
+            index[static_cast<uint8_t>(Config::kActionTable[i].state)] =
+                static_cast<uint8_t>(i + 1U);
+        }
+        return index;
+    }
+
+    static_assert(Config::kActionTableCount < 0xFFU, "StaticStateMachine: too many action lists");
+
+    static constexpr std::array<uint8_t, 256> kActionIndex = BuildActionIndex();
+
+public:
+    /**
+     * @brief Construct in a start state
+     *
+     * @param executor Action executor (may be nullptr)
+     * @param initialState Config state ID
+     */
+    explicit StaticStateMachine(IActionExecutor* executor = nullptr,
+                                uint8_t initialState = 0U)
+        : currentState_(initialState)
+        , actionExecutor_(executor)
+    {}
+
+    /// Transition target (constant expression for constant inputs)
+    static constexpr uint8_t FindTransition(uint8_t state, TransitionRequestType trigger,
+                                            config::ConditionMask conditions = 0U)
+    {
+        return TransitionTable::Find(state, trigger, conditions);
+    }
+
+    /// Recovery target (constant expression for constant inputs)
+    static constexpr uint8_t FindRecovery(uint8_t state, ExecutionErrorType error)
+    {
+        return RecoveryTable::Find(state, error);
+    }
+
+    /// Action list of a state, or nullptr
+    static constexpr const config::ActionListEntry* FindActionList(uint8_t state)
+    {
+        return kActionIndex[state] == 0U ? nullptr
+                                         : &Config::kActionTable[kActionIndex[state] - 1U];
+    }
+
+    /// Whether a trigger has a rule in a state (guards not evaluated)
+    static constexpr bool IsTriggerAllowed(uint8_t state, TransitionRequestType trigger)
+    {
+        return TransitionTable::HasKey(state, trigger);
+    }
+
+    ara::core::Result<void, StateManagementErrc> Start(uint8_t targetState)
+    {
+        isRunning_ = true;
+        return TransitionTo(targetState);
+    }
+
+    ara::core::Result<void, StateManagementErrc> Stop(uint8_t offState)
+    {
+        if (!isRunning_) {
+            return ara::core::Result<void, StateManagementErrc>();
+        }
+        auto r = TransitionTo(offState);
+        if (r.HasValue()) {
+            isRunning_ = false;
+        }
+        return r;
+    }
+
+    ara::core::Result<void, StateManagementErrc> RequestTransition(TransitionRequestType request)
+    {
+        if (impactedByUpdate_) {
+            return ara::core::Result<void, StateManagementErrc>(
+                StateManagementErrc::kUpdateInProgress);
+        }
+        if (errorRecoveryOngoing_) {
+            return ara::core::Result<void, StateManagementErrc>(
+                StateManagementErrc::kRecoveryTransitionOngoing);
+        }
+
+        const uint8_t next = FindTransition(currentState_, request, ConditionWord::Get());
+        if (next == kNoMatch) {
+            return ara::core::Result<void, StateManagementErrc>(
+                StateManagementErrc::kTransitionNotAllowed);
+        }
+
+        return TransitionTo(next);
+    }
+
+    /**
+     * @brief React to an execution error
+     *
+     * @param executionError Error code
+     * @param fallbackState State for non-mapped errors [SWS_SM_CONSTR_00014]
+     */
+    void HandleErrorNotification(ExecutionErrorType executionError, uint8_t fallbackState)
+    {
+        if (impactedByUpdate_) {
+            return;
+        }
+
+        errorRecoveryOngoing_ = true;
+        const uint8_t recovery = FindRecovery(currentState_, executionError);
+        TransitionTo(recovery != kNoMatch ? recovery : fallbackState);
+        errorRecoveryOngoing_ = false;
+    }
+
+    void SetImpactedByUpdate(bool impacted) { impactedByUpdate_ = impacted; }
+    bool IsImpactedByUpdate() const { return impactedByUpdate_; }
+
+    uint8_t GetCurrentState() const { return currentState_; }
+    bool IsInTransition() const { return isInTransition_; }
+    bool IsRunning() const { return isRunning_; }
+
+private:
+    ara::core::Result<void, StateManagementErrc> TransitionTo(uint8_t newState)
+    {
+        isInTransition_ = true;
+
+        // The target state's action list decides the transition; if it
+        // fails, the current state stays in place
+        const config::ActionListEntry* entry = FindActionList(newState);
+        if (entry != nullptr && actionExecutor_ != nullptr &&
+            !actionExecutor_->ExecuteActionList(entry->actions, entry->actionCount,
+                                                entry->timeoutMs).HasValue()) {
+            isInTransition_ = false;
+            return ara::core::Result<void, StateManagementErrc>(
+                StateManagementErrc::kTransitionFailed);
+        }
+
+        currentState_ = newState;
+        isInTransition_ = false;
+        return ara::core::Result<void, StateManagementErrc>();
+    }
+
+    uint8_t currentState_;
+    bool isRunning_ = false;
+    bool isInTransition_ = false;
+    bool errorRecoveryOngoing_ = false;
+    bool impactedByUpdate_ = false;
+    IActionExecutor* actionExecutor_;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_STATIC_STATE_MACHINE_H
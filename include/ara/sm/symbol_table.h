@@ -0,0 +1,111 @@
+#ifndef ARA_SM_SYMBOL_TABLE_H
+#define ARA_SM_SYMBOL_TABLE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "static_config.h"
+
+namespace ara {
+namespace sm {
+
+/// Dense symbol ID, unique per SymbolKind within one SymbolTable
+using SymbolId = uint16_t;
+
+/// No symbol (nullptr or empty name, or action without target/param)
+constexpr SymbolId kNoSymbol = 0xFFFFU;
+
+/**
+ * @brief Name spaces of action item strings
+ *
+ * Every kind is numbered from 0 on its own, so an executor can keep
+ * per-target state in an array of GetCount(kind) entries.
+ */
+enum class SymbolKind : uint8_t {
+    kFunctionGroup = 0,         ///< SetFunctionGroupState target
+    kFunctionGroupState,        ///< SetFunctionGroupState param
+    kStateMachine,              ///< Start/StopStateMachine target
+    kStateMachineState,         ///< StartStateMachine param (initial state)
+    kNetworkHandle,             ///< SetNetworkHandle target
+    kNetworkState,              ///< SetNetworkHandle param
+    kCount
+};
+
+/**
+ * @brief Interned action names
+ *
+ * Names are interned once when a configuration is loaded; afterwards
+ * the table is only read, which is safe from any number of threads.
+ * GetName() is an array index, so the action path never compares or
+ * hashes a string.
+ */
+class SymbolTable {
+public:
+    static constexpr std::size_t kKindCount = static_cast<std::size_t>(SymbolKind::kCount);
+
+    SymbolTable() = default;
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    /**
+     * @brief Intern a name
+     *
+     * @param kind Name space
+     * @param name Name (nullptr and "" map to kNoSymbol)
+     * @return Existing or new ID; kNoSymbol if the kind is full
+     */
+    SymbolId Intern(SymbolKind kind, const char* name);
+
+    /**
+     * @brief Look up a name without interning it
+     *
+     * @return ID, or kNoSymbol if the name is unknown
+     */
+    SymbolId Find(SymbolKind kind, const char* name) const;
+
+    /// Name of an ID, or nullptr for kNoSymbol and unknown IDs
+    const char* GetName(SymbolKind kind, SymbolId id) const
+    {
+        const auto& names = names_[static_cast<std::size_t>(kind)];
+        return id < names.size() ? names[id] : nullptr;
+    }
+
+    /// Number of IDs in a kind (IDs are 0..count-1)
+    std::size_t GetCount(SymbolKind kind) const
+    {
+        return names_[static_cast<std::size_t>(kind)].size();
+    }
+
+    /**
+     * @brief Version of the table contents
+     *
+     * Changes whenever a name is added and is unique across all tables,
+     * so a copy of the names can tell whether it still matches.
+     */
+    uint64_t GetGeneration() const { return generation_; }
+
+    /// Name space of the target of an action type (kCount if it has none)
+    static SymbolKind TargetKind(config::ActionType type);
+
+    /// Name space of the param of an action type (kCount if it has none)
+    static SymbolKind ParamKind(config::ActionType type);
+
+private:
+    static uint64_t NextGeneration();
+
+    uint64_t generation_{NextGeneration()};
+    std::deque<std::string> strings_;   ///< Stable storage for the names
+    std::vector<const char*> names_[kKindCount];
+    std::unordered_map<std::string_view, SymbolId> index_[kKindCount];
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_SYMBOL_TABLE_H
@@ -0,0 +1,87 @@
+#ifndef ARA_SM_TRANSITION_PLANNER_H
+#define ARA_SM_TRANSITION_PLANNER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "types.h"
+#include "compiled_rule_table.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief All-pairs shortest trigger paths over a compiled transition table
+ *
+ * Built once per table (BFS from every state, edges taken in table
+ * order). For every (from, to) pair it stores the first hop and the hop
+ * count, so a complete trigger chain is read out in O(path length)
+ * without searching at request time.
+ *
+ * Guards are ignored while planning; the caller checks each hop against
+ * the current ConditionWord before executing the path.
+ */
+class TransitionPlanner {
+public:
+    /// Distance of unreachable pairs
+    static constexpr uint8_t kUnreachable = 0xFFU;
+
+    TransitionPlanner() = default;
+
+    /**
+     * @brief Precompute shortest paths
+     *
+     * @param table Compiled transition table
+     * @return Planner
+     */
+    static TransitionPlanner Build(const CompiledRuleTable& table);
+
+    /**
+     * @brief Precompute shortest paths from an edge list
+     *
+     * @param edges Resolved candidates, e.g. VectorRuleTable::GetEdges()
+     * @return Planner
+     */
+    static TransitionPlanner Build(const std::vector<CompiledRuleTable::Edge>& edges);
+
+    /**
+     * @brief Number of hops from one state to another
+     *
+     * @param fromState Start state
+     * @param toState Target state
+     * @return Hop count (0 if equal), or kUnreachable
+     */
+    uint8_t GetDistance(uint8_t fromState, uint8_t toState) const;
+
+    /**
+     * @brief Read out shortest trigger chain
+     *
+     * @param fromState Start state
+     * @param toState Target state
+     * @param triggers Output array for the trigger of each hop
+     * @param maxHops Capacity of triggers
+     * @return Number of hops written (0 if unreachable, equal or too long)
+     */
+    std::size_t Plan(uint8_t fromState,
+                     uint8_t toState,
+                     TransitionRequestType* triggers,
+                     std::size_t maxHops) const;
+
+private:
+    struct Hop {
+        TransitionRequestType trigger;  ///< Trigger of the first hop
+        uint8_t nextState;              ///< State after the first hop
+        uint8_t distance;               ///< Total hop count
+    };
+
+    int Index(uint8_t state) const;
+
+    uint8_t stateIndex_[256] = {};      ///< state -> index + 1 (0 = unknown)
+    std::vector<uint8_t> states_;       ///< index -> state
+    std::vector<Hop> hops_;             ///< from x to first hops
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_TRANSITION_PLANNER_H
@@ -4,15 +4,30 @@
 #include "types.h"
 #include "state_machine.h"
 #include "static_config.h"
+#include "compiled_rule_table.h"
+#include "rule_matcher.h"
 
 namespace ara {
 namespace sm {
 
+/**
+ * @brief TransitionRequestTable lookup
+ *
+ * Rules and state hierarchy from static_config are flattened at build
+ * time into a generated perfect hash (tools/perfect_hash_gen); inherited
+ * transitions cost the same as direct ones. Guarded rules are evaluated
+ * against the shared ConditionWord. The planner and allowed-trigger sets
+ * of the static tables live in MachineConfig::GetDefault()'s snapshot,
+ * which is served from the same generated hash.
+ */
 class TransitionTable {
 public:
     /**
      * @brief Check if transition is allowed
      * 
+     * A rule whose guard does not hold for the current ConditionWord
+     * does not allow the transition.
+     * 
      * @param currentState Current StateMachine state
      * @param request Transition request value
      * @param category Controller or Agent
@@ -38,6 +53,16 @@ public:
         uint8_t currentState,
         TransitionRequestType request,
         StateMachine::Category category);
+
+    /**
+     * @brief Get lookup engine for a category
+     *
+     * @param category Controller or Agent
+     * @return Matcher (engine selected by table shape)
+     */
+    static const RuleMatcher& GetMatcher(
+        StateMachine::Category category);
+
 };
 
 } // namespace sm
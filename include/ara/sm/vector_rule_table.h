@@ -0,0 +1,152 @@
+#ifndef ARA_SM_VECTOR_RULE_TABLE_H
+#define ARA_SM_VECTOR_RULE_TABLE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "static_config.h"
+#include "compiled_rule_table.h"
+
+namespace ara {
+namespace sm {
+
+/**
+ * @brief Structure-of-arrays rule table with SIMD key matching
+ *
+ * Intended for very large, sparse tables where a dense state x key
+ * matrix (CompiledRuleTable) would be too big. Rules are grouped by
+ * fromState (stable, configuration order kept) and stored as separate
+ * key / toState / guard arrays; a state's rules are one contiguous range,
+ * which is scanned for the key 8 lanes at a time with AVX2 when the CPU
+ * supports it, otherwise with a scalar loop.
+ *
+ * Resolution order is the same as CompiledRuleTable, but the hierarchy
+ * is walked at lookup time instead of being flattened.
+ *
+ * @req [SWS_SM_00603-00607] StateMachine transition execution
+ * @req [SWS_SM_00601], [SWS_SM_CONSTR_00014] Error recovery incl. ANY rule
+ */
+class VectorRuleTable {
+public:
+    /// Returned by Find() when no rule matches
+    static constexpr uint8_t kNoMatch = 0xFFU;
+
+    /// Maximum ancestor chain length (guards against cyclic hierarchies)
+    static constexpr std::size_t kMaxHierarchyDepth = 16U;
+
+    /// Key matching implementation
+    enum class Isa : uint8_t {
+        kScalar = 0,
+        kAvx2 = 1
+    };
+
+    VectorRuleTable();
+
+    /**
+     * @brief Build from a transition table
+     *
+     * @param rules Transition rules
+     * @param count Number of rules
+     * @param hierarchy State hierarchy (may be nullptr)
+     * @param hierarchyCount Number of hierarchy entries
+     * @return Table
+     */
+    static VectorRuleTable FromTransitions(
+        const config::TransitionRule* rules,
+        std::size_t count,
+        const config::StateHierarchyRule* hierarchy,
+        std::size_t hierarchyCount);
+
+    /**
+     * @brief Build from an error recovery table
+     *
+     * config::kExecutionErrorAny is treated as wildcard key.
+     *
+     * @param rules Error recovery rules
+     * @param count Number of rules
+     * @param hierarchy State hierarchy (may be nullptr)
+     * @param hierarchyCount Number of hierarchy entries
+     * @return Table
+     */
+    static VectorRuleTable FromErrorRecovery(
+        const config::ErrorRecoveryRule* rules,
+        std::size_t count,
+        const config::StateHierarchyRule* hierarchy,
+        std::size_t hierarchyCount);
+
+    /**
+     * @brief Look up target state
+     *
+     * @param state Current state
+     * @param key Trigger or error code
+     * @param conditions Condition word for guard evaluation
+     * @return Target state, or kNoMatch
+     */
+    uint8_t Find(uint8_t state, uint32_t key,
+                 config::ConditionMask conditions = 0U) const;
+
+    /**
+     * @brief Select key matching implementation
+     *
+     * @param isa Requested implementation
+     * @return false if not supported on this CPU (selection unchanged)
+     */
+    bool SelectIsa(Isa isa);
+
+    /// Active key matching implementation
+    Isa GetIsa() const { return isa_; }
+
+    /// Best implementation supported by this CPU
+    static Isa DetectIsa();
+
+    /// Number of stored (non-wildcard) rules
+    std::size_t GetRuleCount() const { return keys_.size(); }
+
+    /**
+     * @brief Enumerate resolved exact-key candidates of every state
+     *
+     * Same edges as CompiledRuleTable::GetEdges() (hierarchy flattened,
+     * ordered by state, then key, then resolution order), but built from
+     * the rule ranges without a state x key matrix. Wildcard rules are
+     * not listed.
+     *
+     * @return Edges
+     */
+    std::vector<CompiledRuleTable::Edge> GetEdges() const;
+
+private:
+    using MatchFn = std::size_t (*)(const uint32_t* keys,
+                                    std::size_t begin,
+                                    std::size_t end,
+                                    uint32_t key);
+
+    struct Rule {
+        uint32_t fromState;
+        uint32_t key;
+        uint32_t toState;
+        config::TransitionGuard guard;
+    };
+
+    static VectorRuleTable Build(
+        const std::vector<Rule>& rules,
+        const config::StateHierarchyRule* hierarchy,
+        std::size_t hierarchyCount,
+        bool hasWildcard,
+        uint32_t wildcardKey);
+
+    std::vector<uint32_t> rangeBegin_;          ///< state -> first rule (257 entries)
+    std::vector<uint32_t> keys_;                ///< rule -> key
+    std::vector<uint8_t> toStates_;             ///< rule -> target state
+    std::vector<config::ConditionMask> allOf_;  ///< rule -> guard allOf
+    std::vector<config::ConditionMask> noneOf_; ///< rule -> guard noneOf
+    uint8_t wildcard_[256];                     ///< state -> wildcard target
+    uint8_t parent_[256];                       ///< state -> parent state
+
+    Isa isa_;
+    MatchFn match_;
+};
+
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_VECTOR_RULE_TABLE_H
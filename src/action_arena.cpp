@@ -0,0 +1,70 @@
+#include "action_arena.h"
+
+/**
+ * @file action_arena.cpp
+ * @brief Packing of action lists into one contiguous arena
+ */
+
+namespace ara {
+namespace sm {
+
+namespace {
+
+// kNoSymbol for a name that is present but could not be interned
+bool InternFailed(SymbolId id, const char* name)
+{
+    return id == kNoSymbol && name != nullptr && name[0] != '\0';
+}
+
+} // namespace
+
+bool ActionArena::Pack(const config::ActionItem& item, SymbolTable& symbols, PackedAction& packed)
+{
+    packed = {item.type, 0U, kNoSymbol, kNoSymbol};
+
+    if (item.type == config::ActionType::kSleep) {
+        packed.operand = item.sleepTimeMs;
+        return true;
+    }
+    if (item.type == config::ActionType::kSync) {
+        packed.operand = item.timeoutMs;
+        return true;
+    }
+
+    const SymbolKind targetKind = SymbolTable::TargetKind(item.type);
+    if (targetKind != SymbolKind::kCount) {
+        packed.target = symbols.Intern(targetKind, item.target);
+        if (InternFailed(packed.target, item.target)) {
+            return false;
+        }
+    }
+
+    const SymbolKind paramKind = SymbolTable::ParamKind(item.type);
+    if (paramKind != SymbolKind::kCount) {
+        const SymbolId param = symbols.Intern(paramKind, item.param);
+        if (InternFailed(param, item.param)) {
+            return false;
+        }
+        packed.operand = param;
+    }
+    return true;
+}
+
+bool ActionArena::Append(const config::ActionItem* items, std::size_t count,
+                         SymbolTable& symbols, ActionSpan& span)
+{
+    const std::size_t first = actions_.size();
+    actions_.resize(first + count);
+    for (std::size_t i = 0; i < count; i++) {
+        if (!Pack(items[i], symbols, actions_[first + i])) {
+            actions_.resize(first);
+            return false;
+        }
+    }
+
+    span = {static_cast<uint32_t>(first), static_cast<uint32_t>(count)};
+    return true;
+}
+
+} // namespace sm
+} // namespace ara
@@ -1,5 +1,7 @@
 #include "action_executor.h"
+#include "network_management.h"
 #include "static_config.h"
+#include <algorithm>
 #include <iostream>
 #include <thread>
 #include <chrono>
@@ -26,27 +28,107 @@ namespace sm {
  * @req [SWS_SM_00609] Actions are processed in order
  * @req [SWS_SM_00611] Actions processed in parallel unless SYNC
  */
-void ActionExecutor::ExecuteActionList(
+ActionExecutor::Result ActionExecutor::ExecuteActionList(
     const config::ActionItem* actions, 
     size_t count)
+{
+    return ExecuteActionList(actions, count, 0U);
+}
+
+ActionExecutor::Result ActionExecutor::ExecuteActionList(
+    const config::ActionItem* actions, 
+    size_t count,
+    uint32_t timeoutMs)
 {
     std::cout << "[ActionExecutor] Executing action list (" 
               << count << " actions)" << std::endl;
+    BeginList(timeoutMs);
     
+    Result result;
+    uint32_t unsynced = 0U;     // Actions issued since the last SYNC, as dependsOn bits
     for (size_t i = 0; i < count; i++) {
-        // Stop at terminator (when target is nullptr)
-        // This allows variable-length action lists
+        // Stop at terminator (when target is nullptr; Sync and Sleep
+        // have no target). This allows variable-length action lists
         if (actions[i].target == nullptr && 
-            actions[i].type != config::ActionType::kSync) {
+            actions[i].type != config::ActionType::kSync &&
+            actions[i].type != config::ActionType::kSleep) {
             std::cout << "[ActionExecutor] Reached end of action list (terminator)" 
                       << std::endl;
             break;
         }
+        if (ListAborted()) {
+            result = Result(StateManagementErrc::kTransitionFailed);
+            break;
+        }
+        
+        // Items run in order here, so a dependency only needs a SYNC
+        // if it is not yet behind one (as in the plan linearization)
+        if ((actions[i].dependsOn & unsynced) != 0U) {
+            result = ExecuteAction({config::ActionType::kSync, nullptr, nullptr, 0U, 0U, 0U});
+            if (!result.HasValue()) {
+                break;
+            }
+            unsynced = 0U;
+        }
         
-        ExecuteAction(actions[i]);
+        result = ExecuteAction(actions[i]);
+        if (!result.HasValue()) {
+            break;
+        }
+        if (actions[i].type == config::ActionType::kSync) {
+            unsynced = 0U;
+        } else if (actions[i].type != config::ActionType::kSleep && i < 32U) {
+            unsynced |= config::DependsOn(static_cast<uint32_t>(i));
+        }
+    }
+    
+    return EndList(result);
+}
+
+/**
+ * @brief Execute a resolved action list through its precompiled plan
+ * 
+ * The plan already ends at the terminator and has SYNC/sleep folded
+ * into segment barriers; targets and parameters are symbol IDs, names
+ * are only fetched (by index) to log. The list deadline starts here.
+ */
+ActionExecutor::Result ActionExecutor::ExecuteResolvedActionList(const ResolvedActionList& list)
+{
+    std::cout << "[ActionExecutor] Executing action list (" 
+              << list.actionCount << " actions, "
+              << list.plan.segmentCount << " segments)" << std::endl;
+    BindSymbols(*list.symbols);
+    BeginList(list.timeoutMs);
+    
+    return EndList(IBatchActionExecutor::ExecuteResolvedActionList(list));
+}
+
+/**
+ * @brief Common end of both list paths
+ * 
+ * A failed list is compensated first (if enabled); either way the list
+ * is finished, so nothing it issued is left unobserved. A deadline that
+ * expired in the last wait fails the list as well.
+ */
+ActionExecutor::Result ActionExecutor::EndList(const Result& result)
+{
+    if (!result.HasValue() || ListAborted()) {
+        FailList();
+        Compensate();
+    }
+    if (!FinishList().HasValue()) {
+        FailList();
     }
+    undo_.clear();
     
-    std::cout << "[ActionExecutor] Action list completed" << std::endl;
+    std::cout << "[ActionExecutor] Action list "
+              << (listFailed_ ? "failed" : "completed") << std::endl;
+    return GetListResult();
+}
+
+ActionExecutor::Result ActionExecutor::FinishList()
+{
+    return FlushNetworkRequests();
 }
 
 // ============================================================================
@@ -56,39 +138,222 @@ void ActionExecutor::ExecuteActionList(
 /**
  * @brief Execute a single action item
  * @req [SWS_SM_00608-00626] Different action types
+ * 
+ * ActionItem path: names are interned into the executor's symbol copy,
+ * then the item runs like a packed action.
  */
-void ActionExecutor::ExecuteAction(const config::ActionItem& action)
+ActionExecutor::Result ActionExecutor::ExecuteAction(const config::ActionItem& action)
 {
     switch (action.type) {
         case config::ActionType::kSetFunctionGroupState:
-            ExecuteSetFunctionGroupState(action.target, action.param);
-            break;
+            return ExecuteSetFunctionGroupState(
+                InternSymbol(SymbolKind::kFunctionGroup, action.target),
+                InternSymbol(SymbolKind::kFunctionGroupState, action.param));
             
         case config::ActionType::kStartStateMachine:
-            ExecuteStartStateMachine(action.target, action.param);
-            break;
+            return ExecuteStartStateMachine(
+                InternSymbol(SymbolKind::kStateMachine, action.target),
+                InternSymbol(SymbolKind::kStateMachineState, action.param));
             
         case config::ActionType::kStopStateMachine:
-            ExecuteStopStateMachine(action.target);
-            break;
+            return ExecuteStopStateMachine(InternSymbol(SymbolKind::kStateMachine, action.target));
             
         case config::ActionType::kSync:
-            ExecuteSync();
-            break;
+            return ExecuteSync();
             
         case config::ActionType::kSleep:
-            ExecuteSleep(action.sleepTimeMs);
-            break;
+            return ExecuteSleep(action.sleepTimeMs);
             
         case config::ActionType::kSetNetworkHandle:
-            ExecuteSetNetworkHandle(action.target, action.param);
-            break;
+            return ExecuteSetNetworkHandle(
+                InternSymbol(SymbolKind::kNetworkHandle, action.target),
+                InternSymbol(SymbolKind::kNetworkState, action.param));
             
         default:
             std::cerr << "[ActionExecutor] ERROR: Unknown action type: " 
                       << static_cast<int>(action.type) << std::endl;
+            return Result(StateManagementErrc::kInvalidValue);
+    }
+}
+
+/**
+ * @brief Issue one type group of a plan segment
+ * @req [SWS_SM_00611] Actions between barriers run in parallel
+ * 
+ * The type is dispatched once per batch; the demo backend then issues
+ * the batch item by item, by symbol ID.
+ */
+ActionExecutor::Result ActionExecutor::ExecuteActionBatch(const ActionBatch& batch)
+{
+    BindSymbols(*batch.symbols);
+    const PackedAction* const end = batch.actions + batch.count;
+    Result result;
+    
+    switch (batch.group) {
+        case ActionGroup::kSetFunctionGroupState:
+            for (const PackedAction* a = batch.actions; a != end && result.HasValue(); a++) {
+                result = ExecuteSetFunctionGroupState(a->target, a->GetParam());
+            }
+            break;
+            
+        case ActionGroup::kStartStateMachine:
+            for (const PackedAction* a = batch.actions; a != end && result.HasValue(); a++) {
+                result = ExecuteStartStateMachine(a->target, a->GetParam());
+            }
+            break;
+            
+        case ActionGroup::kStopStateMachine:
+            for (const PackedAction* a = batch.actions; a != end && result.HasValue(); a++) {
+                result = ExecuteStopStateMachine(a->target);
+            }
+            break;
+            
+        case ActionGroup::kSetNetworkHandle:
+            for (const PackedAction* a = batch.actions; a != end && result.HasValue(); a++) {
+                result = ExecuteSetNetworkHandle(a->target, a->GetParam());
+            }
             break;
+            
+        default:
+            std::cerr << "[ActionExecutor] ERROR: Unknown action group: " 
+                      << static_cast<int>(batch.group) << std::endl;
+            return Result(StateManagementErrc::kInvalidValue);
+    }
+    return result;
+}
+
+/**
+ * @brief End of a plan segment
+ * @req [SWS_SM_00610] SYNC action
+ * @req [SWS_SM_00624] Sleep action
+ */
+ActionExecutor::Result ActionExecutor::ExecuteSegmentBarrier(
+    uint32_t sleepMs, bool sync, uint32_t /*timeoutMs*/)
+{
+    if (sleepMs != 0U) {
+        auto result = ExecuteSleep(sleepMs);
+        if (!result.HasValue()) {
+            return result;
+        }
+    }
+    return sync ? ExecuteSync() : Result();
+}
+
+// ============================================================================
+// Dependency plans
+// ============================================================================
+
+/**
+ * @brief Run a dependency plan as its dependencies allow
+ * @req [SWS_SM_00611] Independent actions run in parallel
+ */
+ActionExecutor::Result ActionExecutor::ExecuteActionGraph(const ResolvedActionList& list)
+{
+    const ActionPlan& plan = list.plan;
+    const std::size_t count = plan.nodeCount;
+
+    BindSymbols(*list.symbols);
+    nodeStates_.assign(count, NodeState::kWaiting);
+    nodeBlockers_.resize(count);
+    nodeWake_.resize(count);
+    for (std::size_t n = 0; n < count; n++) {
+        nodeBlockers_[n] = plan.nodes[n].dependencyCount;
+    }
+
+    auto ready = [&](std::size_t n) {
+        return nodeStates_[n] == NodeState::kWaiting && nodeBlockers_[n] == 0U;
+    };
+    auto actionOf = [&](std::size_t n) -> const PackedAction& {
+        return plan.actions[plan.nodes[n].action];
+    };
+
+    std::size_t done = 0U;
+    while (done < count) {
+        if (ListAborted()) {
+            return Result(StateManagementErrc::kTransitionFailed);
+        }
+
+        // Start what is ready, in critical-path order
+        const Clock::time_point now = Clock::now();
+        for (std::size_t n = 0; n < count;) {
+            if (!ready(n)) {
+                n++;
+                continue;
+            }
+            const PackedAction& action = actionOf(n);
+            if (action.type == config::ActionType::kSleep) {
+                std::cout << "  [Action] Sleep: " << action.GetSleepTimeMs() << "ms" << std::endl;
+                nodeWake_[n] = now + std::chrono::milliseconds(action.GetSleepTimeMs());
+                nodeStates_[n] = NodeState::kIssued;
+                n++;
+                continue;
+            }
+
+            const ActionGroup group = ActionPlanSet::GroupOf(action.type);
+            std::size_t end = n + 1U;
+            while (end < count && ready(end) && ActionPlanSet::GroupOf(actionOf(end).type) == group) {
+                end++;
+            }
+            std::fill(nodeStates_.begin() + static_cast<std::ptrdiff_t>(n),
+                      nodeStates_.begin() + static_cast<std::ptrdiff_t>(end), NodeState::kIssued);
+            auto result = ExecuteActionBatch({group, &action, end - n, list.symbols});
+            if (!result.HasValue()) {
+                return result;
+            }
+            n = end;
+        }
+        auto result = FlushNetworkRequests();
+        if (!result.HasValue()) {
+            return result;
+        }
+
+        // Release the successors of what has completed
+        const Clock::time_point checked = Clock::now();
+        Clock::time_point next = listDeadline_;
+        std::size_t completed = 0U;
+        for (std::size_t n = 0; n < count; n++) {
+            if (nodeStates_[n] != NodeState::kIssued) {
+                continue;
+            }
+            const PackedAction& action = actionOf(n);
+            if (action.type == config::ActionType::kSleep ? checked < nodeWake_[n]
+                                                          : !IsActionDone(action, *list.symbols)) {
+                if (action.type == config::ActionType::kSleep) {
+                    next = std::min(next, nodeWake_[n]);
+                }
+                continue;
+            }
+            nodeStates_[n] = NodeState::kDone;
+            completed++;
+            const PlanNode& node = plan.nodes[n];
+            for (uint32_t s = 0; s < node.successorCount; s++) {
+                nodeBlockers_[plan.successors[node.firstSuccessor + s]]--;
+            }
+        }
+        done += completed;
+
+        if (completed == 0U) {
+            result = WaitForActions(next);
+            if (!result.HasValue()) {
+                return result;
+            }
+        }
+    }
+    return Result();
+}
+
+bool ActionExecutor::IsActionDone(const PackedAction& /*action*/, const SymbolTable& /*symbols*/)
+{
+    return true;
+}
+
+ActionExecutor::Result ActionExecutor::WaitForActions(Clock::time_point until)
+{
+    // Only sleeps are pending here; nothing to wait for without one
+    if (until != Clock::time_point::max()) {
+        std::this_thread::sleep_until(until);
     }
+    return Result();
 }
 
 // ============================================================================
@@ -99,23 +364,33 @@ void ActionExecutor::ExecuteAction(const config::ActionItem& action)
  * @brief Set Function Group State
  * @req [SWS_SM_00608]
  * 
- * @param fgName Function Group name (e.g., "MachineFG", "InfotainmentFG")
- * @param stateName Desired state (e.g., "Startup", "Running", "Off")
+ * @param functionGroup Function Group (e.g., "MachineFG", "InfotainmentFG")
+ * @param state Desired state (e.g., "Startup", "Running", "Off")
  */
-void ActionExecutor::ExecuteSetFunctionGroupState(
-    const char* fgName, 
-    const char* stateName)
+ActionExecutor::Result ActionExecutor::ExecuteSetFunctionGroupState(
+    SymbolId functionGroup, 
+    SymbolId state)
 {
+    const char* fgName = symbols_->GetName(SymbolKind::kFunctionGroup, functionGroup);
+    const char* stateName = symbols_->GetName(SymbolKind::kFunctionGroupState, state);
     if (fgName == nullptr || stateName == nullptr) {
         std::cerr << "[ActionExecutor] ERROR: SetFunctionGroupState - null parameter" 
                   << std::endl;
-        return;
+        return Result(StateManagementErrc::kInvalidValue);
+    }
+    
+    if (ElideFunctionGroupState(functionGroup, state)) {
+        return Result();
     }
     
     std::cout << "  [Action] SetFunctionGroupState: " 
               << fgName << " -> " << stateName << std::endl;
     
-
+    // Completes when issued
+    RecordCompensation(config::ActionType::kSetFunctionGroupState, functionGroup,
+                       GetFunctionGroupState(functionGroup));
+    SetFunctionGroupState(functionGroup, state);
+    return Result();
 }
 
 /**
@@ -123,22 +398,24 @@ void ActionExecutor::ExecuteSetFunctionGroupState(
  * @req [SWS_SM_00612] Start StateMachine without parameter
  * @req [SWS_SM_00622] Start StateMachine with parameter state
  * 
- * @param smName StateMachine name (e.g., "InfotainmentSM")
- * @param initialState Optional initial state (can be nullptr for default)
+ * @param stateMachine StateMachine (e.g., "InfotainmentSM")
+ * @param initialState Optional initial state (kNoSymbol for default)
  */
-void ActionExecutor::ExecuteStartStateMachine(
-    const char* smName, 
-    const char* initialState)
+ActionExecutor::Result ActionExecutor::ExecuteStartStateMachine(
+    SymbolId stateMachine, 
+    SymbolId initialState)
 {
+    const char* smName = symbols_->GetName(SymbolKind::kStateMachine, stateMachine);
+    const char* initialName = symbols_->GetName(SymbolKind::kStateMachineState, initialState);
     if (smName == nullptr) {
         std::cerr << "[ActionExecutor] ERROR: StartStateMachine - null name" 
                   << std::endl;
-        return;
+        return Result(StateManagementErrc::kInvalidValue);
     }
     
     std::cout << "  [Action] StartStateMachine: " << smName;
-    if (initialState != nullptr && initialState[0] != '\0') {
-        std::cout << " (initial state: " << initialState << ")";
+    if (initialName != nullptr) {
+        std::cout << " (initial state: " << initialName << ")";
     } else {
         std::cout << " (default initial state)";
     }
@@ -153,6 +430,8 @@ void ActionExecutor::ExecuteStartStateMachine(
     // } else {
     //     agentSM.Start(); // Uses default initial state
     // }
+    RecordCompensation(config::ActionType::kStopStateMachine, stateMachine, kNoSymbol);
+    return Result();
 }
 
 /**
@@ -160,19 +439,22 @@ void ActionExecutor::ExecuteStartStateMachine(
  * @req [SWS_SM_00614] Stop StateMachine
  * @req [SWS_SM_00651] Transition to Off state before stopping
  * 
- * @param smName StateMachine name to stop
+ * Not compensated: the state the StateMachine was stopped in is unknown.
+ * 
+ * @param stateMachine StateMachine to stop
  */
-void ActionExecutor::ExecuteStopStateMachine(const char* smName)
+ActionExecutor::Result ActionExecutor::ExecuteStopStateMachine(SymbolId stateMachine)
 {
+    const char* smName = symbols_->GetName(SymbolKind::kStateMachine, stateMachine);
     if (smName == nullptr) {
         std::cerr << "[ActionExecutor] ERROR: StopStateMachine - null name" 
                   << std::endl;
-        return;
+        return Result(StateManagementErrc::kInvalidValue);
     }
     
     std::cout << "  [Action] StopStateMachine: " << smName << std::endl;
-    
-    
+    return Result();
+}
 
 /**
  * @brief Synchronization point - wait for previous actions
@@ -180,14 +462,21 @@ void ActionExecutor::ExecuteStopStateMachine(const char* smName)
  * 
  * Blocks until all previously issued actions have completed.
  * This is important for ensuring correct ordering when actions
- * have dependencies.
+ * have dependencies. Once they have, the segment is complete and no
+ * longer compensated.
  */
-void ActionExecutor::ExecuteSync()
+ActionExecutor::Result ActionExecutor::ExecuteSync()
 {
     std::cout << "  [Action] SYNC - waiting for previous actions to complete..." 
               << std::endl;
+    auto result = FlushNetworkRequests();
+    if (!result.HasValue()) {
+        return result;
+    }
+    undo_.clear();
     
     std::cout << "  [Action] SYNC - completed" << std::endl;
+    return Result();
 }
 
 /**
@@ -195,17 +484,24 @@ void ActionExecutor::ExecuteSync()
  * @req [SWS_SM_00624]
  * 
  * Used for implementing afterrun scenarios, e.g., keeping
- * network active for a period after shutdown request.
+ * network active for a period after shutdown request. Ends early at
+ * the list deadline, which fails the list.
  * 
  * @param milliseconds Duration to sleep in milliseconds
  */
-void ActionExecutor::ExecuteSleep(uint32_t milliseconds)
+ActionExecutor::Result ActionExecutor::ExecuteSleep(uint32_t milliseconds)
 {
     std::cout << "  [Action] Sleep: " << milliseconds << "ms" << std::endl;
+    auto result = FlushNetworkRequests();
     
-    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    std::this_thread::sleep_until(
+        std::min(Clock::now() + std::chrono::milliseconds(milliseconds), listDeadline_));
+    if (ListAborted()) {
+        return Result(StateManagementErrc::kTransitionFailed);
+    }
     
     std::cout << "  [Action] Sleep completed" << std::endl;
+    return result;
 }
 
 /**
@@ -215,22 +511,319 @@ void ActionExecutor::ExecuteSleep(uint32_t milliseconds)
  * 
  * Controls network communication state through Network Management.
  * 
- * @param handleName NetworkHandle name (e.g., "VehicleNetwork", "MediaNetwork")
+ * @param handle NetworkHandle (e.g., "VehicleNetwork", "MediaNetwork")
  * @param state Target state: "FullCom" or "NoCom"
  */
-void ActionExecutor::ExecuteSetNetworkHandle(
-    const char* handleName, 
-    const char* state)
+ActionExecutor::Result ActionExecutor::ExecuteSetNetworkHandle(
+    SymbolId handle, 
+    SymbolId state)
 {
-    if (handleName == nullptr || state == nullptr) {
+    if (handle >= nmHandles_.size() || state >= nmStates_.size()) {
+        // Interned by an ActionItem since the last mapping
+        MapNetworkSymbols();
+    }
+    const char* handleName = symbols_->GetName(SymbolKind::kNetworkHandle, handle);
+    const char* stateName = symbols_->GetName(SymbolKind::kNetworkState, state);
+    if (handleName == nullptr || stateName == nullptr) {
         std::cerr << "[ActionExecutor] ERROR: SetNetworkHandle - null parameter" 
                   << std::endl;
-        return;
+        return Result(StateManagementErrc::kInvalidValue);
     }
     
     std::cout << "  [Action] SetNetworkHandle: " 
-              << handleName << " -> " << state << std::endl;
+              << handleName << " -> " << stateName << std::endl;
+    
+    if (networkManagement_ == nullptr) {
+        return Result();
+    }
+    if (nmStates_[state] < 0) {
+        std::cerr << "[ActionExecutor] ERROR: SetNetworkHandle - unknown state: " 
+                  << stateName << std::endl;
+        return Result(StateManagementErrc::kInvalidValue);
+    }
+    const auto nmState = static_cast<NmStateRequestEnum>(nmStates_[state]);
     
+    NmStateRequestEnum previous;
+    if (networkManagement_->GetState(nmHandles_[handle], previous) && previous != nmState) {
+        SymbolId undo = nmStateSymbols_[static_cast<std::size_t>(previous)];
+        if (undo == kNoSymbol) {
+            // Not named by the configuration
+            undo = symbols_->Intern(SymbolKind::kNetworkState,
+                                    previous == NmStateRequestEnum::kFullCom ? "FullCom" : "NoCom");
+            MapNetworkSymbols();
+        }
+        RecordCompensation(config::ActionType::kSetNetworkHandle, handle, undo);
+    }
+    return networkManagement_->Request(nmHandles_[handle], nmState);
+}
+
+void ActionExecutor::SetNetworkManagement(NetworkManagementClient* client)
+{
+    networkManagement_ = client;
+    nmHandles_.clear();
+    MapNetworkSymbols();
+}
+
+/**
+ * @brief Register handles and parse state names not mapped yet
+ * 
+ * Only IDs added to symbols_ since the last call are looked at.
+ */
+void ActionExecutor::MapNetworkSymbols()
+{
+    for (std::size_t id = nmHandles_.size(); id < symbols_->GetCount(SymbolKind::kNetworkHandle); id++) {
+        const char* name = symbols_->GetName(SymbolKind::kNetworkHandle, static_cast<SymbolId>(id));
+        nmHandles_.push_back(networkManagement_ != nullptr
+                                 ? networkManagement_->RegisterHandle(name) : kNoSymbol);
+    }
+    for (std::size_t id = nmStates_.size(); id < symbols_->GetCount(SymbolKind::kNetworkState); id++) {
+        NmStateRequestEnum state;
+        const char* name = symbols_->GetName(SymbolKind::kNetworkState, static_cast<SymbolId>(id));
+        if (!NetworkManagementClient::ParseState(name, state)) {
+            nmStates_.push_back(-1);
+            continue;
+        }
+        nmStates_.push_back(static_cast<int8_t>(state));
+        SymbolId& symbol = nmStateSymbols_[static_cast<std::size_t>(state)];
+        if (symbol == kNoSymbol) {
+            symbol = static_cast<SymbolId>(id);
+        }
+    }
+}
+
+/**
+ * @brief Send the queued handle changes as one Network Management request
+ */
+ActionExecutor::Result ActionExecutor::FlushNetworkRequests()
+{
+    if (networkManagement_ == nullptr) {
+        return Result();
+    }
+    return networkManagement_->Flush();
+}
+
+// ============================================================================
+// Compensation
+// ============================================================================
+
+void ActionExecutor::RecordCompensation(
+    config::ActionType type, 
+    SymbolId target, 
+    SymbolId param)
+{
+    if (compensating_ || target == kNoSymbol) {
+        return;
+    }
+    if (param == kNoSymbol && type != config::ActionType::kStopStateMachine) {
+        return;
+    }
+    undo_.push_back({type, 0U, target, param});
+}
+
+/**
+ * @brief Undo the actions of the failed segment, newest first
+ * 
+ * Runs with the list deadline lifted (it may be what failed the list);
+ * the backend's own timeouts still bound it. Compensating actions that
+ * fail are logged and skipped.
+ */
+void ActionExecutor::Compensate()
+{
+    if (compensation_ == CompensationMode::kNone || undo_.empty()) {
+        return;
+    }
+    std::cout << "[ActionExecutor] Compensating " << undo_.size()
+              << " action(s) of the failed segment" << std::endl;
+    
+    std::vector<PackedAction> undo;
+    undo.swap(undo_);
+    listDeadline_ = Clock::time_point::max();
+    compensating_ = true;
+    
+    for (auto it = undo.rbegin(); it != undo.rend(); ++it) {
+        if (!ExecuteActionBatch({ActionPlanSet::GroupOf(it->type), &*it, 1U, symbols_.get()}).HasValue()) {
+            std::cerr << "[ActionExecutor] ERROR: Compensation failed for "
+                      << symbols_->GetName(SymbolTable::TargetKind(it->type), it->target) << std::endl;
+        }
+        compensatedCount_++;
+    }
+    compensating_ = false;
+}
+
+// ============================================================================
+// Symbols
+// ============================================================================
+
+/**
+ * @brief Copy the names of a new table, keeping its IDs
+ * 
+ * Names are unique and non-empty per kind, so interning them in ID
+ * order hands out the same IDs. Runs once per configuration.
+ */
+void ActionExecutor::BindSymbols(const SymbolTable& symbols)
+{
+    if (&symbols == symbols_.get() || symbols.GetGeneration() == boundGeneration_) {
+        return;
+    }
+
+    auto copy = std::make_unique<SymbolTable>();
+    for (std::size_t k = 0; k < SymbolTable::kKindCount; k++) {
+        const auto kind = static_cast<SymbolKind>(k);
+        for (std::size_t id = 0; id < symbols.GetCount(kind); id++) {
+            copy->Intern(kind, symbols.GetName(kind, static_cast<SymbolId>(id)));
+        }
+    }
+    boundGeneration_ = symbols.GetGeneration();
+
+    const std::unique_ptr<SymbolTable> previous = std::move(symbols_);
+    symbols_ = std::move(copy);
+    nmHandles_.clear();
+    nmStates_.clear();
+    nmStateSymbols_[0] = kNoSymbol;
+    nmStateSymbols_[1] = kNoSymbol;
+    MapNetworkSymbols();
+    OnSymbolsBound(*previous);
+}
+
+void ActionExecutor::OnSymbolsBound(const SymbolTable& previous)
+{
+    // Function group states and elision counts move to the new IDs
+    std::vector<SymbolId> states(symbols_->GetCount(SymbolKind::kFunctionGroup), kNoSymbol);
+    std::vector<std::size_t> elided(states.size(), 0U);
+    for (std::size_t id = 0; id < fgStates_.size(); id++) {
+        const SymbolId group = symbols_->Intern(SymbolKind::kFunctionGroup,
+            previous.GetName(SymbolKind::kFunctionGroup, static_cast<SymbolId>(id)));
+        if (group == kNoSymbol) {
+            continue;
+        }
+        if (group >= states.size()) {
+            states.resize(group + 1U, kNoSymbol);
+            elided.resize(group + 1U, 0U);
+        }
+        states[group] = symbols_->Intern(SymbolKind::kFunctionGroupState,
+            previous.GetName(SymbolKind::kFunctionGroupState, fgStates_[id]));
+        elided[group] = fgElided_[id];
+    }
+    fgStates_.swap(states);
+    fgElided_.swap(elided);
+
+    // Undo actions not yet run keep their targets
+    for (auto& action : undo_) {
+        const SymbolKind targetKind = SymbolTable::TargetKind(action.type);
+        const SymbolKind paramKind = SymbolTable::ParamKind(action.type);
+        action.target = symbols_->Intern(targetKind, previous.GetName(targetKind, action.target));
+        if (paramKind != SymbolKind::kCount) {
+            action.operand = symbols_->Intern(paramKind, previous.GetName(paramKind, action.GetParam()));
+        }
+    }
+}
+
+// ============================================================================
+// Deadlines
+// ============================================================================
+
+void ActionExecutor::BeginList(uint32_t timeoutMs)
+{
+    listBegin_ = Clock::now();
+    listDeadline_ = timeoutMs != 0U
+        ? listBegin_ + std::chrono::milliseconds(timeoutMs)
+        : Clock::time_point::max();
+    deadlineExpired_ = false;
+    listFailed_ = false;
+}
+
+ActionExecutor::Clock::time_point ActionExecutor::GetWaitDeadline(uint32_t timeoutMs) const
+{
+    if (timeoutMs == 0U) {
+        return listDeadline_;
+    }
+    return std::min(Clock::now() + std::chrono::milliseconds(timeoutMs), listDeadline_);
+}
+
+/**
+ * @brief Stop the list once its deadline has passed
+ * 
+ * Already issued actions are not undone; the executor's next wait ends
+ * immediately, so a hung function group costs at most the deadline.
+ */
+bool ActionExecutor::ListAborted()
+{
+    if (!deadlineExpired_ && listDeadline_ != Clock::time_point::max() &&
+        Clock::now() >= listDeadline_) {
+        deadlineExpired_ = true;
+        FailList();
+        std::cerr << "[ActionExecutor] ERROR: Action list deadline expired after "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(
+                         Clock::now() - listBegin_).count()
+                  << "ms, remaining actions skipped" << std::endl;
+    }
+    return deadlineExpired_;
+}
+
+ActionExecutor::Result ActionExecutor::GetListResult() const
+{
+    return listFailed_ ? Result(StateManagementErrc::kTransitionFailed) : Result();
+}
+
+// ============================================================================
+// Function Group state cache
+// ============================================================================
+
+/**
+ * @brief Elide SetFunctionGroupState for the active state
+ * 
+ * Lists re-set states that are already active (Startup sets MachineFG
+ * to Startup right after Initial did); each skipped request saves an
+ * Execution Management round trip.
+ */
+bool ActionExecutor::ElideFunctionGroupState(SymbolId functionGroup, SymbolId state)
+{
+    if (functionGroup >= fgStates_.size() || fgStates_[functionGroup] == kNoSymbol ||
+        fgStates_[functionGroup] != state) {
+        return false;
+    }
+
+    fgElided_[functionGroup]++;
+    elidedCount_++;
+    std::cout << "  [Action] SetFunctionGroupState: "
+              << symbols_->GetName(SymbolKind::kFunctionGroup, functionGroup) << " -> "
+              << symbols_->GetName(SymbolKind::kFunctionGroupState, state)
+              << " (already active, skipped)" << std::endl;
+    return true;
+}
+
+void ActionExecutor::SetFunctionGroupState(SymbolId functionGroup, SymbolId state)
+{
+    if (functionGroup == kNoSymbol) {
+        return;
+    }
+    if (functionGroup >= fgStates_.size()) {
+        fgStates_.resize(functionGroup + 1U, kNoSymbol);
+        fgElided_.resize(functionGroup + 1U, 0U);
+    }
+    fgStates_[functionGroup] = state;
+}
+
+SymbolId ActionExecutor::GetFunctionGroupState(SymbolId functionGroup) const
+{
+    return functionGroup < fgStates_.size() ? fgStates_[functionGroup] : kNoSymbol;
+}
+
+const char* ActionExecutor::GetFunctionGroupState(const char* fgName) const
+{
+    return symbols_->GetName(SymbolKind::kFunctionGroupState,
+        GetFunctionGroupState(symbols_->Find(SymbolKind::kFunctionGroup, fgName)));
+}
+
+void ActionExecutor::InvalidateFunctionGroupStates()
+{
+    fgStates_.assign(fgStates_.size(), kNoSymbol);
+}
+
+std::size_t ActionExecutor::GetElidedCount(const char* fgName) const
+{
+    const SymbolId group = symbols_->Find(SymbolKind::kFunctionGroup, fgName);
+    return group < fgElided_.size() ? fgElided_[group] : 0U;
 }
 
 } // namespace sm
@@ -0,0 +1,202 @@
+#include "action_plan.h"
+#include "action_arena.h"
+#include <algorithm>
+
+/**
+ * @file action_plan.cpp
+ * @brief Compilation of action lists into barrier-segmented and dependency plans
+ */
+
+namespace ara {
+namespace sm {
+
+namespace {
+
+// Shorter of two timeouts, 0 meaning none
+uint32_t MinTimeout(uint32_t a, uint32_t b)
+{
+    if (a == 0U || b == 0U) {
+        return a | b;
+    }
+    return a < b ? a : b;
+}
+
+} // namespace
+
+ActionGroup ActionPlanSet::GroupOf(config::ActionType type)
+{
+    switch (type) {
+        case config::ActionType::kSetFunctionGroupState:
+            return ActionGroup::kSetFunctionGroupState;
+        case config::ActionType::kStartStateMachine:
+            return ActionGroup::kStartStateMachine;
+        case config::ActionType::kStopStateMachine:
+            return ActionGroup::kStopStateMachine;
+        case config::ActionType::kSetNetworkHandle:
+            return ActionGroup::kSetNetworkHandle;
+        default:
+            return ActionGroup::kCount;
+    }
+}
+
+std::size_t ActionPlanSet::Add(const PackedAction* actions, std::size_t count,
+                               const config::ActionItem* items)
+{
+    PlanEntry plan{static_cast<uint32_t>(segments_.size()), 0U, 0U,
+                   static_cast<uint32_t>(nodes_.size()), 0U, 0U};
+
+    std::vector<PackedAction> groups[kActionGroupCount];
+    uint32_t sleepMs = 0U;
+    uint32_t unsynced = 0U;     // Items issued since the last SYNC, as dependsOn bits
+
+    auto close = [&](bool sync, uint32_t timeoutMs) {
+        if (sync) {
+            unsynced = 0U;
+        }
+
+        std::size_t actionCount = 0U;
+        for (const auto& group : groups) {
+            actionCount += group.size();
+        }
+
+        if (actionCount == 0U && sleepMs == 0U) {
+            // Repeated or leading SYNC: nothing new to wait for
+            if (sync && plan.segmentCount != 0U) {
+                PlanSegment& last = segments_.back();
+                last.timeoutMs = last.sync ? MinTimeout(last.timeoutMs, timeoutMs) : timeoutMs;
+                last.sync = true;
+            }
+            return;
+        }
+
+        PlanSegment segment{static_cast<uint32_t>(actions_.size()), {}, sleepMs, sync, timeoutMs};
+        uint16_t end = 0U;
+        for (std::size_t g = 0; g < kActionGroupCount; g++) {
+            actions_.insert(actions_.end(), groups[g].begin(), groups[g].end());
+            end = static_cast<uint16_t>(end + groups[g].size());
+            segment.groupEnd[g] = end;
+            groups[g].clear();
+        }
+        segments_.push_back(segment);
+
+        plan.segmentCount++;
+        plan.totalSleepMs += sleepMs;
+        sleepMs = 0U;
+    };
+
+    std::size_t end = count;
+    for (std::size_t i = 0; i < count; i++) {
+        const PackedAction& action = actions[i];
+        // A dependency on an action not yet behind a barrier needs one
+        const bool waits = items != nullptr && (items[i].dependsOn & unsynced) != 0U;
+
+        if (action.type == config::ActionType::kSync) {
+            close(true, action.GetTimeoutMs());
+            continue;
+        }
+        if (action.type == config::ActionType::kSleep) {
+            if (waits) {
+                close(true, 0U);
+            }
+            sleepMs += action.GetSleepTimeMs();
+            continue;
+        }
+
+        const ActionGroup group = GroupOf(action.type);
+        if (action.target == kNoSymbol || group == ActionGroup::kCount) {
+            end = i;    // Terminator
+            break;
+        }
+        if (waits) {
+            close(true, 0U);
+        }
+        if (sleepMs != 0U) {
+            close(false, 0U);
+        }
+        groups[static_cast<std::size_t>(group)].push_back(action);
+        if (i < 32U) {
+            unsynced |= config::DependsOn(static_cast<uint32_t>(i));
+        }
+    }
+    close(false, 0U);
+
+    if (items != nullptr) {
+        AddNodes(actions, end, items, plan);
+    }
+
+    plans_.push_back(plan);
+    return plans_.size() - 1U;
+}
+
+void ActionPlanSet::AddNodes(const PackedAction* actions, std::size_t count,
+                             const config::ActionItem* items, PlanEntry& plan)
+{
+    auto isNode = [&](std::size_t i) { return actions[i].type != config::ActionType::kSync; };
+    auto dependsOn = [&](std::size_t i, std::size_t d) {
+        return d < 32U && (items[i].dependsOn & config::DependsOn(static_cast<uint32_t>(d))) != 0U;
+    };
+
+    if (std::none_of(items, items + count,
+                     [](const config::ActionItem& item) { return item.dependsOn != 0U; })) {
+        return;
+    }
+
+    // Own cost plus the longest chain of items depending on it; those
+    // come later in the list, so one backward pass settles every rank
+    std::vector<uint32_t> rank(count, 0U);
+    for (std::size_t i = count; i-- > 0U;) {
+        rank[i] += actions[i].type == config::ActionType::kSleep ? actions[i].GetSleepTimeMs() : 1U;
+        for (std::size_t d = 0; d < i; d++) {
+            if (dependsOn(i, d)) {
+                rank[d] = std::max(rank[d], rank[i]);
+            }
+        }
+    }
+
+    std::vector<uint32_t> order;
+    for (std::size_t i = 0; i < count; i++) {
+        if (isNode(i)) {
+            order.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&](uint32_t a, uint32_t b) { return rank[a] > rank[b]; });
+
+    std::vector<uint16_t> nodeOf(count, 0U);
+    for (std::size_t n = 0; n < order.size(); n++) {
+        nodeOf[order[n]] = static_cast<uint16_t>(n);
+    }
+
+    for (const uint32_t i : order) {
+        PlanNode node{static_cast<uint32_t>(actions_.size()), rank[i],
+                      static_cast<uint32_t>(successors_.size()), 0U, 0U};
+        actions_.push_back(actions[i]);
+        for (std::size_t j = i + 1U; j < count; j++) {
+            if (isNode(j) && dependsOn(j, i)) {
+                successors_.push_back(nodeOf[j]);
+                node.successorCount++;
+            }
+        }
+        for (std::size_t d = 0; d < i; d++) {
+            if (isNode(d) && dependsOn(i, d)) {
+                node.dependencyCount++;
+            }
+        }
+        nodes_.push_back(node);
+    }
+
+    plan.nodeCount = static_cast<uint32_t>(order.size());
+    plan.criticalPathMs = order.empty() ? 0U : rank[order.front()];
+}
+
+ActionPlan ActionPlanSet::Get(std::size_t index) const
+{
+    const PlanEntry& plan = plans_[index];
+    return {segments_.data() + plan.firstSegment, plan.segmentCount,
+            actions_.data(), plan.totalSleepMs,
+            plan.nodeCount != 0U ? nodes_.data() + plan.firstNode : nullptr, plan.nodeCount,
+            successors_.data(), plan.criticalPathMs};
+}
+
+} // namespace sm
+} // namespace ara
@@ -0,0 +1,407 @@
+#include "binary_config.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ARA_SM_BINARY_CONFIG_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file binary_config.cpp
+ * @brief Memory-mapped binary configuration images
+ */
+
+namespace ara {
+namespace sm {
+
+// Rule structs are used in place - their layout is part of the format
+static_assert(std::is_standard_layout<config::TransitionRule>::value &&
+              sizeof(config::TransitionRule) == 20U, "TransitionRule layout");
+static_assert(std::is_standard_layout<config::ErrorRecoveryRule>::value &&
+              sizeof(config::ErrorRecoveryRule) == 12U, "ErrorRecoveryRule layout");
+static_assert(sizeof(config::StateHierarchyRule) == 8U, "StateHierarchyRule layout");
+static_assert(sizeof(BinaryActionList) == 16U, "BinaryActionList layout");
+static_assert(sizeof(BinaryActionItem) == 24U, "BinaryActionItem layout");
+static_assert(sizeof(BinaryConfigHeader) == 68U, "BinaryConfigHeader layout");
+
+namespace {
+
+using Result = ara::core::Result<void, StateManagementErrc>;
+
+Result Invalid(const char* reason)
+{
+    std::cerr << "[BinaryConfig] Invalid image: " << reason << std::endl;
+    return Result(StateManagementErrc::kInvalidValue);
+}
+
+bool SectionFits(const BinaryConfigSection& section, std::size_t elementSize,
+                 std::size_t headerSize, std::size_t imageSize)
+{
+    if (section.count == 0U) {
+        return true;
+    }
+    const uint64_t end = static_cast<uint64_t>(section.offset) +
+                         static_cast<uint64_t>(section.count) * elementSize;
+    return section.offset >= headerSize && (section.offset % 4U) == 0U && end <= imageSize;
+}
+
+} // namespace
+
+// ============================================================================
+// Lifetime
+// ============================================================================
+
+BinaryConfigImage::~BinaryConfigImage()
+{
+    Close();
+}
+
+BinaryConfigImage::BinaryConfigImage(BinaryConfigImage&& other) noexcept
+    : data_(other.data_)
+    , size_(other.size_)
+    , mapped_(other.mapped_)
+    , buffer_(std::move(other.buffer_))
+{
+    other.data_ = nullptr;
+    other.size_ = 0U;
+    other.mapped_ = false;
+}
+
+BinaryConfigImage& BinaryConfigImage::operator=(BinaryConfigImage&& other) noexcept
+{
+    if (this != &other) {
+        Close();
+        data_ = other.data_;
+        size_ = other.size_;
+        mapped_ = other.mapped_;
+        buffer_ = std::move(other.buffer_);
+        other.data_ = nullptr;
+        other.size_ = 0U;
+        other.mapped_ = false;
+    }
+    return *this;
+}
+
+void BinaryConfigImage::Close()
+{
+#ifdef ARA_SM_BINARY_CONFIG_MMAP
+    if (mapped_ && data_ != nullptr) {
+        munmap(const_cast<uint8_t*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0U;
+    mapped_ = false;
+    buffer_.clear();
+}
+
+// ============================================================================
+// Open / Attach
+// ============================================================================
+
+Result BinaryConfigImage::Open(const std::string& path)
+{
+    Close();
+
+#ifdef ARA_SM_BINARY_CONFIG_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "[BinaryConfig] Cannot open " << path << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        std::cerr << "[BinaryConfig] Cannot stat " << path << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    const auto size = static_cast<std::size_t>(info.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);    // the mapping keeps the file referenced
+
+    if (mapping == MAP_FAILED) {
+        std::cerr << "[BinaryConfig] mmap failed for " << path << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    data_ = static_cast<const uint8_t*>(mapping);
+    size_ = size;
+    mapped_ = true;
+#else
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cerr << "[BinaryConfig] Cannot open " << path << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+    buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+
+    auto result = Validate();
+    if (!result.HasValue()) {
+        Close();
+        return result;
+    }
+
+    std::cout << "[BinaryConfig] Mapped " << path << " (" << size_ << " bytes, '"
+              << GetName() << "')" << std::endl;
+    return Result();
+}
+
+Result BinaryConfigImage::Attach(const void* data, std::size_t size)
+{
+    Close();
+
+    if (data == nullptr || (reinterpret_cast<std::uintptr_t>(data) % 4U) != 0U) {
+        return Invalid("null or misaligned buffer");
+    }
+
+    data_ = static_cast<const uint8_t*>(data);
+    size_ = size;
+
+    auto result = Validate();
+    if (!result.HasValue()) {
+        Close();
+    }
+    return result;
+}
+
+Result BinaryConfigImage::Validate() const
+{
+    if (size_ < sizeof(BinaryConfigHeader)) {
+        return Invalid("truncated header");
+    }
+
+    const BinaryConfigHeader& header = Header();
+    if (header.magic != kMagic) {
+        return Invalid("bad magic");
+    }
+    if (header.version != kVersion) {
+        return Invalid("unsupported version");
+    }
+    if (header.headerSize != sizeof(BinaryConfigHeader) || header.imageSize != size_) {
+        return Invalid("size mismatch");
+    }
+    if (Crc32(data_ + header.headerSize, size_ - header.headerSize) != header.crc32) {
+        return Invalid("checksum mismatch");
+    }
+
+    if (!SectionFits(header.transitions, sizeof(config::TransitionRule), header.headerSize, size_) ||
+        !SectionFits(header.errorRecovery, sizeof(config::ErrorRecoveryRule), header.headerSize, size_) ||
+        !SectionFits(header.hierarchy, sizeof(config::StateHierarchyRule), header.headerSize, size_) ||
+        !SectionFits(header.actionLists, sizeof(BinaryActionList), header.headerSize, size_) ||
+        !SectionFits(header.actions, sizeof(BinaryActionItem), header.headerSize, size_) ||
+        !SectionFits(header.strings, 1U, header.headerSize, size_)) {
+        return Invalid("section out of bounds");
+    }
+
+    // String pool must be terminated so every offset yields a C string
+    const BinaryConfigSection& strings = header.strings;
+    if (strings.count == 0U || data_[strings.offset + strings.count - 1U] != '\0') {
+        return Invalid("string pool not terminated");
+    }
+    auto stringOk = [&strings](uint32_t offset) {
+        return offset == kNoString || offset < strings.count;
+    };
+    if (!stringOk(header.nameOffset)) {
+        return Invalid("name out of bounds");
+    }
+
+    const auto* lists = GetActionLists();
+    for (std::size_t i = 0; i < header.actionLists.count; i++) {
+        const uint64_t end = static_cast<uint64_t>(lists[i].firstAction) + lists[i].actionCount;
+        if (end > header.actions.count) {
+            return Invalid("action list out of bounds");
+        }
+    }
+
+    const auto* actions = reinterpret_cast<const BinaryActionItem*>(data_ + header.actions.offset);
+    for (std::size_t i = 0; i < header.actions.count; i++) {
+        if (actions[i].type > static_cast<uint8_t>(config::ActionType::kSetNetworkHandle) ||
+            !stringOk(actions[i].targetOffset) || !stringOk(actions[i].paramOffset)) {
+            return Invalid("bad action item");
+        }
+    }
+
+    return Result();
+}
+
+// ============================================================================
+// Accessors
+// ============================================================================
+
+const config::TransitionRule* BinaryConfigImage::GetTransitions() const
+{
+    return reinterpret_cast<const config::TransitionRule*>(data_ + Header().transitions.offset);
+}
+
+const config::ErrorRecoveryRule* BinaryConfigImage::GetErrorRecovery() const
+{
+    return reinterpret_cast<const config::ErrorRecoveryRule*>(data_ + Header().errorRecovery.offset);
+}
+
+const config::StateHierarchyRule* BinaryConfigImage::GetHierarchy() const
+{
+    return reinterpret_cast<const config::StateHierarchyRule*>(data_ + Header().hierarchy.offset);
+}
+
+const BinaryActionList* BinaryConfigImage::GetActionLists() const
+{
+    return reinterpret_cast<const BinaryActionList*>(data_ + Header().actionLists.offset);
+}
+
+config::ActionItem BinaryConfigImage::GetAction(std::size_t index) const
+{
+    const auto& item = reinterpret_cast<const BinaryActionItem*>(
+        data_ + Header().actions.offset)[index];
+
+    return config::ActionItem{
+        static_cast<config::ActionType>(item.type),
+        GetString(item.targetOffset),
+        GetString(item.paramOffset),
+        item.sleepTimeMs,
+        item.timeoutMs,
+        item.dependsOn
+    };
+}
+
+const char* BinaryConfigImage::GetString(uint32_t offset) const
+{
+    if (offset == kNoString) {
+        return nullptr;
+    }
+    return reinterpret_cast<const char*>(data_ + Header().strings.offset + offset);
+}
+
+// ============================================================================
+// CRC-32
+// ============================================================================
+
+uint32_t BinaryConfigImage::Crc32(const uint8_t* data, std::size_t size)
+{
+    static const auto table = [] {
+        std::vector<uint32_t> t(256U);
+        for (uint32_t i = 0; i < 256U; i++) {
+            uint32_t c = i;
+            for (int bit = 0; bit < 8; bit++) {
+                c = (c & 1U) ? (0xEDB88320U ^ (c >> 1U)) : (c >> 1U);
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFU;
+    for (std::size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFFU] ^ (crc >> 8U);
+    }
+    return crc ^ 0xFFFFFFFFU;
+}
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+std::vector<uint8_t> BinaryConfigImage::Build(
+    const std::string& name,
+    const config::TransitionRule* transitions, std::size_t transitionCount,
+    const config::ErrorRecoveryRule* recovery, std::size_t recoveryCount,
+    const config::StateHierarchyRule* hierarchy, std::size_t hierarchyCount,
+    const config::ActionListEntry* actionTable, std::size_t actionTableCount)
+{
+    // String pool with de-duplication
+    std::string pool;
+    auto intern = [&pool](const char* text) -> uint32_t {
+        if (text == nullptr) {
+            return kNoString;
+        }
+        const std::string needle(text, std::strlen(text) + 1U);
+        const std::size_t found = pool.find(needle);
+        if (found != std::string::npos && (found == 0U || pool[found - 1U] == '\0')) {
+            return static_cast<uint32_t>(found);
+        }
+        const auto offset = static_cast<uint32_t>(pool.size());
+        pool += needle;
+        return offset;
+    };
+
+    BinaryConfigHeader header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.headerSize = sizeof(BinaryConfigHeader);
+    header.nameOffset = intern(name.c_str());
+
+    std::vector<BinaryActionList> lists;
+    std::vector<BinaryActionItem> actions;
+    for (std::size_t i = 0; i < actionTableCount; i++) {
+        const auto& entry = actionTable[i];
+        lists.push_back({entry.state, static_cast<uint32_t>(actions.size()),
+                         static_cast<uint32_t>(entry.actionCount), entry.timeoutMs});
+        for (std::size_t a = 0; a < entry.actionCount; a++) {
+            const auto& action = entry.actions[a];
+            BinaryActionItem item{};
+            item.type = static_cast<uint8_t>(action.type);
+            item.targetOffset = intern(action.target);
+            item.paramOffset = intern(action.param);
+            item.sleepTimeMs = action.sleepTimeMs;
+            item.timeoutMs = action.timeoutMs;
+            item.dependsOn = action.dependsOn;
+            actions.push_back(item);
+        }
+    }
+
+    std::vector<uint8_t> image(sizeof(BinaryConfigHeader), 0U);
+    auto append = [&image](BinaryConfigSection& section, const void* data,
+                           std::size_t elementSize, std::size_t count) {
+        while (image.size() % 4U != 0U) {
+            image.push_back(0U);
+        }
+        section.offset = static_cast<uint32_t>(image.size());
+        section.count = static_cast<uint32_t>(count);
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if (count != 0U) {
+            image.insert(image.end(), bytes, bytes + elementSize * count);
+        }
+    };
+
+    append(header.transitions, transitions, sizeof(config::TransitionRule), transitionCount);
+    append(header.errorRecovery, recovery, sizeof(config::ErrorRecoveryRule), recoveryCount);
+    append(header.hierarchy, hierarchy, sizeof(config::StateHierarchyRule), hierarchyCount);
+    append(header.actionLists, lists.data(), sizeof(BinaryActionList), lists.size());
+    append(header.actions, actions.data(), sizeof(BinaryActionItem), actions.size());
+    append(header.strings, pool.data(), 1U, pool.size());
+    while (image.size() % 4U != 0U) {
+        image.push_back(0U);
+    }
+
+    header.imageSize = static_cast<uint32_t>(image.size());
+    header.crc32 = Crc32(image.data() + sizeof(BinaryConfigHeader),
+                         image.size() - sizeof(BinaryConfigHeader));
+    std::memcpy(image.data(), &header, sizeof(header));
+
+    return image;
+}
+
+Result BinaryConfigImage::WriteFile(const std::string& path, const std::vector<uint8_t>& image)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(image.data()),
+              static_cast<std::streamsize>(image.size()));
+    if (!out) {
+        std::cerr << "[BinaryConfig] Cannot write " << path << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+    return Result();
+}
+
+} // namespace sm
+} // namespace ara
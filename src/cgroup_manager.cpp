@@ -0,0 +1,257 @@
+#include "cgroup_manager.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+#if defined(__linux__)
+#define ARA_SM_CGROUP 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file cgroup_manager.cpp
+ * @brief cgroup v2 resource isolation of function groups
+ */
+
+namespace ara {
+namespace sm {
+
+using Result = CgroupManager::Result;
+
+#ifdef ARA_SM_CGROUP
+namespace {
+
+/**
+ * @brief Write an interface file of a cgroup
+ *
+ * @return 0, or errno (ENOENT: controller not enabled)
+ */
+int WriteFile(const std::string& path, const std::string& value)
+{
+    const int fd = ::open(path.c_str(), O_WRONLY | O_TRUNC | O_CLOEXEC);
+    if (fd < 0) {
+        return errno;
+    }
+    const ssize_t n = ::write(fd, value.data(), value.size());
+    const int error = n == static_cast<ssize_t>(value.size()) ? 0 : (n < 0 ? errno : EIO);
+    ::close(fd);
+    return error;
+}
+
+} // namespace
+#endif
+
+CgroupManager::CgroupManager(
+    const config::ResourceItem* resources,
+    std::size_t count,
+    std::string root)
+    : resources_(resources)
+    , resourceCount_(count)
+    , root_(std::move(root))
+{
+}
+
+CgroupManager::~CgroupManager()
+{
+#ifdef ARA_SM_CGROUP
+    // Only succeeds once the processes are gone
+    for (const auto& group : groups_) {
+        ::rmdir(GetPath(group.c_str()).c_str());
+    }
+    if (createdRoot_) {
+        ::rmdir(root_.c_str());
+    }
+#endif
+}
+
+// ============================================================================
+// Open
+// ============================================================================
+
+std::string CgroupManager::FindMount()
+{
+    std::ifstream mounts("/proc/self/mounts");
+    std::string line;
+    while (std::getline(mounts, line)) {
+        std::istringstream fields(line);
+        std::string device;
+        std::string mountPoint;
+        std::string type;
+        if (fields >> device >> mountPoint >> type && type == "cgroup2") {
+            return mountPoint;
+        }
+    }
+    return std::string();
+}
+
+Result CgroupManager::Open()
+{
+#ifdef ARA_SM_CGROUP
+    if (open_) {
+        return Result();
+    }
+
+    if (root_.empty()) {
+        const std::string mount = FindMount();
+        if (mount.empty()) {
+            std::cerr << "[Cgroup] No cgroup2 file system mounted" << std::endl;
+            return Result(StateManagementErrc::kOperationFailed);
+        }
+        root_ = mount + "/" + kRootName;
+    }
+
+    if (::mkdir(root_.c_str(), 0755) == 0) {
+        createdRoot_ = true;
+    } else if (errno != EEXIST) {
+        std::cerr << "[Cgroup] Cannot create " << root_ << ": "
+                  << std::strerror(errno) << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    // Controllers have to be enabled on every level down to the groups;
+    // unavailable ones are rejected and their files will be missing
+    const std::string parent = root_.substr(0, root_.find_last_of('/'));
+    for (const char* controller : {"+cpu", "+io", "+cpuset"}) {
+        WriteFile(parent + "/cgroup.subtree_control", controller);
+        WriteFile(root_ + "/cgroup.subtree_control", controller);
+    }
+
+    open_ = true;
+    return Result();
+#else
+    std::cerr << "[Cgroup] cgroup v2 is only available on Linux" << std::endl;
+    return Result(StateManagementErrc::kOperationFailed);
+#endif
+}
+
+// ============================================================================
+// Limits
+// ============================================================================
+
+/**
+ * @brief Write cpu.weight, io.weight and cpuset.cpus of a state
+ */
+Result CgroupManager::ApplyState(const char* functionGroup, const char* state)
+{
+    if (!open_ || functionGroup == nullptr || state == nullptr) {
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+#ifdef ARA_SM_CGROUP
+    if (!CreateGroup(functionGroup)) {
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    const config::ResourceItem* limits = FindLimits(functionGroup, state);
+    const uint16_t cpuWeight = limits != nullptr && limits->cpuWeight != 0U ? limits->cpuWeight : 100U;
+    const uint16_t ioWeight = limits != nullptr && limits->ioWeight != 0U ? limits->ioWeight : 100U;
+    const char* cpus = limits != nullptr && limits->cpus != nullptr ? limits->cpus : "";
+
+    const std::string path = GetPath(functionGroup);
+    const struct {
+        const char* file;
+        std::string value;
+    } writes[] = {
+        {"cpu.weight", std::to_string(cpuWeight)},
+        {"io.weight", "default " + std::to_string(ioWeight)},
+        {"cpuset.cpus", cpus},
+    };
+
+    bool ok = true;
+    for (const auto& w : writes) {
+        const int error = WriteFile(path + "/" + w.file, w.value);
+        if (error != 0 && error != ENOENT) {
+            std::cerr << "[Cgroup] " << functionGroup << ": " << w.file << "="
+                      << w.value << " rejected: " << std::strerror(error) << std::endl;
+            ok = false;
+        }
+    }
+
+    std::cout << "  [Cgroup] " << functionGroup << "/" << state
+              << ": cpu.weight=" << cpuWeight << " io.weight=" << ioWeight
+              << " cpus=" << (*cpus != '\0' ? cpus : "all") << std::endl;
+
+    return ok ? Result() : Result(StateManagementErrc::kOperationFailed);
+#else
+    return Result(StateManagementErrc::kOperationFailed);
+#endif
+}
+
+Result CgroupManager::Attach(const char* functionGroup, int pid)
+{
+    if (!open_ || functionGroup == nullptr) {
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+#ifdef ARA_SM_CGROUP
+    if (!CreateGroup(functionGroup)) {
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    const int error = WriteFile(GetPath(functionGroup) + "/cgroup.procs", std::to_string(pid));
+    if (error != 0) {
+        std::cerr << "[Cgroup] Cannot move pid " << pid << " to " << functionGroup
+                  << ": " << std::strerror(error) << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+    return Result();
+#else
+    (void)pid;
+    return Result(StateManagementErrc::kOperationFailed);
+#endif
+}
+
+const config::ResourceItem* CgroupManager::FindLimits(
+    const char* functionGroup,
+    const char* state) const
+{
+    const config::ResourceItem* group = nullptr;
+    for (std::size_t i = 0; i < resourceCount_; i++) {
+        const config::ResourceItem& item = resources_[i];
+        if (std::strcmp(item.functionGroup, functionGroup) != 0) {
+            continue;
+        }
+        if (item.state == nullptr) {
+            group = &item;
+        } else if (std::strcmp(item.state, state) == 0) {
+            return &item;
+        }
+    }
+    return group;
+}
+
+std::string CgroupManager::GetPath(const char* functionGroup) const
+{
+    return root_ + "/" + functionGroup;
+}
+
+bool CgroupManager::CreateGroup(const char* functionGroup)
+{
+#ifdef ARA_SM_CGROUP
+    for (const auto& group : groups_) {
+        if (group == functionGroup) {
+            return true;
+        }
+    }
+
+    const std::string path = GetPath(functionGroup);
+    if (::mkdir(path.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "[Cgroup] Cannot create " << path << ": "
+                  << std::strerror(errno) << std::endl;
+        return false;
+    }
+    groups_.emplace_back(functionGroup);
+    return true;
+#else
+    (void)functionGroup;
+    return false;
+#endif
+}
+
+} // namespace sm
+} // namespace ara
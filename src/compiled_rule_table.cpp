@@ -0,0 +1,362 @@
+#include "compiled_rule_table.h"
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @file compiled_rule_table.cpp
+ * @brief Compilation of hierarchical rule tables into flat lookup tables
+ *
+ * @req [SWS_SM_00603-00607], [SWS_SM_00601], [SWS_SM_CONSTR_00014]
+ */
+
+namespace ara {
+namespace sm {
+
+// ============================================================================
+// Factories
+// ============================================================================
+
+CompiledRuleTable CompiledRuleTable::FromTransitions(
+    const config::TransitionRule* rules,
+    std::size_t count,
+    const config::StateHierarchyRule* hierarchy,
+    std::size_t hierarchyCount)
+{
+    std::vector<Rule> normalized;
+    normalized.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        normalized.push_back({rules[i].fromState, rules[i].trigger,
+                              rules[i].toState, rules[i].guard});
+    }
+
+    return Compile(normalized, hierarchy, hierarchyCount, false, 0U);
+}
+
+CompiledRuleTable CompiledRuleTable::FromErrorRecovery(
+    const config::ErrorRecoveryRule* rules,
+    std::size_t count,
+    const config::StateHierarchyRule* hierarchy,
+    std::size_t hierarchyCount)
+{
+    std::vector<Rule> normalized;
+    normalized.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        normalized.push_back({rules[i].fromState, rules[i].errorCode,
+                              rules[i].toState, {0U, 0U}});
+    }
+
+    return Compile(normalized, hierarchy, hierarchyCount,
+                   true, config::kExecutionErrorAny);
+}
+
+// ============================================================================
+// Compile - flatten hierarchy into (state x key) matrix of candidate runs
+// ============================================================================
+
+CompiledRuleTable CompiledRuleTable::Compile(
+    const std::vector<Rule>& rules,
+    const config::StateHierarchyRule* hierarchy,
+    std::size_t hierarchyCount,
+    bool hasWildcard,
+    uint32_t wildcardKey)
+{
+    CompiledRuleTable table;
+    table.hasWildcard_ = hasWildcard;
+    table.wildcardKey_ = wildcardKey;
+
+    // Parent links (first entry for a child wins)
+    uint8_t parent[256];
+    std::fill(parent, parent + 256, kNoMatch);
+    for (std::size_t i = 0; i < hierarchyCount; i++) {
+        const uint8_t child = static_cast<uint8_t>(hierarchy[i].state);
+        if (parent[child] == kNoMatch) {
+            parent[child] = static_cast<uint8_t>(hierarchy[i].parentState);
+        }
+    }
+
+    // Rules grouped by owning state, configuration order preserved
+    std::vector<std::size_t> byState[256];
+    for (std::size_t i = 0; i < rules.size(); i++) {
+        byState[static_cast<uint8_t>(rules[i].fromState)].push_back(i);
+    }
+
+    // Rows: every state that owns rules or takes part in the hierarchy
+    auto addRow = [&table](uint8_t state) {
+        if (table.stateRow_[state] == 0U) {
+            table.rowStates_.push_back(state);
+            table.stateRow_[state] = static_cast<uint8_t>(table.rowStates_.size());
+        }
+    };
+    for (const auto& rule : rules) {
+        addRow(static_cast<uint8_t>(rule.fromState));
+    }
+    for (std::size_t i = 0; i < hierarchyCount; i++) {
+        addRow(static_cast<uint8_t>(hierarchy[i].state));
+        addRow(static_cast<uint8_t>(hierarchy[i].parentState));
+    }
+
+    // Columns: distinct non-wildcard keys
+    for (const auto& rule : rules) {
+        if (!(hasWildcard && rule.key == wildcardKey)) {
+            table.keys_.push_back(rule.key);
+        }
+    }
+    std::sort(table.keys_.begin(), table.keys_.end());
+    table.keys_.erase(std::unique(table.keys_.begin(), table.keys_.end()),
+                      table.keys_.end());
+
+    // Direct key -> column map when all keys are small
+    if (!table.keys_.empty() && table.keys_.back() < kDirectKeyLimit) {
+        table.keyColumn_.assign(table.keys_.back() + 1U, -1);
+        for (std::size_t i = 0; i < table.keys_.size(); i++) {
+            table.keyColumn_[table.keys_[i]] = static_cast<int16_t>(i);
+        }
+    }
+
+    const std::size_t columns = table.keys_.size();
+    table.cells_.assign(table.rowStates_.size() * columns, kNoCandidate);
+    table.catchAll_.assign(table.rowStates_.size(), kNoCandidate);
+
+    std::vector<std::vector<Candidate>> runs(columns);
+    std::vector<bool> closed(columns);
+
+    for (std::size_t row = 0; row < table.rowStates_.size(); row++) {
+        for (auto& run : runs) {
+            run.clear();
+        }
+        std::fill(closed.begin(), closed.end(), false);
+
+        std::vector<Candidate> catchAllRun;
+        uint8_t level = table.rowStates_[row];
+        std::size_t depth = 0;
+
+        while (level != kNoMatch && depth < kMaxHierarchyDepth) {
+            const Rule* any = nullptr;
+
+            // Exact rules of this level, in configuration order; the
+            // last wildcard of a level wins, as in the linear scan
+            for (const std::size_t index : byState[level]) {
+                const Rule& rule = rules[index];
+                if (hasWildcard && rule.key == wildcardKey) {
+                    any = &rule;
+                    continue;
+                }
+                const auto column = static_cast<std::size_t>(table.KeyColumn(rule.key));
+                if (!closed[column]) {
+                    runs[column].push_back({static_cast<uint8_t>(rule.toState), false, rule.guard});
+                    closed[column] = (rule.guard.allOf == 0U && rule.guard.noneOf == 0U);
+                }
+            }
+
+            // Wildcard of this level resolves everything still open
+            if (any != nullptr) {
+                const Candidate wildcard{static_cast<uint8_t>(any->toState), false, {0U, 0U}};
+                for (std::size_t column = 0; column < columns; column++) {
+                    if (!closed[column]) {
+                        runs[column].push_back(wildcard);
+                    }
+                }
+                catchAllRun.push_back(wildcard);
+                break;
+            }
+
+            level = parent[level];
+            depth++;
+        }
+
+        if (depth == kMaxHierarchyDepth) {
+            std::cerr << "[CompiledRuleTable] State hierarchy too deep or cyclic at state="
+                      << static_cast<int>(table.rowStates_[row]) << std::endl;
+        }
+
+        for (std::size_t column = 0; column < columns; column++) {
+            table.cells_[row * columns + column] = table.AppendRun(runs[column]);
+        }
+        table.catchAll_[row] = table.AppendRun(catchAllRun);
+    }
+
+    // Per-row key bitsets
+    const std::size_t words = (columns + 63U) / 64U;
+    table.keyMasks_.assign(table.rowStates_.size() * words, 0U);
+    for (std::size_t row = 0; row < table.rowStates_.size(); row++) {
+        for (std::size_t column = 0; column < columns; column++) {
+            if (table.cells_[row * columns + column] != kNoCandidate) {
+                table.keyMasks_[row * words + column / 64U] |= uint64_t{1} << (column % 64U);
+            }
+        }
+    }
+
+    return table;
+}
+
+uint32_t CompiledRuleTable::AppendRun(const std::vector<Candidate>& run)
+{
+    if (run.empty()) {
+        return kNoCandidate;
+    }
+
+    const auto first = static_cast<uint32_t>(candidates_.size());
+    candidates_.insert(candidates_.end(), run.begin(), run.end());
+    candidates_.back().last = true;
+    return first;
+}
+
+std::vector<CompiledRuleTable::Edge> CompiledRuleTable::GetEdges() const
+{
+    std::vector<Edge> edges;
+    const std::size_t columns = keys_.size();
+
+    for (std::size_t row = 0; row < rowStates_.size(); row++) {
+        for (std::size_t column = 0; column < columns; column++) {
+            std::size_t index = cells_[row * columns + column];
+            if (index == kNoCandidate) {
+                continue;
+            }
+            for (;;) {
+                const Candidate& candidate = candidates_[index];
+                edges.push_back({rowStates_[row], keys_[column], candidate.toState,
+                                 candidate.guard, candidate.last});
+                if (candidate.last) {
+                    break;
+                }
+                index++;
+            }
+        }
+    }
+
+    return edges;
+}
+
+std::vector<CompiledRuleTable::Edge> CompiledRuleTable::GetCatchAllEdges() const
+{
+    std::vector<Edge> edges;
+
+    for (std::size_t row = 0; row < rowStates_.size(); row++) {
+        const uint32_t index = catchAll_[row];
+        if (index != kNoCandidate) {
+            const Candidate& candidate = candidates_[index];
+            edges.push_back({rowStates_[row], wildcardKey_, candidate.toState,
+                             candidate.guard, true});
+        }
+    }
+
+    return edges;
+}
+
+// ============================================================================
+// Key sets
+// ============================================================================
+
+CompiledRuleTable::KeySet CompiledRuleTable::GetKeySet(uint8_t state) const
+{
+    KeySet set;
+    const uint8_t row = stateRow_[state];
+    if (row == 0U || keys_.empty()) {
+        return set;
+    }
+
+    const std::size_t words = (keys_.size() + 63U) / 64U;
+    set.table_ = this;
+    set.words_ = keyMasks_.data() + (row - 1U) * words;
+    set.bitCount_ = keys_.size();
+    return set;
+}
+
+CompiledRuleTable::KeySet CompiledRuleTable::KeySet::FromSortedKeys(
+    const uint32_t* keys, std::size_t count)
+{
+    KeySet set;
+    set.sortedKeys_ = keys;
+    set.sortedCount_ = count;
+    return set;
+}
+
+bool CompiledRuleTable::KeySet::Contains(uint32_t key) const
+{
+    if (sortedKeys_ != nullptr) {
+        return std::binary_search(sortedKeys_, sortedKeys_ + sortedCount_, key);
+    }
+    if (table_ == nullptr) {
+        return false;
+    }
+
+    const int index = table_->KeyColumn(key);
+    return index >= 0 && ContainsIndex(static_cast<std::size_t>(index));
+}
+
+std::size_t CompiledRuleTable::KeySet::Count() const
+{
+    if (sortedKeys_ != nullptr) {
+        return sortedCount_;
+    }
+
+    std::size_t count = 0U;
+    for (std::size_t i = 0; i < GetWordCount(); i++) {
+        count += static_cast<std::size_t>(__builtin_popcountll(words_[i]));
+    }
+    return count;
+}
+
+std::vector<uint32_t> CompiledRuleTable::KeySet::ToVector() const
+{
+    if (sortedKeys_ != nullptr) {
+        return std::vector<uint32_t>(sortedKeys_, sortedKeys_ + sortedCount_);
+    }
+
+    std::vector<uint32_t> keys;
+    for (std::size_t index = 0; index < bitCount_; index++) {
+        if (ContainsIndex(index)) {
+            keys.push_back(table_->keys_[index]);
+        }
+    }
+    return keys;
+}
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+int CompiledRuleTable::KeyColumn(uint32_t key) const
+{
+    if (!keyColumn_.empty()) {
+        return key < keyColumn_.size() ? keyColumn_[key] : -1;
+    }
+
+    const auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+    if (it == keys_.end() || *it != key) {
+        return -1;
+    }
+    return static_cast<int>(it - keys_.begin());
+}
+
+uint8_t CompiledRuleTable::Find(uint8_t state, uint32_t key,
+                                config::ConditionMask conditions) const
+{
+    const uint8_t row = stateRow_[state];
+    if (row == 0U) {
+        return kNoMatch;
+    }
+
+    const int column = KeyColumn(key);
+    std::size_t index = (column < 0)
+        ? catchAll_[row - 1U]
+        : cells_[(row - 1U) * keys_.size() + static_cast<std::size_t>(column)];
+
+    if (index == kNoCandidate) {
+        return kNoMatch;
+    }
+
+    for (;;) {
+        const Candidate& candidate = candidates_[index];
+        if (config::EvaluateGuard(candidate.guard, conditions)) {
+            return candidate.toState;
+        }
+        if (candidate.last) {
+            return kNoMatch;
+        }
+        index++;
+    }
+}
+
+} // namespace sm
+} // namespace ara
@@ -0,0 +1,152 @@
+#include "config_publisher.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+/**
+ * @file config_publisher.cpp
+ * @brief Epoch-based publication and reclamation of configuration snapshots
+ */
+
+namespace ara {
+namespace sm {
+
+// ============================================================================
+// Lifetime
+// ============================================================================
+
+ConfigPublisher::ConfigPublisher(std::unique_ptr<ConfigSnapshot> initial)
+{
+    Publish(std::move(initial));
+}
+
+ConfigPublisher::~ConfigPublisher() = default;
+
+// ============================================================================
+// Readers
+// ============================================================================
+
+ConfigPublisher::ReadGuard ConfigPublisher::Read()
+{
+    // Start probing at a per-thread slot so readers rarely collide
+    const std::size_t start =
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) % kReaderSlots;
+
+    for (;;) {
+        for (std::size_t i = 0; i < kReaderSlots; i++) {
+            const std::size_t slot = (start + i) % kReaderSlots;
+            uint64_t expected = kIdle;
+            const uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+
+            if (slots_[slot].epoch.compare_exchange_strong(
+                    expected, epoch, std::memory_order_seq_cst)) {
+                // Announced before the load: a writer that swapped after
+                // this point cannot free what we load
+                const ConfigSnapshot* snapshot = current_.load(std::memory_order_seq_cst);
+                return ReadGuard(this, slot, snapshot);
+            }
+        }
+        // All slots busy - wait for a read section to end
+        std::this_thread::yield();
+    }
+}
+
+void ConfigPublisher::Leave(std::size_t slot)
+{
+    slots_[slot].epoch.store(kIdle, std::memory_order_release);
+}
+
+ConfigPublisher::ReadGuard::ReadGuard(ReadGuard&& other) noexcept
+    : publisher_(other.publisher_)
+    , slot_(other.slot_)
+    , snapshot_(other.snapshot_)
+{
+    other.publisher_ = nullptr;
+    other.snapshot_ = nullptr;
+}
+
+ConfigPublisher::ReadGuard::~ReadGuard()
+{
+    if (publisher_ != nullptr) {
+        publisher_->Leave(slot_);
+    }
+}
+
+// ============================================================================
+// Writers
+// ============================================================================
+
+ara::core::Result<void, StateManagementErrc>
+ConfigPublisher::Publish(std::unique_ptr<ConfigSnapshot> snapshot)
+{
+    if (!snapshot || !snapshot->IsLoaded()) {
+        std::cerr << "[ConfigPublisher] Refusing to publish unloaded snapshot" << std::endl;
+        return ara::core::Result<void, StateManagementErrc>(StateManagementErrc::kInvalidValue);
+    }
+
+    std::lock_guard<std::mutex> lock(writerMutex_);
+
+    current_.store(snapshot.get(), std::memory_order_seq_cst);
+
+    // Readers announcing an epoch newer than this one load the new pointer
+    const uint64_t retireEpoch = epoch_.fetch_add(1U, std::memory_order_seq_cst);
+    if (owned_) {
+        retired_.push_back({retireEpoch, std::move(owned_)});
+    }
+    owned_ = std::move(snapshot);
+
+    std::cout << "[ConfigPublisher] Published '" << owned_->GetName()
+              << "' (epoch " << retireEpoch + 1U << ")" << std::endl;
+
+    ReclaimLocked();
+
+    return ara::core::Result<void, StateManagementErrc>();
+}
+
+ara::core::Result<void, StateManagementErrc>
+ConfigPublisher::Publish(const ConfigTables& tables)
+{
+    auto snapshot = std::make_unique<ConfigSnapshot>();
+    auto loaded = snapshot->Load(tables);
+    if (!loaded.HasValue()) {
+        return loaded;
+    }
+    return Publish(std::move(snapshot));
+}
+
+std::size_t ConfigPublisher::Reclaim()
+{
+    std::lock_guard<std::mutex> lock(writerMutex_);
+    return ReclaimLocked();
+}
+
+std::size_t ConfigPublisher::ReclaimLocked()
+{
+    // Oldest epoch any reader may still be using
+    uint64_t oldest = UINT64_MAX;
+    for (const auto& slot : slots_) {
+        const uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+        if (epoch != kIdle && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+
+    // A snapshot retired in epoch E is visible only to readers that
+    // announced E or earlier
+    retired_.erase(
+        std::remove_if(retired_.begin(), retired_.end(),
+                       [oldest](const Retired& retired) { return retired.epoch < oldest; }),
+        retired_.end());
+    return retired_.size();
+}
+
+std::size_t ConfigPublisher::GetRetiredCount() const
+{
+    std::lock_guard<std::mutex> lock(writerMutex_);
+    return retired_.size();
+}
+
+} // namespace sm
+} // namespace ara
@@ -0,0 +1,311 @@
+#include "config_snapshot.h"
+#include "binary_config.h"
+#include "config_validator.h"
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @file config_snapshot.cpp
+ * @brief Validation and compilation of reloadable table sets
+ */
+
+namespace ara {
+namespace sm {
+
+namespace {
+
+using Result = ara::core::Result<void, StateManagementErrc>;
+
+constexpr uint32_t kMaxStateId = 0xFEU;    // 0xFF is the kNoMatch sentinel
+
+Result Invalid(const char* reason, std::size_t index)
+{
+    std::cerr << "[ConfigSnapshot] Invalid config: " << reason
+              << " (entry " << index << ")" << std::endl;
+    return Result(StateManagementErrc::kInvalidValue);
+}
+
+} // namespace
+
+ConfigSnapshot::~ConfigSnapshot() = default;
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+Result ConfigSnapshot::Validate(const ConfigTables& tables)
+{
+    if ((tables.transitions == nullptr && tables.transitionCount != 0U) ||
+        (tables.errorRecovery == nullptr && tables.errorRecoveryCount != 0U) ||
+        (tables.hierarchy == nullptr && tables.hierarchyCount != 0U) ||
+        (tables.actionLists == nullptr && tables.actionListCount != 0U)) {
+        return Invalid("missing table", 0U);
+    }
+
+    for (std::size_t i = 0; i < tables.transitionCount; i++) {
+        const auto& rule = tables.transitions[i];
+        if (rule.fromState > kMaxStateId || rule.toState > kMaxStateId) {
+            return Invalid("transition state out of range", i);
+        }
+    }
+
+    for (std::size_t i = 0; i < tables.errorRecoveryCount; i++) {
+        const auto& rule = tables.errorRecovery[i];
+        if (rule.fromState > kMaxStateId || rule.toState > kMaxStateId) {
+            return Invalid("recovery state out of range", i);
+        }
+    }
+
+    uint8_t parent[256];
+    std::fill(parent, parent + 256, kNoMatch);
+    for (std::size_t i = 0; i < tables.hierarchyCount; i++) {
+        const auto& entry = tables.hierarchy[i];
+        if (entry.state > kMaxStateId || entry.parentState > kMaxStateId) {
+            return Invalid("hierarchy state out of range", i);
+        }
+        if (parent[entry.state] != kNoMatch) {
+            return Invalid("state has two parents", i);
+        }
+        parent[entry.state] = static_cast<uint8_t>(entry.parentState);
+    }
+
+    for (std::size_t i = 0; i < tables.hierarchyCount; i++) {
+        uint8_t level = static_cast<uint8_t>(tables.hierarchy[i].state);
+        std::size_t depth = 0U;
+        while (level != kNoMatch) {
+            if (++depth > CompiledRuleTable::kMaxHierarchyDepth) {
+                return Invalid("hierarchy cyclic or too deep", i);
+            }
+            level = parent[level];
+        }
+    }
+
+    bool hasList[256] = {};
+    for (std::size_t i = 0; i < tables.actionListCount; i++) {
+        const auto& entry = tables.actionLists[i];
+        if (entry.state > kMaxStateId) {
+            return Invalid("action list state out of range", i);
+        }
+        if (hasList[entry.state]) {
+            return Invalid("duplicate action list", i);
+        }
+        hasList[entry.state] = true;
+
+        if (entry.actions == nullptr && entry.actionCount != 0U) {
+            return Invalid("missing action array", i);
+        }
+        for (std::size_t a = 0; a < entry.actionCount; a++) {
+            if (entry.actions[a].type > config::ActionType::kSetNetworkHandle) {
+                return Invalid("unknown action type", i);
+            }
+        }
+        if (!ActionDependenciesValid(entry.actions, entry.actionCount)) {
+            return Invalid("bad action dependencies", i);
+        }
+    }
+
+    return Result();
+}
+
+// ============================================================================
+// Load
+// ============================================================================
+
+Result ConfigSnapshot::Load(const ConfigTables& tables)
+{
+    return LoadGenerated(tables, nullptr, nullptr);
+}
+
+Result ConfigSnapshot::LoadGenerated(
+    const ConfigTables& tables,
+    const PerfectHashTable* transitionHash,
+    const PerfectHashTable* recoveryHash)
+{
+    if (loaded_) {
+        return Result(StateManagementErrc::kOperationRejected);
+    }
+
+    auto valid = Validate(tables);
+    if (!valid.HasValue()) {
+        return valid;
+    }
+
+    // Deep copy, so the source tables may go away after Load()
+    transitionRules_.assign(tables.transitions, tables.transitions + tables.transitionCount);
+    recoveryRules_.assign(tables.errorRecovery, tables.errorRecovery + tables.errorRecoveryCount);
+    hierarchy_.assign(tables.hierarchy, tables.hierarchy + tables.hierarchyCount);
+
+    auto copyString = [this](const char* text) -> const char* {
+        if (text == nullptr) {
+            return nullptr;
+        }
+        strings_.emplace_back(text);
+        return strings_.back().c_str();
+    };
+
+    std::size_t actionCount = 0U;
+    for (std::size_t i = 0; i < tables.actionListCount; i++) {
+        actionCount += tables.actionLists[i].actionCount;
+    }
+    actions_.reserve(actionCount);
+
+    std::vector<config::ActionListEntry> lists;
+    lists.reserve(tables.actionListCount);
+    for (std::size_t i = 0; i < tables.actionListCount; i++) {
+        const auto& entry = tables.actionLists[i];
+        const std::size_t first = actions_.size();
+        for (std::size_t a = 0; a < entry.actionCount; a++) {
+            const auto& item = entry.actions[a];
+            actions_.push_back({item.type, copyString(item.target),
+                                copyString(item.param), item.sleepTimeMs, item.timeoutMs,
+                                item.dependsOn});
+        }
+        lists.push_back({entry.state, actions_.data() + first, entry.actionCount, entry.timeoutMs});
+    }
+
+    const ConfigTables owned{
+        tables.name,
+        transitionRules_.data(), transitionRules_.size(),
+        recoveryRules_.data(), recoveryRules_.size(),
+        hierarchy_.data(), hierarchy_.size(),
+        lists.data(), lists.size()
+    };
+    return Compile(owned, transitionHash, recoveryHash);
+}
+
+Result ConfigSnapshot::Load(std::shared_ptr<const BinaryConfigImage> image)
+{
+    if (loaded_) {
+        return Result(StateManagementErrc::kOperationRejected);
+    }
+    if (!image || !image->IsOpen()) {
+        return Invalid("image not open", 0U);
+    }
+
+    // Action items are copied per snapshot (the image has no arena or
+    // plan sections to use in place); their strings stay in the image
+    const BinaryActionList* binaryLists = image->GetActionLists();
+    std::size_t actionCount = 0U;
+    for (std::size_t i = 0; i < image->GetActionListCount(); i++) {
+        actionCount += binaryLists[i].actionCount;
+    }
+    actions_.reserve(actionCount);
+
+    std::vector<config::ActionListEntry> lists;
+    lists.reserve(image->GetActionListCount());
+    for (std::size_t i = 0; i < image->GetActionListCount(); i++) {
+        const BinaryActionList& entry = binaryLists[i];
+        const std::size_t first = actions_.size();
+        for (uint32_t a = 0; a < entry.actionCount; a++) {
+            actions_.push_back(image->GetAction(entry.firstAction + a));
+        }
+        lists.push_back({entry.state, actions_.data() + first, entry.actionCount, entry.timeoutMs});
+    }
+
+    const ConfigTables view{
+        image->GetName(),
+        image->GetTransitions(), image->GetTransitionCount(),
+        image->GetErrorRecovery(), image->GetErrorRecoveryCount(),
+        image->GetHierarchy(), image->GetHierarchyCount(),
+        lists.data(), lists.size()
+    };
+
+    auto valid = Validate(view);
+    if (!valid.HasValue()) {
+        actions_.clear();
+        return valid;
+    }
+
+    image_ = std::move(image);
+    return Compile(view);
+}
+
+// ============================================================================
+// Compile - matchers, key sets, planner and action index
+// ============================================================================
+
+Result ConfigSnapshot::Compile(
+    const ConfigTables& tables,
+    const PerfectHashTable* transitionHash,
+    const PerfectHashTable* recoveryHash)
+{
+    name_ = (tables.name != nullptr) ? tables.name : "";
+
+    // Tables generated at build time are served from their perfect hash
+    transitions_ = (transitionHash != nullptr)
+        ? RuleMatcher::FromPerfectHash(*transitionHash)
+        : RuleMatcher::FromTransitions(
+              tables.transitions, tables.transitionCount,
+              tables.hierarchy, tables.hierarchyCount);
+    recovery_ = (recoveryHash != nullptr)
+        ? RuleMatcher::FromPerfectHash(*recoveryHash)
+        : RuleMatcher::FromErrorRecovery(
+              tables.errorRecovery, tables.errorRecoveryCount,
+              tables.hierarchy, tables.hierarchyCount);
+
+    // Planner and allowed triggers come from the selected engine's own
+    // rules; without a dense matrix each state gets a sorted key run
+    // instead of a bitset row
+    allowedKeys_.clear();
+    allowedBegin_.clear();
+    if (transitions_.GetDenseTable() != nullptr) {
+        planner_ = TransitionPlanner::Build(*transitions_.GetDenseTable());
+    } else {
+        const std::vector<CompiledRuleTable::Edge> edges = transitions_.GetEdges();
+        planner_ = TransitionPlanner::Build(edges);
+
+        // Edges are ordered by state, then key
+        std::vector<uint32_t> counts(256U, 0U);
+        for (std::size_t i = 0; i < edges.size(); i++) {
+            if (i == 0U || edges[i].fromState != edges[i - 1U].fromState ||
+                edges[i].key != edges[i - 1U].key) {
+                allowedKeys_.push_back(edges[i].key);
+                counts[edges[i].fromState]++;
+            }
+        }
+        allowedBegin_.assign(257U, 0U);
+        for (std::size_t state = 0; state < 256U; state++) {
+            allowedBegin_[state + 1U] = allowedBegin_[state] + counts[state];
+        }
+    }
+
+    actionLists_.assign(tables.actionLists, tables.actionLists + tables.actionListCount);
+
+    // Pack all lists into one arena; the action path only sees symbol IDs
+    std::size_t actionCount = 0U;
+    for (const auto& entry : actionLists_) {
+        actionCount += entry.actionCount;
+    }
+    arena_.Reserve(actionCount);
+
+    std::vector<ActionSpan> spans(actionLists_.size());
+    for (std::size_t i = 0; i < actionLists_.size(); i++) {
+        const auto& entry = actionLists_[i];
+        if (!arena_.Append(entry.actions, entry.actionCount, symbols_, spans[i])) {
+            return Invalid("too many action names", i);
+        }
+        plans_.Add(arena_.Get(spans[i]), spans[i].length, entry.actions);
+        actionIndex_[static_cast<uint8_t>(entry.state)] = static_cast<uint16_t>(i + 1U);
+    }
+
+    resolvedLists_.reserve(actionLists_.size());
+    for (std::size_t i = 0; i < actionLists_.size(); i++) {
+        const auto& entry = actionLists_[i];
+        resolvedLists_.push_back({entry.state, arena_.Get(spans[i]),
+                                  entry.actions, entry.actionCount, &symbols_, plans_.Get(i),
+                                  entry.timeoutMs});
+    }
+
+    transitionCount_ = tables.transitionCount;
+    errorRecoveryCount_ = tables.errorRecoveryCount;
+    loaded_ = true;
+
+    std::cout << "[ConfigSnapshot] Loaded '" << name_ << "': "
+              << transitionCount_ << " transitions, "
+              << errorRecoveryCount_ << " recovery rules, "
+              << actionLists_.size() << " action lists" << std::endl;
+    return Result();
+}
+
+} // namespace sm
+} // namespace ara
@@ -1,61 +1,48 @@
 #include "error_recovery.h"
+#include "rule_matcher.h"
+#include "sm_perfect_hash_tables.h"
 #include "static_config.h"
 #include <iostream>
 
 namespace ara {
 namespace sm {
 
+const RuleMatcher& ErrorRecoveryTable::GetMatcher(
+    StateMachine::Category category)
+{
+    // Generated from static_config at build time (tools/perfect_hash_gen)
+    static const RuleMatcher controller =
+        RuleMatcher::FromPerfectHash(generated::kControllerRecoveryHash);
+
+    static const RuleMatcher agent =
+        RuleMatcher::FromPerfectHash(generated::kAgentRecoveryHash);
+
+    return (category == StateMachine::Category::kController) ? controller : agent;
+}
+
 uint8_t ErrorRecoveryTable::GetRecoveryState(
     uint8_t currentState,
     ExecutionErrorType errorCode,
     StateMachine::Category category)
 {
-    uint8_t catchAllRecovery = currentState; // Default: stay in current
-    
-    if (category == StateMachine::Category::kController) {
-        // Search for specific error match
-        for (size_t i = 0; i < config::kControllerErrorRecoveryCount; i++) {
-            const auto& rule = config::kControllerErrorRecovery[i];
-            
-            if (static_cast<uint8_t>(rule.fromState) == currentState) {
-                // Check for exact error match
-                if (rule.errorCode == errorCode) {
-                    std::cout << "[ErrorRecovery] Found exact match: state=" 
-                              << static_cast<int>(currentState)
-                              << " error=" << errorCode
-                              << " -> " << static_cast<int>(rule.toState) 
-                              << std::endl;
-                    return static_cast<uint8_t>(rule.toState);
-                }
-                
-                // Remember catch-all (ANY) rule
-                if (rule.errorCode == config::kExecutionErrorAny) {
-                    catchAllRecovery = static_cast<uint8_t>(rule.toState);
-                }
-            }
-        }
-    } else {
-        // Agent error recovery
-        for (size_t i = 0; i < config::kInfotainmentErrorRecoveryCount; i++) {
-            const auto& rule = config::kInfotainmentErrorRecovery[i];
-            
-            if (static_cast<uint8_t>(rule.fromState) == currentState) {
-                if (rule.errorCode == errorCode) {
-                    return static_cast<uint8_t>(rule.toState);
-                }
-                if (rule.errorCode == config::kExecutionErrorAny) {
-                    catchAllRecovery = static_cast<uint8_t>(rule.toState);
-                }
-            }
-        }
+    // Exact match and catch-all (ANY) rules, own and inherited, are
+    // resolved by the matcher
+    const uint8_t recovery = GetMatcher(category).Find(currentState, errorCode);
+    if (recovery != CompiledRuleTable::kNoMatch) {
+        std::cout << "[ErrorRecovery] Found recovery: state=" 
+                  << static_cast<int>(currentState)
+                  << " error=" << errorCode
+                  << " -> " << static_cast<int>(recovery) 
+                  << std::endl;
+        return recovery;
     }
     
-    // Use catch-all if no specific match found
-    std::cout << "[ErrorRecovery] Using catch-all recovery: -> " 
-              << static_cast<int>(catchAllRecovery) << std::endl;
+    // Default: stay in current state
+    std::cout << "[ErrorRecovery] No recovery rule, staying in state " 
+              << static_cast<int>(currentState) << std::endl;
     
-    return catchAllRecovery;
+    return currentState;
 }
 
 } // namespace sm
-} // namespace ara
\ No newline at end of file
+} // namespace ara
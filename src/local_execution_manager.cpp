@@ -0,0 +1,1052 @@
+#include "local_execution_manager.h"
+#include "cgroup_manager.h"
+#include "process_supervisor.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+
+#if defined(__linux__)
+#define ARA_SM_LOCAL_EM 1
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/epoll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
+
+/**
+ * @file local_execution_manager.cpp
+ * @brief Execution Management stand-in (posix_spawn, pidfd, epoll)
+ */
+
+namespace ara {
+namespace sm {
+
+using Result = LocalExecutionManager::Result;
+
+#ifdef ARA_SM_LOCAL_EM
+namespace {
+
+int RemainingMs(std::chrono::steady_clock::time_point deadline)
+{
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::steady_clock::duration::zero()) {
+        return 0;
+    }
+    // Round up, so a short remainder does not spin
+    return static_cast<int>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(remaining).count() + 1);
+}
+
+/// Move fd to minFd or above (close-on-exec), so dup2 onto the child fds cannot clobber it
+int MoveAbove(int fd, int minFd)
+{
+    if (fd < 0 || fd >= minFd) {
+        return fd;
+    }
+    const int moved = fcntl(fd, F_DUPFD_CLOEXEC, minFd);
+    ::close(fd);
+    return moved;
+}
+
+} // namespace
+#endif
+
+LocalExecutionManager::LocalExecutionManager(
+    const config::ProcessItem* processes,
+    std::size_t count,
+    std::chrono::milliseconds readyTimeout,
+    std::chrono::milliseconds stopTimeout)
+    : table_(processes)
+    , tableCount_(count)
+    , readyTimeout_(readyTimeout)
+    , stopTimeout_(stopTimeout)
+{
+    // Processes are identified by function group and name, whatever the state
+    itemProcesses_.resize(tableCount_);
+    for (std::size_t i = 0; i < tableCount_; i++) {
+        std::size_t first = 0U;
+        while (std::strcmp(table_[first].functionGroup, table_[i].functionGroup) != 0 ||
+               std::strcmp(table_[first].name, table_[i].name) != 0) {
+            first++;
+        }
+        itemProcesses_[i] = first;
+    }
+    InternTables();
+}
+
+LocalExecutionManager::~LocalExecutionManager()
+{
+    StopAll();
+#ifdef ARA_SM_LOCAL_EM
+    if (epollFd_ >= 0) {
+        ::close(epollFd_);
+    }
+#endif
+}
+
+// ============================================================================
+// Open
+// ============================================================================
+
+Result LocalExecutionManager::Open()
+{
+#ifdef ARA_SM_LOCAL_EM
+    if (epollFd_ >= 0) {
+        return Result();
+    }
+
+    const int probe = ProcessSupervisor::OpenPidfd(static_cast<int>(getpid()));
+    if (probe < 0) {
+        std::cerr << "[EM] pidfd_open not supported by this kernel" << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+    ::close(probe);
+
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd_ < 0) {
+        std::cerr << "[EM] epoll_create1 failed" << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    const std::string readyVar = std::string(kReadyFdEnv) + "=";
+    const std::string releaseVar = std::string(kReleaseFdEnv) + "=";
+    for (char** e = environ; e != nullptr && *e != nullptr; e++) {
+        if (std::strncmp(*e, readyVar.c_str(), readyVar.size()) != 0 &&
+            std::strncmp(*e, releaseVar.c_str(), releaseVar.size()) != 0) {
+            environment_.emplace_back(*e);
+        }
+    }
+    environment_.push_back(readyVar + std::to_string(kReadyFd));
+    releaseVar_ = releaseVar + std::to_string(kReleaseFd);
+
+    for (auto& entry : environment_) {
+        envp_.push_back(&entry[0]);
+    }
+    parkEnvp_ = envp_;
+    parkEnvp_.push_back(&releaseVar_[0]);
+    envp_.push_back(nullptr);
+    parkEnvp_.push_back(nullptr);
+
+    return Result();
+#else
+    std::cerr << "[EM] Local Execution Management is only available on Linux" << std::endl;
+    return Result(StateManagementErrc::kOperationFailed);
+#endif
+}
+
+// ============================================================================
+// Function Group state requests
+// ============================================================================
+
+/**
+ * @brief Stop the leaving processes of a function group, spawn the new ones
+ * @req [SWS_SM_00608] Function Group State action
+ */
+Result LocalExecutionManager::RequestFunctionGroupState(
+    const char* functionGroup,
+    const char* state)
+{
+    return RequestFunctionGroupState(InternSymbol(SymbolKind::kFunctionGroup, functionGroup),
+                                     InternSymbol(SymbolKind::kFunctionGroupState, state));
+}
+
+Result LocalExecutionManager::RequestFunctionGroupState(SymbolId functionGroup, SymbolId state)
+{
+    const char* fgName = GetSymbols().GetName(SymbolKind::kFunctionGroup, functionGroup);
+    const char* stateName = GetSymbols().GetName(SymbolKind::kFunctionGroupState, state);
+    if (epollFd_ < 0 || fgName == nullptr || stateName == nullptr) {
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    std::cout << "  [EM] SetFunctionGroupState: "
+              << fgName << " -> " << stateName << std::endl;
+
+    Reap();
+    // Unknown until the start finishes; a repeated request is issued again
+    SetFunctionGroupState(functionGroup, kNoSymbol);
+
+    auto inState = [&](std::size_t process) {
+        for (std::size_t i = 0; i < tableCount_; i++) {
+            if (itemGroups_[i] == functionGroup && itemStates_[i] == state &&
+                itemProcesses_[i] == process) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Processes not configured in the new state leave the function group
+    std::vector<Process> leaving;
+    auto keep = std::stable_partition(processes_.begin(), processes_.end(),
+        [&](const Process& p) {
+            const std::size_t index = IndexOf(p);
+            return itemGroups_[index] != functionGroup || inState(itemProcesses_[index]);
+        });
+    std::move(keep, processes_.end(), std::back_inserter(leaving));
+    processes_.erase(keep, processes_.end());
+    Stop(leaving);
+
+    // Limits of the new state hold for the kept processes as well
+    if (cgroups_ != nullptr) {
+        cgroups_->ApplyState(fgName, stateName);
+    }
+
+    const std::size_t start = starts_.size();
+    starts_.push_back({functionGroup, state, Clock::now(), Clock::now(), 0U, 0U, 0U});
+
+    for (std::size_t i = 0; i < tableCount_; i++) {
+        const config::ProcessItem& item = table_[i];
+        if (itemGroups_[i] != functionGroup || itemStates_[i] != state || IsRunning(i)) {
+            continue;
+        }
+
+        starts_[start].processCount++;
+        if (Release(item, start) || Spawn(item, start, false)) {
+            starts_[start].waiting++;
+        } else {
+            starts_[start].failedCount++;
+        }
+    }
+
+    // Parked processes no longer likely to be needed
+    const SymbolId next = GetNextState(functionGroup, state);
+    std::vector<Process> dropped;
+    auto stay = std::stable_partition(parked_.begin(), parked_.end(),
+        [&](const Process& p) {
+            const std::size_t index = IndexOf(p);
+            return itemGroups_[index] != functionGroup ||
+                   (next != kNoSymbol && itemStates_[index] == next);
+        });
+    std::move(stay, parked_.end(), std::back_inserter(dropped));
+    parked_.erase(stay, parked_.end());
+    Stop(dropped);
+
+    if (starts_[start].failedCount != 0U) {
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+    // Every process already running or one-shot
+    ConfirmFunctionGroupState(functionGroup);
+    return Result();
+}
+
+bool LocalExecutionManager::Spawn(const config::ProcessItem& item, std::size_t start, bool park)
+{
+#ifdef ARA_SM_LOCAL_EM
+    int pipeFds[2];
+    if (pipe2(pipeFds, O_CLOEXEC) != 0) {
+        std::cerr << "[EM] pipe2 failed for " << item.name << std::endl;
+        return false;
+    }
+
+    int releaseFds[2] = {-1, -1};
+    if (park && pipe2(releaseFds, O_CLOEXEC) != 0) {
+        ::close(pipeFds[0]);
+        ::close(pipeFds[1]);
+        std::cerr << "[EM] pipe2 failed for " << item.name << std::endl;
+        return false;
+    }
+
+    // Sources above the child fds: dup2 onto itself would keep FD_CLOEXEC
+    // set, and the first dup2 must not overwrite the source of the second
+    const int readFd = pipeFds[0];
+    const int writeFd = MoveAbove(pipeFds[1], kReleaseFd + 1);
+    const int releaseReadFd = MoveAbove(releaseFds[0], kReleaseFd + 1);
+    const int releaseFd = releaseFds[1];
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, writeFd, kReadyFd);
+    if (park) {
+        posix_spawn_file_actions_adddup2(&actions, releaseReadFd, kReleaseFd);
+    }
+
+    pid_t pid = -1;
+    const int rc = posix_spawn(&pid, item.argv[0], &actions, nullptr,
+                               const_cast<char* const*>(item.argv),
+                               park ? parkEnvp_.data() : envp_.data());
+    posix_spawn_file_actions_destroy(&actions);
+    ::close(writeFd);
+    if (park) {
+        ::close(releaseReadFd);
+    }
+
+    if (rc != 0) {
+        ::close(readFd);
+        if (park) {
+            ::close(releaseFd);
+        }
+        std::cerr << "[EM] Cannot spawn " << item.name << " (" << item.argv[0]
+                  << "): " << std::strerror(rc) << std::endl;
+        return false;
+    }
+
+    const int pidfd = ProcessSupervisor::OpenPidfd(static_cast<int>(pid));
+    if (pidfd < 0) {
+        ::close(readFd);
+        if (park) {
+            ::close(releaseFd);
+        }
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+        std::cerr << "[EM] pidfd_open failed for " << item.name << std::endl;
+        return false;
+    }
+
+    if (cgroups_ != nullptr) {
+        cgroups_->Attach(item.functionGroup, static_cast<int>(pid));
+    }
+
+    fcntl(readFd, F_SETFL, fcntl(readFd, F_GETFL) | O_NONBLOCK);
+
+    // A parked process has its readiness pipe watched from its release on
+    epoll_event event{};
+    event.events = EPOLLIN;
+    if (!park) {
+        event.data.fd = readFd;
+        epoll_ctl(epollFd_, EPOLL_CTL_ADD, readFd, &event);
+    }
+    event.data.fd = pidfd;
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, pidfd, &event);
+
+    if (park) {
+        parked_.push_back({&item, static_cast<int>(pid), pidfd, readFd, releaseFd, 0U, false, false});
+    } else {
+        processes_.push_back({&item, static_cast<int>(pid), pidfd, readFd, -1, start, true, false});
+    }
+    return true;
+#else
+    (void)item;
+    (void)start;
+    (void)park;
+    return false;
+#endif
+}
+
+// ============================================================================
+// Prelaunch
+// ============================================================================
+
+/**
+ * @brief Spawn the processes of a state with the release fd, without waiting
+ */
+Result LocalExecutionManager::Prelaunch(const char* functionGroup, const char* state)
+{
+    return Prelaunch(InternSymbol(SymbolKind::kFunctionGroup, functionGroup),
+                     InternSymbol(SymbolKind::kFunctionGroupState, state));
+}
+
+Result LocalExecutionManager::Prelaunch(SymbolId functionGroup, SymbolId state)
+{
+    if (epollFd_ < 0 || functionGroup == kNoSymbol || state == kNoSymbol) {
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    std::size_t count = 0U;
+    bool ok = true;
+    for (std::size_t i = 0; i < tableCount_; i++) {
+        const config::ProcessItem& item = table_[i];
+        if (itemGroups_[i] != functionGroup || itemStates_[i] != state ||
+            IsRunning(i) || IsParked(i)) {
+            continue;
+        }
+
+        if (Spawn(item, 0U, true)) {
+            count++;
+        } else {
+            ok = false;
+        }
+    }
+
+    if (count != 0U) {
+        std::cout << "  [EM] Prelaunched " << count << " processes for "
+                  << GetSymbols().GetName(SymbolKind::kFunctionGroup, functionGroup) << " -> "
+                  << GetSymbols().GetName(SymbolKind::kFunctionGroupState, state) << std::endl;
+    }
+    return ok ? Result() : Result(StateManagementErrc::kOperationFailed);
+}
+
+/**
+ * @brief Hand a parked process of the same name over to a start
+ *
+ * Closing the write end releases the process (EOF on kReleaseFd); unlike
+ * a write this cannot raise SIGPIPE if the process is already gone.
+ *
+ * @return false if no live process of that name is parked
+ */
+bool LocalExecutionManager::Release(const config::ProcessItem& item, std::size_t start)
+{
+#ifdef ARA_SM_LOCAL_EM
+    const std::size_t process = itemProcesses_[static_cast<std::size_t>(&item - table_)];
+    for (auto it = parked_.begin(); it != parked_.end(); ++it) {
+        if (it->exited || itemProcesses_[IndexOf(*it)] != process) {
+            continue;
+        }
+
+        Process process = *it;
+        parked_.erase(it);
+
+        ::close(process.releaseFd);
+        process.releaseFd = -1;
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = process.readyFd;
+        epoll_ctl(epollFd_, EPOLL_CTL_ADD, process.readyFd, &event);
+
+        process.item = &item;
+        process.start = start;
+        process.starting = true;
+        processes_.push_back(process);
+        return true;
+    }
+#else
+    (void)item;
+    (void)start;
+#endif
+    return false;
+}
+
+void LocalExecutionManager::SetPrelaunchTable(const config::PrelaunchItem* table, std::size_t count)
+{
+    prelaunchTable_ = table;
+    prelaunchCount_ = table != nullptr ? count : 0U;
+    InternTables();
+}
+
+SymbolId LocalExecutionManager::GetNextState(SymbolId functionGroup, SymbolId state) const
+{
+    for (std::size_t i = 0; i < prelaunchCount_; i++) {
+        if (prelaunchGroups_[i] == functionGroup && prelaunchFrom_[i] == state) {
+            return prelaunchNext_[i];
+        }
+    }
+    return kNoSymbol;
+}
+
+void LocalExecutionManager::PrelaunchNext(SymbolId functionGroup, SymbolId state)
+{
+    const SymbolId next = GetNextState(functionGroup, state);
+    if (next != kNoSymbol) {
+        Prelaunch(functionGroup, next);
+    }
+}
+
+void LocalExecutionManager::DropPrelaunched()
+{
+    Stop(parked_);
+    parked_.clear();
+}
+
+// ============================================================================
+// Readiness
+// ============================================================================
+
+/**
+ * @brief Collect readiness of every process started since the last call
+ * @req [SWS_SM_00610] SYNC waits for previously issued actions
+ */
+Result LocalExecutionManager::WaitReady()
+{
+    return WaitReady(Clock::now() + readyTimeout_);
+}
+
+Result LocalExecutionManager::WaitReady(Clock::time_point deadline)
+{
+    if (starts_.empty()) {
+        return Result();
+    }
+
+#ifdef ARA_SM_LOCAL_EM
+    auto waiting = [this]() {
+        std::size_t count = 0U;
+        for (const auto& s : starts_) {
+            count += s.waiting;
+        }
+        return count;
+    };
+
+    epoll_event events[16];
+
+    while (waiting() != 0U) {
+        const int timeoutMs = RemainingMs(deadline);
+        if (timeoutMs == 0) {
+            break;
+        }
+
+        const int n = epoll_wait(epollFd_, events, 16, timeoutMs);
+        if (n < 0 && errno != EINTR) {
+            std::cerr << "[EM] epoll_wait failed" << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < n; i++) {
+            HandleEvent(events[i].data.fd);
+        }
+    }
+#endif
+
+    // Still starting: timed out (left running)
+    for (auto& process : processes_) {
+        if (process.starting) {
+            std::cerr << "[EM] " << process.item->name << " not ready in time" << std::endl;
+            OnReady(process, false);
+        }
+    }
+
+    processes_.erase(std::remove_if(processes_.begin(), processes_.end(),
+                                    [](const Process& p) { return p.exited; }),
+                     processes_.end());
+
+    bool ok = true;
+    for (const auto& s : starts_) {
+        const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(s.end - s.begin);
+        const char* fgName = GetSymbols().GetName(SymbolKind::kFunctionGroup, s.functionGroup);
+        const char* stateName = GetSymbols().GetName(SymbolKind::kFunctionGroupState, s.state);
+        reports_.push_back({fgName, stateName, s.processCount, s.failedCount, latency});
+
+        std::cout << "  [EM] " << fgName << " -> " << stateName << ": "
+                  << s.processCount << " processes in " << latency.count() << "us";
+        if (s.failedCount != 0U) {
+            std::cout << " (" << s.failedCount << " failed)";
+        }
+        std::cout << std::endl;
+
+        ok = ok && s.failedCount == 0U;
+    }
+
+    // Off the critical path: the states just reached are up
+    for (const auto& s : starts_) {
+        if (s.failedCount == 0U) {
+            PrelaunchNext(s.functionGroup, s.state);
+        }
+    }
+    starts_.clear();
+
+    return ok ? Result() : Result(StateManagementErrc::kTransitionFailed);
+}
+
+/**
+ * @brief Take pending exits and readiness without waiting
+ *
+ * Reaps processes that terminated after they became ready, so a
+ * crashed process is started again by the next request of its state.
+ */
+void LocalExecutionManager::Reap()
+{
+#ifdef ARA_SM_LOCAL_EM
+    if (epollFd_ < 0) {
+        return;
+    }
+
+    epoll_event events[16];
+    int n;
+    do {
+        n = epoll_wait(epollFd_, events, 16, 0);
+        for (int i = 0; i < n; i++) {
+            HandleEvent(events[i].data.fd);
+        }
+    } while (n == 16);
+
+    if (starts_.empty()) {
+        processes_.erase(std::remove_if(processes_.begin(), processes_.end(),
+                                        [](const Process& p) { return p.exited; }),
+                         processes_.end());
+    }
+#endif
+}
+
+void LocalExecutionManager::HandleEvent(int fd)
+{
+#ifdef ARA_SM_LOCAL_EM
+    // Only the pidfd of a parked process is watched
+    for (auto it = parked_.begin(); it != parked_.end(); ++it) {
+        if (it->pidfd == fd) {
+            OnExit(*it);
+            parked_.erase(it);
+            return;
+        }
+    }
+
+    Process* process = FindByFd(fd);
+    if (process == nullptr) {
+        return;
+    }
+
+    if (fd == process->pidfd) {
+        OnExit(*process);
+        return;
+    }
+
+    char byte = 0;
+    const ssize_t r = ::read(fd, &byte, 1);
+    if (r == 1) {
+        OnReady(*process, true);
+    } else if (r == 0) {
+        // Closed without a byte: the exit status decides
+        epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+        ::close(fd);
+        process->readyFd = -1;
+    }
+#else
+    (void)fd;
+#endif
+}
+
+void LocalExecutionManager::OnReady(Process& process, bool ok)
+{
+    if (!process.starting) {
+        return;
+    }
+    process.starting = false;
+
+    PendingStart& start = starts_[process.start];
+    start.waiting--;
+    start.end = Clock::now();
+    if (!ok) {
+        start.failedCount++;
+    } else if (supervisor_ != nullptr && !process.exited) {
+        supervisor_->Watch(process.pid, process.item->functionGroup, process.item->name, owner_);
+    }
+    if (start.waiting == 0U) {
+        ConfirmFunctionGroupState(start.functionGroup);
+    }
+
+#ifdef ARA_SM_LOCAL_EM
+    if (process.readyFd >= 0) {
+        epoll_ctl(epollFd_, EPOLL_CTL_DEL, process.readyFd, nullptr);
+        ::close(process.readyFd);
+        process.readyFd = -1;
+    }
+#endif
+}
+
+void LocalExecutionManager::OnExit(Process& process)
+{
+#ifdef ARA_SM_LOCAL_EM
+    siginfo_t info{};
+    waitid(P_PID, static_cast<id_t>(process.pid), &info, WEXITED);
+    const bool exitedOk = info.si_code == CLD_EXITED && info.si_status == 0;
+
+    process.exited = true;
+    if (supervisor_ != nullptr) {
+        // Status is gone once reaped; the supervisor still reports the exit
+        supervisor_->SetExitStatus(process.pid, info.si_code, info.si_status);
+    }
+
+    if (process.starting) {
+        // Ready byte and exit can arrive in the same epoll batch
+        char byte = 0;
+        const bool wroteReady = process.readyFd >= 0 && ::read(process.readyFd, &byte, 1) == 1;
+        OnReady(process, wroteReady || exitedOk);
+    } else {
+        if (!exitedOk) {
+            std::cerr << "[EM] " << process.item->name << " terminated unexpectedly" << std::endl;
+        }
+        // The group is no longer in its state; the next request restarts it
+        if (process.releaseFd < 0) {
+            SetFunctionGroupState(itemGroups_[IndexOf(process)], kNoSymbol);
+        }
+    }
+#else
+    process.exited = true;
+#endif
+
+    CloseFds(process);
+}
+
+/**
+ * @brief Record the state of a function group once its starts are done
+ *
+ * Kept processes of an earlier start belong to the new state as well,
+ * so every pending start of the group must have finished without a
+ * failure; the latest one holds the state reached.
+ */
+void LocalExecutionManager::ConfirmFunctionGroupState(SymbolId functionGroup)
+{
+    const PendingStart* latest = nullptr;
+    for (const auto& s : starts_) {
+        if (s.functionGroup != functionGroup) {
+            continue;
+        }
+        if (s.waiting != 0U || s.failedCount != 0U) {
+            return;
+        }
+        latest = &s;
+    }
+    if (latest != nullptr) {
+        SetFunctionGroupState(functionGroup, latest->state);
+    }
+}
+
+// ============================================================================
+// Stop
+// ============================================================================
+
+/**
+ * @brief SIGTERM all, then reap each (SIGKILL after stopTimeout)
+ */
+void LocalExecutionManager::Stop(std::vector<Process>& processes)
+{
+#ifdef ARA_SM_LOCAL_EM
+    for (const auto& process : processes) {
+        if (!process.exited) {
+            if (supervisor_ != nullptr) {
+                supervisor_->Unwatch(process.pid);
+            }
+            kill(process.pid, SIGTERM);
+        }
+    }
+
+    const auto deadline = Clock::now() + stopTimeout_;
+    for (auto& process : processes) {
+        if (process.starting) {
+            // Left before it became ready; not counted as failed
+            process.starting = false;
+            PendingStart& start = starts_[process.start];
+            start.waiting--;
+            start.end = Clock::now();
+        }
+        if (process.exited) {
+            continue;
+        }
+
+        pollfd pfd{process.pidfd, POLLIN, 0};
+        if (poll(&pfd, 1, RemainingMs(deadline)) <= 0) {
+            kill(process.pid, SIGKILL);
+        }
+        waitpid(process.pid, nullptr, 0);
+        process.exited = true;
+        CloseFds(process);
+
+        std::cout << "  [EM] Stopped " << process.item->functionGroup << "/"
+                  << process.item->name << std::endl;
+    }
+#else
+    (void)processes;
+#endif
+}
+
+void LocalExecutionManager::StopAll()
+{
+    Stop(processes_);
+    processes_.clear();
+    DropPrelaunched();
+    InvalidateFunctionGroupStates();
+}
+
+void LocalExecutionManager::CloseFds(Process& process)
+{
+#ifdef ARA_SM_LOCAL_EM
+    for (int* fd : {&process.readyFd, &process.pidfd, &process.releaseFd}) {
+        if (*fd >= 0) {
+            epoll_ctl(epollFd_, EPOLL_CTL_DEL, *fd, nullptr);
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+#else
+    (void)process;
+#endif
+}
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+bool LocalExecutionManager::IsRunning(std::size_t index) const
+{
+    for (const auto& process : processes_) {
+        if (!process.exited && itemProcesses_[IndexOf(process)] == itemProcesses_[index]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LocalExecutionManager::IsParked(std::size_t index) const
+{
+    for (const auto& process : parked_) {
+        if (!process.exited && itemProcesses_[IndexOf(process)] == itemProcesses_[index]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LocalExecutionManager::IsRunning(const char* functionGroup, const char* name) const
+{
+    for (const auto& process : processes_) {
+        if (!process.exited &&
+            std::strcmp(process.item->functionGroup, functionGroup) == 0 &&
+            std::strcmp(process.item->name, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LocalExecutionManager::IsParked(const char* functionGroup, const char* name) const
+{
+    for (const auto& process : parked_) {
+        if (!process.exited &&
+            std::strcmp(process.item->functionGroup, functionGroup) == 0 &&
+            std::strcmp(process.item->name, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int LocalExecutionManager::GetPid(const char* functionGroup, const char* name) const
+{
+    for (const auto& process : processes_) {
+        if (!process.exited &&
+            std::strcmp(process.item->functionGroup, functionGroup) == 0 &&
+            std::strcmp(process.item->name, name) == 0) {
+            return process.pid;
+        }
+    }
+    return -1;
+}
+
+void LocalExecutionManager::SetSupervisor(ProcessSupervisor* supervisor, StateMachine* owner)
+{
+    supervisor_ = supervisor;
+    owner_ = owner;
+}
+
+LocalExecutionManager::Process* LocalExecutionManager::FindByFd(int fd)
+{
+    for (auto& process : processes_) {
+        if (process.pidfd == fd || process.readyFd == fd) {
+            return &process;
+        }
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// IActionExecutor
+// ============================================================================
+
+/**
+ * @brief SYNC: wait for the started processes, bounded by the action
+ *        timeout, readyTimeout and the list deadline
+ */
+Result LocalExecutionManager::WaitBarrier(uint32_t timeoutMs)
+{
+    // Network Management works while the processes start
+    auto result = FlushNetworkRequests();
+    const auto deadline = std::min(GetWaitDeadline(timeoutMs), Clock::now() + readyTimeout_);
+    if (!WaitReady(deadline).HasValue()) {
+        return Result(StateManagementErrc::kTransitionFailed);
+    }
+    return result;
+}
+
+/**
+ * @brief SetFunctionGroupState action, unless the state is already reached
+ */
+Result LocalExecutionManager::IssueFunctionGroupState(SymbolId functionGroup, SymbolId state)
+{
+    if (ElideFunctionGroupState(functionGroup, state)) {
+        return Result();
+    }
+    RecordCompensation(config::ActionType::kSetFunctionGroupState, functionGroup,
+                       GetFunctionGroupState(functionGroup));
+    return RequestFunctionGroupState(functionGroup, state);
+}
+
+Result LocalExecutionManager::FinishList()
+{
+    auto result = ActionExecutor::FinishList();
+    auto ready = WaitBarrier(0U);
+    return result.HasValue() ? ready : result;
+}
+
+bool LocalExecutionManager::IsActionDone(const PackedAction& action, const SymbolTable& symbols)
+{
+    if (action.type != config::ActionType::kSetFunctionGroupState) {
+        return ActionExecutor::IsActionDone(action, symbols);
+    }
+
+    // Latest start of the group; none if the request was elided
+    for (auto it = starts_.rbegin(); it != starts_.rend(); ++it) {
+        if (it->functionGroup == action.target) {
+            return it->waiting == 0U && it->failedCount == 0U;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Take readiness until one more start finishes (or until)
+ *
+ * Starts pending for readyTimeout fail; reports are left to WaitReady()
+ * at the end of the list.
+ */
+Result LocalExecutionManager::WaitForActions(Clock::time_point until)
+{
+    auto finished = [this]() {
+        std::size_t count = 0U;
+        for (const auto& s : starts_) {
+            count += s.waiting == 0U ? 1U : 0U;
+        }
+        return count;
+    };
+    auto failed = [this]() {
+        return std::any_of(starts_.begin(), starts_.end(), [](const PendingStart& s) {
+            return s.waiting == 0U && s.failedCount != 0U;
+        });
+    };
+
+    // A start that failed since the last call (e.g. found by Reap())
+    if (failed()) {
+        return Result(StateManagementErrc::kTransitionFailed);
+    }
+    const std::size_t before = finished();
+    if (before == starts_.size()) {
+        return ActionExecutor::WaitForActions(until);
+    }
+
+#ifdef ARA_SM_LOCAL_EM
+    Clock::time_point expiry = Clock::time_point::max();
+    for (const auto& s : starts_) {
+        if (s.waiting != 0U) {
+            expiry = std::min(expiry, s.begin + readyTimeout_);
+        }
+    }
+    const auto deadline = std::min(until, expiry);
+
+    epoll_event events[16];
+    while (finished() == before) {
+        const int timeoutMs = RemainingMs(deadline);
+        if (timeoutMs == 0) {
+            break;
+        }
+
+        const int n = epoll_wait(epollFd_, events, 16, timeoutMs);
+        if (n < 0 && errno != EINTR) {
+            std::cerr << "[EM] epoll_wait failed" << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < n; i++) {
+            HandleEvent(events[i].data.fd);
+        }
+    }
+
+    const auto now = Clock::now();
+    for (auto& process : processes_) {
+        if (process.starting && now >= starts_[process.start].begin + readyTimeout_) {
+            std::cerr << "[EM] " << process.item->name << " not ready in time" << std::endl;
+            OnReady(process, false);
+        }
+    }
+#endif
+
+    return failed() ? Result(StateManagementErrc::kTransitionFailed) : Result();
+}
+
+Result LocalExecutionManager::ExecuteAction(const config::ActionItem& action)
+{
+    if (action.type == config::ActionType::kSetFunctionGroupState) {
+        // Terminations since the last request invalidate the cached state
+        Reap();
+        return IssueFunctionGroupState(InternSymbol(SymbolKind::kFunctionGroup, action.target),
+                                       InternSymbol(SymbolKind::kFunctionGroupState, action.param));
+    }
+    if (action.type == config::ActionType::kSync) {
+        auto result = WaitBarrier(action.timeoutMs);
+        if (!result.HasValue()) {
+            return result;
+        }
+    }
+    return ActionExecutor::ExecuteAction(action);
+}
+
+/**
+ * @brief Spawn the processes of every function group of the batch at once
+ */
+Result LocalExecutionManager::ExecuteActionBatch(const ActionBatch& batch)
+{
+    if (batch.group != ActionGroup::kSetFunctionGroupState) {
+        return ActionExecutor::ExecuteActionBatch(batch);
+    }
+
+    BindSymbols(*batch.symbols);
+    Reap();
+    for (std::size_t i = 0; i < batch.count; i++) {
+        auto result = IssueFunctionGroupState(batch.actions[i].target, batch.actions[i].GetParam());
+        if (!result.HasValue()) {
+            return result;
+        }
+    }
+    return Result();
+}
+
+// ============================================================================
+// Symbols
+// ============================================================================
+
+/**
+ * @brief Look up the names of the process and prelaunch tables once
+ */
+void LocalExecutionManager::InternTables()
+{
+    itemGroups_.resize(tableCount_);
+    itemStates_.resize(tableCount_);
+    for (std::size_t i = 0; i < tableCount_; i++) {
+        itemGroups_[i] = InternSymbol(SymbolKind::kFunctionGroup, table_[i].functionGroup);
+        itemStates_[i] = InternSymbol(SymbolKind::kFunctionGroupState, table_[i].state);
+    }
+
+    prelaunchGroups_.resize(prelaunchCount_);
+    prelaunchFrom_.resize(prelaunchCount_);
+    prelaunchNext_.resize(prelaunchCount_);
+    for (std::size_t i = 0; i < prelaunchCount_; i++) {
+        prelaunchGroups_[i] = InternSymbol(SymbolKind::kFunctionGroup, prelaunchTable_[i].functionGroup);
+        prelaunchFrom_[i] = InternSymbol(SymbolKind::kFunctionGroupState, prelaunchTable_[i].fromState);
+        prelaunchNext_[i] = InternSymbol(SymbolKind::kFunctionGroupState, prelaunchTable_[i].nextState);
+    }
+}
+
+void LocalExecutionManager::OnSymbolsBound(const SymbolTable& previous)
+{
+    ActionExecutor::OnSymbolsBound(previous);
+    InternTables();
+    for (auto& s : starts_) {
+        s.functionGroup = InternSymbol(SymbolKind::kFunctionGroup,
+                                       previous.GetName(SymbolKind::kFunctionGroup, s.functionGroup));
+        s.state = InternSymbol(SymbolKind::kFunctionGroupState,
+                               previous.GetName(SymbolKind::kFunctionGroupState, s.state));
+    }
+}
+
+Result LocalExecutionManager::ExecuteSegmentBarrier(uint32_t sleepMs, bool sync, uint32_t timeoutMs)
+{
+    if (sleepMs != 0U) {
+        auto result = ActionExecutor::ExecuteSegmentBarrier(sleepMs, false, 0U);
+        if (!result.HasValue()) {
+            return result;
+        }
+    }
+    if (!sync) {
+        return Result();
+    }
+    auto result = WaitBarrier(timeoutMs);
+    if (!result.HasValue()) {
+        return result;
+    }
+    return ActionExecutor::ExecuteSegmentBarrier(0U, true, timeoutMs);
+}
+
+} // namespace sm
+} // namespace ara
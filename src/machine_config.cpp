@@ -0,0 +1,104 @@
+#include "machine_config.h"
+#include "binary_config.h"
+#include "static_config.h"
+#include "sm_perfect_hash_tables.h"
+#include <iostream>
+
+/**
+ * @file machine_config.cpp
+ * @brief Per-machine table sets
+ */
+
+namespace ara {
+namespace sm {
+
+// ============================================================================
+// Load
+// ============================================================================
+
+ara::core::Result<void, StateManagementErrc>
+MachineConfig::Load(const ConfigTables& tables)
+{
+    auto snapshot = std::make_unique<ConfigSnapshot>();
+    auto result = snapshot->Load(tables);
+    if (!result.HasValue()) {
+        return result;
+    }
+    return Publish(std::move(snapshot));
+}
+
+ara::core::Result<void, StateManagementErrc>
+MachineConfig::Load(std::shared_ptr<const BinaryConfigImage> image)
+{
+    auto snapshot = std::make_unique<ConfigSnapshot>();
+    auto result = snapshot->Load(std::move(image));
+    if (!result.HasValue()) {
+        return result;
+    }
+    return Publish(std::move(snapshot));
+}
+
+ara::core::Result<void, StateManagementErrc>
+MachineConfig::LoadFile(const std::string& path)
+{
+    auto image = std::make_shared<BinaryConfigImage>();
+    auto result = image->Open(path);
+    if (!result.HasValue()) {
+        return result;
+    }
+    return Load(std::shared_ptr<const BinaryConfigImage>(std::move(image)));
+}
+
+ara::core::Result<void, StateManagementErrc>
+MachineConfig::Publish(std::unique_ptr<ConfigSnapshot> snapshot)
+{
+    auto result = publisher_.Publish(std::move(snapshot));
+    if (result.HasValue()) {
+        loaded_ = true;
+    }
+    return result;
+}
+
+// ============================================================================
+// Built-in configurations
+// ============================================================================
+
+MachineConfig* MachineConfig::LoadBuiltIn(
+    MachineConfig& config,
+    const ConfigTables& tables,
+    const PerfectHashTable& transitionHash,
+    const PerfectHashTable& recoveryHash)
+{
+    auto snapshot = std::make_unique<ConfigSnapshot>();
+    if (!snapshot->LoadGenerated(tables, &transitionHash, &recoveryHash).HasValue() ||
+        !config.Publish(std::move(snapshot)).HasValue()) {
+        std::cerr << "[MachineConfig] Static config rejected: " << tables.name << std::endl;
+    }
+    return &config;
+}
+
+MachineConfig& MachineConfig::GetDefault(StateMachine::Category category)
+{
+    static MachineConfig controllerConfig;
+    static MachineConfig* controller = LoadBuiltIn(controllerConfig, {
+        "Controller",
+        config::kControllerTransitions, config::kControllerTransitionsCount,
+        config::kControllerErrorRecovery, config::kControllerErrorRecoveryCount,
+        config::kControllerStateHierarchy, config::kControllerStateHierarchyCount,
+        config::kActionTable, config::kActionTableCount},
+        generated::kControllerTransitionHash, generated::kControllerRecoveryHash);
+
+    static MachineConfig agentConfig;
+    static MachineConfig* agent = LoadBuiltIn(agentConfig, {
+        "Agent",
+        config::kInfotainmentTransitions, config::kInfotainmentTransitionsCount,
+        config::kInfotainmentErrorRecovery, config::kInfotainmentErrorRecoveryCount,
+        config::kInfotainmentStateHierarchy, config::kInfotainmentStateHierarchyCount,
+        config::kInfotainmentActionTable, config::kInfotainmentActionTableCount},
+        generated::kAgentTransitionHash, generated::kAgentRecoveryHash);
+
+    return (category == StateMachine::Category::kController) ? *controller : *agent;
+}
+
+} // namespace sm
+} // namespace ara
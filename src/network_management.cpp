@@ -0,0 +1,354 @@
+#include "network_management.h"
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#if defined(__linux__)
+#define ARA_SM_LOCAL_NM 1
+#include <cerrno>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file network_management.cpp
+ * @brief Network Management stand-in and cached/batched client
+ */
+
+namespace ara {
+namespace sm {
+
+namespace {
+
+constexpr const char* kFullCom = "FullCom";
+constexpr const char* kNoCom = "NoCom";
+constexpr const char* kReplyOk = "OK";
+constexpr const char* kReplyError = "ERR";
+constexpr std::size_t kMaxTag = 12U;    // "#<uint32>\n"
+
+const char* StateName(NmStateRequestEnum state)
+{
+    return state == NmStateRequestEnum::kFullCom ? kFullCom : kNoCom;
+}
+
+#ifdef ARA_SM_LOCAL_NM
+/**
+ * @brief Wait for the reply tagged with a request's sequence number
+ *
+ * Replies with another tag answer requests that already timed out and
+ * are dropped, so they cannot be taken for the answer to this one.
+ *
+ * @return true for "OK <tag>", false for "ERR <tag>", an error or timeout
+ */
+bool AwaitReply(int fd, const std::string& tag, std::chrono::milliseconds timeout)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    const std::string ok = std::string(kReplyOk) + " " + tag;
+    const std::string error = std::string(kReplyError) + " " + tag;
+
+    for (;;) {
+        const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        pollfd pfd{fd, POLLIN, 0};
+        if (left.count() < 0 || poll(&pfd, 1, static_cast<int>(left.count())) != 1) {
+            return false;
+        }
+
+        char buffer[32];
+        const ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+            return false;
+        }
+        const std::string reply(buffer, static_cast<std::size_t>(n));
+        if (reply == ok || reply == error) {
+            return reply == ok;
+        }
+        std::cout << "  [NM] Dropped late reply: " << reply << std::endl;
+    }
+}
+#endif
+
+} // namespace
+
+// ============================================================================
+// LocalNetworkManager
+// ============================================================================
+
+LocalNetworkManager::~LocalNetworkManager()
+{
+    Close();
+}
+
+LocalNetworkManager::Result LocalNetworkManager::Open()
+{
+#ifdef ARA_SM_LOCAL_NM
+    if (serverFd_ >= 0) {
+        return Result();
+    }
+
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) != 0) {
+        std::cerr << "[NM] socketpair failed: " << std::strerror(errno) << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+    serverFd_ = fds[0];
+    clientFd_ = fds[1];
+
+    thread_ = std::thread(&LocalNetworkManager::Serve, this);
+    return Result();
+#else
+    std::cerr << "[NM] Local Network Management is only available on Linux" << std::endl;
+    return Result(StateManagementErrc::kOperationFailed);
+#endif
+}
+
+void LocalNetworkManager::Close()
+{
+#ifdef ARA_SM_LOCAL_NM
+    if (serverFd_ < 0) {
+        return;
+    }
+
+    // Wakes the blocked recv() with end of file
+    shutdown(serverFd_, SHUT_RDWR);
+    thread_.join();
+
+    ::close(serverFd_);
+    ::close(clientFd_);
+    serverFd_ = -1;
+    clientFd_ = -1;
+#endif
+}
+
+void LocalNetworkManager::Serve()
+{
+#ifdef ARA_SM_LOCAL_NM
+    char buffer[kMaxMessage];
+
+    for (;;) {
+        const ssize_t n = recv(serverFd_, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+
+        std::istringstream lines(std::string(buffer, static_cast<std::size_t>(n)));
+        std::string tag;
+        std::string handle;
+        std::string stateName;
+        bool ok = static_cast<bool>(lines >> tag) && tag[0] == '#';
+
+        std::chrono::milliseconds delay;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            delay = replyDelay_;
+        }
+        std::this_thread::sleep_for(delay);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (lines >> handle >> stateName) {
+                NmStateRequestEnum state;
+                if (!NetworkManagementClient::ParseState(stateName.c_str(), state)) {
+                    ok = false;
+                    continue;
+                }
+                states_[handle] = state;
+                updateCount_++;
+            }
+            requestCount_++;
+        }
+
+        const std::string reply = std::string(ok ? kReplyOk : kReplyError) + " " + tag;
+        send(serverFd_, reply.data(), reply.size(), MSG_NOSIGNAL);
+    }
+#endif
+}
+
+bool LocalNetworkManager::GetState(const std::string& handle, NmStateRequestEnum& state) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = states_.find(handle);
+    if (it == states_.end()) {
+        return false;
+    }
+    state = it->second;
+    return true;
+}
+
+void LocalNetworkManager::SetReplyDelay(std::chrono::milliseconds delay)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    replyDelay_ = delay;
+}
+
+std::size_t LocalNetworkManager::GetRequestCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return requestCount_;
+}
+
+std::size_t LocalNetworkManager::GetUpdateCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return updateCount_;
+}
+
+// ============================================================================
+// NetworkManagementClient
+// ============================================================================
+
+NetworkManagementClient::NetworkManagementClient(std::chrono::milliseconds replyTimeout)
+    : replyTimeout_(replyTimeout)
+{
+}
+
+bool NetworkManagementClient::ParseState(const char* name, NmStateRequestEnum& state)
+{
+    if (name == nullptr) {
+        return false;
+    }
+    if (std::strcmp(name, kFullCom) == 0) {
+        state = NmStateRequestEnum::kFullCom;
+        return true;
+    }
+    if (std::strcmp(name, kNoCom) == 0) {
+        state = NmStateRequestEnum::kNoCom;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Queue a change unless the handle has (or will have) that state
+ * @req [SWS_SM_00625] SetNetworkHandle FullCom
+ * @req [SWS_SM_00626] SetNetworkHandle NoCom
+ */
+NetworkManagementClient::Result NetworkManagementClient::Request(
+    const char* handle,
+    NmStateRequestEnum state)
+{
+    return Request(RegisterHandle(handle), state);
+}
+
+NetworkManagementClient::Result NetworkManagementClient::Request(
+    SymbolId id,
+    NmStateRequestEnum state)
+{
+    if (id >= current_.size()) {
+        return Result(StateManagementErrc::kInvalidValue);
+    }
+    requestCount_++;
+
+    const auto value = static_cast<int8_t>(state);
+    const int8_t effective = queued_[id] != kUnknown ? queued_[id] : current_[id];
+    if (effective == value) {
+        skippedCount_++;
+        return Result();
+    }
+
+    if (queued_[id] == kUnknown) {
+        pending_.push_back(id);
+    }
+    queued_[id] = value;
+    return Result();
+}
+
+/**
+ * @brief One round trip for everything queued since the last flush
+ *
+ * Handles switched back to their current state within the segment are
+ * left out. A request that does not fit one datagram is split.
+ */
+NetworkManagementClient::Result NetworkManagementClient::Flush()
+{
+    if (pending_.empty()) {
+        return Result();
+    }
+
+    std::vector<std::string> messages(1);
+    std::size_t changes = 0U;
+    for (const SymbolId id : pending_) {
+        if (queued_[id] == current_[id]) {
+            continue;
+        }
+        std::string line = std::string(handles_.GetName(SymbolKind::kNetworkHandle, id)) + " " +
+                           StateName(static_cast<NmStateRequestEnum>(queued_[id])) + "\n";
+        if (messages.back().size() + line.size() > LocalNetworkManager::kMaxMessage - kMaxTag) {
+            messages.emplace_back();
+        }
+        messages.back() += line;
+        changes++;
+    }
+
+    bool ok = fd_ >= 0;
+#ifdef ARA_SM_LOCAL_NM
+    for (std::size_t i = 0; ok && changes != 0U && i < messages.size(); i++) {
+        const std::string tag = "#" + std::to_string(++sequence_);
+        const std::string message = tag + "\n" + messages[i];
+        ok = send(fd_, message.data(), message.size(), MSG_NOSIGNAL) ==
+             static_cast<ssize_t>(message.size());
+
+        ok = ok && AwaitReply(fd_, tag, replyTimeout_);
+        roundTrips_++;
+    }
+#else
+    ok = false;
+#endif
+
+    if (changes != 0U) {
+        std::cout << "  [NM] Request: " << changes << " handle(s)"
+                  << (ok ? "" : " failed") << std::endl;
+    }
+
+    // Unconfirmed handles are unknown and get requested again
+    for (const SymbolId id : pending_) {
+        current_[id] = ok || changes == 0U ? queued_[id] : kUnknown;
+        queued_[id] = kUnknown;
+    }
+    pending_.clear();
+
+    return ok || changes == 0U ? Result() : Result(StateManagementErrc::kOperationFailed);
+}
+
+SymbolId NetworkManagementClient::RegisterHandle(const char* handle)
+{
+    const SymbolId id = handles_.Intern(SymbolKind::kNetworkHandle, handle);
+    if (id != kNoSymbol && id >= current_.size()) {
+        current_.resize(id + 1U, kUnknown);
+        queued_.resize(id + 1U, kUnknown);
+    }
+    return id;
+}
+
+bool NetworkManagementClient::GetState(const char* handle, NmStateRequestEnum& state) const
+{
+    return GetState(handles_.Find(SymbolKind::kNetworkHandle, handle), state);
+}
+
+bool NetworkManagementClient::GetState(SymbolId id, NmStateRequestEnum& state) const
+{
+    if (id >= current_.size()) {
+        return false;
+    }
+    const int8_t effective = queued_[id] != kUnknown ? queued_[id] : current_[id];
+    if (effective == kUnknown) {
+        return false;
+    }
+    state = static_cast<NmStateRequestEnum>(effective);
+    return true;
+}
+
+void NetworkManagementClient::Invalidate()
+{
+    current_.assign(current_.size(), kUnknown);
+    queued_.assign(queued_.size(), kUnknown);
+    pending_.clear();
+}
+
+} // namespace sm
+} // namespace ara
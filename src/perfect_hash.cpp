@@ -0,0 +1,225 @@
+#include "perfect_hash.h"
+#include "compiled_rule_table.h"
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @file perfect_hash.cpp
+ * @brief Hash-and-displace construction of minimal perfect hash tables
+ */
+
+namespace ara {
+namespace sm {
+
+std::vector<CompiledRuleTable::Edge> PerfectHashTable::GetEdges() const
+{
+    // Slots are in hash order; sort the keys, then expand each run
+    std::vector<std::pair<uint64_t, uint16_t>> runs;
+    runs.reserve(slotCount);
+    for (uint32_t slot = 0; slot < slotCount; slot++) {
+        const auto key = static_cast<uint32_t>(slotKeys[slot]);
+        if (!(hasWildcard && key == wildcardKey)) {
+            runs.emplace_back(slotKeys[slot], slotRuns[slot]);
+        }
+    }
+    std::sort(runs.begin(), runs.end());
+
+    std::vector<CompiledRuleTable::Edge> edges;
+    for (const auto& run : runs) {
+        const auto state = static_cast<uint8_t>(run.first >> 32U);
+        const auto key = static_cast<uint32_t>(run.first);
+        for (std::size_t index = run.second;; index++) {
+            const PerfectHashCandidate& candidate = candidates[index];
+            edges.push_back({state, key, candidate.toState, candidate.guard, candidate.last});
+            if (candidate.last) {
+                break;
+            }
+        }
+    }
+
+    return edges;
+}
+
+PerfectHashData PerfectHashData::FromRuleTable(const CompiledRuleTable& table)
+{
+    PerfectHashData data;
+    data.hasWildcard_ = table.HasWildcard();
+    data.wildcardKey_ = table.GetWildcardKey();
+
+    // Runs in edge order; one hash key per run
+    std::vector<uint64_t> keys;
+    std::vector<uint16_t> runs;
+    auto collect = [&](const std::vector<CompiledRuleTable::Edge>& edges) {
+        bool runStart = true;
+        for (const auto& edge : edges) {
+            if (runStart) {
+                keys.push_back(PerfectHashTable::PackKey(edge.fromState, edge.key));
+                runs.push_back(static_cast<uint16_t>(data.candidates_.size()));
+            }
+            data.candidates_.push_back({edge.toState, edge.last, edge.guard});
+            runStart = edge.last;
+        }
+    };
+    collect(table.GetEdges());
+    collect(table.GetCatchAllEdges());
+
+    if (data.candidates_.size() >= PerfectHashTable::kNoRun) {
+        std::cerr << "[PerfectHash] Too many candidates: " << data.candidates_.size() << std::endl;
+        return data;
+    }
+
+    for (uint32_t seed = 1U; seed <= kMaxSeeds; seed++) {
+        if (data.Place(keys, seed)) {
+            // Slot -> run via the placed keys
+            const std::size_t bucketCount = data.displacements_.size();
+            data.slotRuns_.assign(keys.size(), PerfectHashTable::kNoRun);
+            for (std::size_t i = 0; i < keys.size(); i++) {
+                const std::size_t bucket = PerfectHashTable::Hash(keys[i], seed) % bucketCount;
+                const std::size_t slot =
+                    PerfectHashTable::Hash(keys[i], data.displacements_[bucket]) % keys.size();
+                data.slotRuns_[slot] = runs[i];
+            }
+            data.valid_ = true;
+            return data;
+        }
+    }
+
+    std::cerr << "[PerfectHash] No collision-free layout for " << keys.size()
+              << " keys" << std::endl;
+    return data;
+}
+
+bool PerfectHashData::Place(const std::vector<uint64_t>& keys, uint32_t seed)
+{
+    const std::size_t n = keys.size();
+    seed_ = seed;
+    slotKeys_.assign(n, 0U);
+    displacements_.assign(n / 2U + 1U, 0U);
+
+    if (n == 0U) {
+        return true;
+    }
+
+    const std::size_t bucketCount = displacements_.size();
+    std::vector<std::vector<uint64_t>> buckets(bucketCount);
+    for (const uint64_t key : keys) {
+        buckets[PerfectHashTable::Hash(key, seed) % bucketCount].push_back(key);
+    }
+
+    // Largest buckets first
+    std::vector<std::size_t> order(bucketCount);
+    for (std::size_t i = 0; i < bucketCount; i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&buckets](std::size_t a, std::size_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    std::vector<bool> taken(n, false);
+    std::vector<std::size_t> slots;
+
+    for (const std::size_t bucket : order) {
+        const auto& members = buckets[bucket];
+        if (members.empty()) {
+            break;
+        }
+
+        bool placed = false;
+        for (uint32_t displacement = 1U; displacement <= kMaxDisplacements && !placed; displacement++) {
+            slots.clear();
+            placed = true;
+            for (const uint64_t key : members) {
+                const std::size_t slot = PerfectHashTable::Hash(key, displacement) % n;
+                if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                    placed = false;
+                    break;
+                }
+                slots.push_back(slot);
+            }
+            if (placed) {
+                displacements_[bucket] = displacement;
+                for (std::size_t i = 0; i < members.size(); i++) {
+                    taken[slots[i]] = true;
+                    slotKeys_[slots[i]] = members[i];
+                }
+            }
+        }
+
+        if (!placed) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+namespace {
+
+template <typename T>
+void EmitArray(std::ostream& out, const char* type, const std::string& name,
+               const std::vector<T>& values, const char* suffix)
+{
+    out << "constexpr " << type << " " << name << "[] = {";
+    if (values.empty()) {
+        out << "0" << suffix;    // zero-length arrays are not allowed
+    }
+    for (std::size_t i = 0; i < values.size(); i++) {
+        out << (i % 6U == 0U ? "\n    " : " ") << "0x" << std::hex << values[i] << std::dec
+            << suffix << ",";
+    }
+    out << "\n};\n\n";
+}
+
+} // namespace
+
+void PerfectHashData::Emit(std::ostream& out, const std::string& name) const
+{
+    out << "// " << name << ": " << slotKeys_.size() << " keys, "
+        << displacements_.size() << " buckets, "
+        << candidates_.size() << " candidates\n";
+
+    EmitArray(out, "uint32_t", name + "Displacements", displacements_, "U");
+    EmitArray(out, "uint64_t", name + "SlotKeys", slotKeys_, "ULL");
+    EmitArray(out, "uint16_t", name + "SlotRuns", slotRuns_, "U");
+
+    out << "constexpr PerfectHashCandidate " << name << "Candidates[] = {\n";
+    for (const auto& candidate : candidates_) {
+        out << "    {" << static_cast<int>(candidate.toState) << "U, "
+            << (candidate.last ? "true" : "false") << ", {0x" << std::hex
+            << candidate.guard.allOf << "U, 0x" << candidate.guard.noneOf << "U}}," << std::dec << "\n";
+    }
+    if (candidates_.empty()) {
+        out << "    {0U, true, {0U, 0U}},\n";
+    }
+    out << "};\n\n";
+
+    out << "constexpr PerfectHashTable " << name << " = {\n"
+        << "    " << seed_ << "U,\n"
+        << "    " << name << "Displacements,\n"
+        << "    " << displacements_.size() << "U,\n"
+        << "    " << name << "SlotKeys,\n"
+        << "    " << name << "SlotRuns,\n"
+        << "    " << (valid_ ? slotKeys_.size() : 0U) << "U,\n"
+        << "    " << name << "Candidates,\n"
+        << "    " << (hasWildcard_ ? "true" : "false") << ",\n"
+        << "    0x" << std::hex << wildcardKey_ << std::dec << "U\n"
+        << "};\n\n";
+}
+
+PerfectHashTable PerfectHashData::View() const
+{
+    return PerfectHashTable{
+        seed_,
+        displacements_.data(),
+        static_cast<uint32_t>(displacements_.size()),
+        slotKeys_.data(),
+        slotRuns_.data(),
+        valid_ ? static_cast<uint32_t>(slotKeys_.size()) : 0U,
+        candidates_.data(),
+        hasWildcard_,
+        wildcardKey_
+    };
+}
+
+} // namespace sm
+} // namespace ara
@@ -0,0 +1,255 @@
+#include "process_supervisor.h"
+#include "state_machine.h"
+#include "static_config.h"
+#include <iostream>
+
+#if defined(__linux__)
+#define ARA_SM_PROCESS_SUPERVISOR 1
+#include <cerrno>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifndef SYS_pidfd_open
+#define SYS_pidfd_open 434
+#endif
+#endif
+
+/**
+ * @file process_supervisor.cpp
+ * @brief pidfd/epoll based process supervision
+ */
+
+namespace ara {
+namespace sm {
+
+using Result = ProcessSupervisor::Result;
+
+ProcessSupervisor::~ProcessSupervisor()
+{
+#ifdef ARA_SM_PROCESS_SUPERVISOR
+    for (const auto& entry : slotByPid_) {
+        ::close(watches_[entry.second].pidfd);
+    }
+    if (epollFd_ >= 0) {
+        ::close(epollFd_);
+    }
+#endif
+}
+
+int ProcessSupervisor::OpenPidfd(int pid)
+{
+#ifdef ARA_SM_PROCESS_SUPERVISOR
+    // pidfds are always close-on-exec
+    return static_cast<int>(syscall(SYS_pidfd_open, static_cast<pid_t>(pid), 0));
+#else
+    (void)pid;
+    return -1;
+#endif
+}
+
+Result ProcessSupervisor::Open()
+{
+#ifdef ARA_SM_PROCESS_SUPERVISOR
+    if (epollFd_ >= 0) {
+        return Result();
+    }
+
+    const int probe = OpenPidfd(static_cast<int>(getpid()));
+    if (probe < 0) {
+        std::cerr << "[Supervisor] pidfd_open not supported by this kernel" << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+    ::close(probe);
+
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd_ < 0) {
+        std::cerr << "[Supervisor] epoll_create1 failed" << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+    return Result();
+#else
+    std::cerr << "[Supervisor] Process supervision is only available on Linux" << std::endl;
+    return Result(StateManagementErrc::kOperationFailed);
+#endif
+}
+
+// ============================================================================
+// Watch / Unwatch
+// ============================================================================
+
+Result ProcessSupervisor::Watch(
+    int pid,
+    const char* functionGroup,
+    const char* name,
+    StateMachine* owner)
+{
+    if (epollFd_ < 0) {
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+    if (IsWatched(pid)) {
+        return Result(StateManagementErrc::kInvalidValue);
+    }
+
+#ifdef ARA_SM_PROCESS_SUPERVISOR
+    const int pidfd = OpenPidfd(pid);
+    if (pidfd < 0) {
+        std::cerr << "[Supervisor] Cannot watch pid " << pid << std::endl;
+        return Result(StateManagementErrc::kOperationFailed);
+    }
+
+    uint32_t slot;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(watches_.size());
+        watches_.emplace_back();
+    }
+    watches_[slot] = {pid, pidfd, functionGroup, name, owner, false, 0, 0};
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = slot;
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, pidfd, &event);
+
+    slotByPid_[pid] = slot;
+    return Result();
+#else
+    (void)functionGroup;
+    (void)name;
+    (void)owner;
+    return Result(StateManagementErrc::kOperationFailed);
+#endif
+}
+
+bool ProcessSupervisor::Unwatch(int pid)
+{
+    const auto it = slotByPid_.find(pid);
+    if (it == slotByPid_.end()) {
+        return false;
+    }
+    Release(it->second);
+    return true;
+}
+
+void ProcessSupervisor::SetExitStatus(int pid, int code, int status)
+{
+    const auto it = slotByPid_.find(pid);
+    if (it == slotByPid_.end()) {
+        return;
+    }
+    WatchEntry& entry = watches_[it->second];
+    entry.exitKnown = true;
+    entry.exitCode = code;
+    entry.exitStatus = status;
+}
+
+void ProcessSupervisor::Release(uint32_t slot)
+{
+    WatchEntry& entry = watches_[slot];
+#ifdef ARA_SM_PROCESS_SUPERVISOR
+    epoll_ctl(epollFd_, EPOLL_CTL_DEL, entry.pidfd, nullptr);
+    ::close(entry.pidfd);
+#endif
+    slotByPid_.erase(entry.pid);
+    entry = {-1, -1, nullptr, nullptr, nullptr, false, 0, 0};
+    freeSlots_.push_back(slot);
+}
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+/**
+ * @brief Deliver terminations to the owning StateMachines
+ * @req [SWS_SM_00601] Error notification reaction
+ *
+ * All ready events are translated first and delivered afterwards, so
+ * watches added or removed by the resulting transitions (action lists
+ * stopping and starting processes) do not disturb the event batch.
+ */
+std::size_t ProcessSupervisor::Dispatch(int timeoutMs)
+{
+    if (epollFd_ < 0) {
+        return 0U;
+    }
+
+#ifdef ARA_SM_PROCESS_SUPERVISOR
+    struct Notification {
+        StateMachine* owner;
+        ExecutionErrorType error;
+    };
+
+    epoll_event events[32];
+    const int n = epoll_wait(epollFd_, events, 32, timeoutMs);
+    if (n <= 0) {
+        if (n < 0 && errno != EINTR) {
+            std::cerr << "[Supervisor] epoll_wait failed" << std::endl;
+        }
+        return 0U;
+    }
+
+    Notification notifications[32];
+    std::size_t count = 0U;
+
+    for (int i = 0; i < n; i++) {
+        const auto slot = static_cast<uint32_t>(events[i].data.u64);
+        const WatchEntry& entry = watches_[slot];
+
+        siginfo_t info{};
+        if (entry.exitKnown) {
+            info.si_pid = entry.pid;
+            info.si_code = entry.exitCode;
+            info.si_status = entry.exitStatus;
+        } else if (waitid(P_PID, static_cast<id_t>(entry.pid), &info,
+                          WEXITED | WNOHANG | WNOWAIT) != 0) {
+            info.si_pid = 0;
+        }
+        const bool known = info.si_pid == entry.pid;
+        const ExecutionErrorType error = known
+            ? ClassifyExit(info.si_code, info.si_status)
+            : config::ExecutionErrors::kProcessCrashed;
+
+        std::cout << "[Supervisor] " << entry.functionGroup << "/" << entry.name
+                  << " (pid " << entry.pid << ") terminated";
+        if (known) {
+            std::cout << (info.si_code == CLD_EXITED ? ", exit " : ", signal ")
+                      << info.si_status;
+        }
+        std::cout << " -> error " << error << std::endl;
+
+        if (entry.owner != nullptr) {
+            notifications[count++] = {entry.owner, error};
+        }
+        Release(slot);
+    }
+
+    for (std::size_t i = 0; i < count; i++) {
+        notifications[i].owner->HandleErrorNotification(notifications[i].error);
+    }
+    return count;
+#else
+    (void)timeoutMs;
+    return 0U;
+#endif
+}
+
+ExecutionErrorType ProcessSupervisor::ClassifyExit(int code, int status)
+{
+#ifdef ARA_SM_PROCESS_SUPERVISOR
+    if ((code == CLD_KILLED || code == CLD_DUMPED) &&
+        (status == SIGSEGV || status == SIGBUS)) {
+        return config::ExecutionErrors::kMemoryViolation;
+    }
+#else
+    (void)code;
+    (void)status;
+#endif
+    return config::ExecutionErrors::kProcessCrashed;
+}
+
+} // namespace sm
+} // namespace ara
@@ -0,0 +1,136 @@
+#include "rule_matcher.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+/**
+ * @file rule_matcher.cpp
+ * @brief Engine selection for rule lookup
+ */
+
+namespace ara {
+namespace sm {
+
+namespace {
+
+struct Shape {
+    std::size_t states;
+    std::size_t keys;
+};
+
+template <typename Rule, typename KeyOf>
+Shape MeasureShape(const Rule* rules,
+                   std::size_t count,
+                   const config::StateHierarchyRule* hierarchy,
+                   std::size_t hierarchyCount,
+                   KeyOf keyOf)
+{
+    bool seen[256] = {};
+    std::size_t states = 0U;
+    auto addState = [&seen, &states](uint32_t state) {
+        const uint8_t index = static_cast<uint8_t>(state);
+        if (!seen[index]) {
+            seen[index] = true;
+            states++;
+        }
+    };
+
+    std::vector<uint32_t> keys;
+    keys.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        addState(rules[i].fromState);
+        keys.push_back(keyOf(rules[i]));
+    }
+    for (std::size_t i = 0; i < hierarchyCount; i++) {
+        addState(hierarchy[i].state);
+        addState(hierarchy[i].parentState);
+    }
+
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    return {states, keys.size()};
+}
+
+} // namespace
+
+RuleMatcher::Engine RuleMatcher::SelectEngine(std::size_t stateCount,
+                                              std::size_t keyCount,
+                                              std::size_t ruleCount)
+{
+    if (ruleCount > kDenseRuleLimit ||
+        stateCount * keyCount > kDenseCellLimit) {
+        return Engine::kVector;
+    }
+    return Engine::kDense;
+}
+
+RuleMatcher RuleMatcher::FromPerfectHash(const PerfectHashTable& table)
+{
+    RuleMatcher matcher;
+    matcher.engine_ = Engine::kPerfectHash;
+    matcher.hash_ = table;
+    return matcher;
+}
+
+RuleMatcher RuleMatcher::FromTransitions(
+    const config::TransitionRule* rules,
+    std::size_t count,
+    const config::StateHierarchyRule* hierarchy,
+    std::size_t hierarchyCount)
+{
+    const Shape shape = MeasureShape(rules, count, hierarchy, hierarchyCount,
+        [](const config::TransitionRule& rule) { return rule.trigger; });
+
+    RuleMatcher matcher;
+    matcher.engine_ = SelectEngine(shape.states, shape.keys, count);
+
+    if (matcher.engine_ == Engine::kDense) {
+        matcher.dense_ = std::make_shared<const CompiledRuleTable>(
+            CompiledRuleTable::FromTransitions(rules, count, hierarchy, hierarchyCount));
+    } else {
+        std::cout << "[RuleMatcher] Vector engine for " << count << " transition rules"
+                  << std::endl;
+        matcher.vector_ = std::make_shared<const VectorRuleTable>(
+            VectorRuleTable::FromTransitions(rules, count, hierarchy, hierarchyCount));
+    }
+
+    return matcher;
+}
+
+RuleMatcher RuleMatcher::FromErrorRecovery(
+    const config::ErrorRecoveryRule* rules,
+    std::size_t count,
+    const config::StateHierarchyRule* hierarchy,
+    std::size_t hierarchyCount)
+{
+    const Shape shape = MeasureShape(rules, count, hierarchy, hierarchyCount,
+        [](const config::ErrorRecoveryRule& rule) { return rule.errorCode; });
+
+    RuleMatcher matcher;
+    matcher.engine_ = SelectEngine(shape.states, shape.keys, count);
+
+    if (matcher.engine_ == Engine::kDense) {
+        matcher.dense_ = std::make_shared<const CompiledRuleTable>(
+            CompiledRuleTable::FromErrorRecovery(rules, count, hierarchy, hierarchyCount));
+    } else {
+        std::cout << "[RuleMatcher] Vector engine for " << count << " error recovery rules"
+                  << std::endl;
+        matcher.vector_ = std::make_shared<const VectorRuleTable>(
+            VectorRuleTable::FromErrorRecovery(rules, count, hierarchy, hierarchyCount));
+    }
+
+    return matcher;
+}
+
+std::vector<CompiledRuleTable::Edge> RuleMatcher::GetEdges() const
+{
+    switch (engine_) {
+        case Engine::kDense: return dense_->GetEdges();
+        case Engine::kVector: return vector_->GetEdges();
+        default: return hash_.GetEdges();
+    }
+}
+
+} // namespace sm
+} // namespace ara
@@ -1,6 +1,8 @@
 #include <iostream>
 #include "state_machine.h"
-#include "transition_table.h"
+#include "transition_planner.h"
+#include "machine_config.h"
+#include "condition_word.h"
 #include "static_config.h"
 
 namespace ara {
@@ -21,6 +23,7 @@ StateMachine::StateMachine(const std::string& name,
     , errorRecoveryOngoing_(false)
     , impactedByUpdate_(false)
     , actionExecutor_(executor)
+    , config_(&MachineConfig::GetDefault(category))
 {
     std::cout << "[SM] StateMachine created: " << name_
               << " (Category: " 
@@ -28,6 +31,15 @@ StateMachine::StateMachine(const std::string& name,
               << ")" << std::endl;
 }
 
+StateMachine::StateMachine(const std::string& name,
+                           Category category,
+                           MachineConfig& config,
+                           IActionExecutor* executor)
+    : StateMachine(name, category, executor)
+{
+    config_ = &config;
+}
+
 // ============================================================================
 // Destructor
 // ============================================================================
@@ -84,17 +96,88 @@ StateMachine::RequestTransition(TransitionRequestType request)
         return ara::core::Result<void, StateManagementErrc>(
             StateManagementErrc::kRecoveryTransitionOngoing);
 
-    if (!IsTransitionAllowed(request))
+    // One snapshot for the whole request, even across a reload
+    const auto config = config_->Read();
+    const auto state = static_cast<uint8_t>(currentState_);
+
+    // Fast reject: one bit test against the precomputed trigger set
+    if (!config->GetAllowedTriggers(state).Contains(request))
         return ara::core::Result<void, StateManagementErrc>(
             StateManagementErrc::kTransitionNotAllowed);
 
-    uint8_t next =
-        TransitionTable::GetNextState(
-            static_cast<uint8_t>(currentState_),
-            request,
-            category_);
+    // Guards
+    const uint8_t next = config->FindTransition(state, request, ConditionWord::Get());
+    if (next == ConfigSnapshot::kNoMatch)
+        return ara::core::Result<void, StateManagementErrc>(
+            StateManagementErrc::kTransitionNotAllowed);
 
-    return TransitionTo(static_cast<State>(next));
+    return TransitionTo(static_cast<State>(next), *config);
+}
+
+// ============================================================================
+// RequestTargetState
+// ============================================================================
+
+ara::core::Result<void, StateManagementErrc>
+StateMachine::RequestTargetState(uint32_t targetState)
+{
+    std::cout << "[SM] RequestTargetState: " << targetState << std::endl;
+
+    if (impactedByUpdate_)
+        return ara::core::Result<void, StateManagementErrc>(
+            StateManagementErrc::kUpdateInProgress);
+
+    if (errorRecoveryOngoing_)
+        return ara::core::Result<void, StateManagementErrc>(
+            StateManagementErrc::kRecoveryTransitionOngoing);
+
+    // State IDs are 8 bit, 0xFF is kNoMatch
+    if (targetState >= ConfigSnapshot::kNoMatch)
+        return ara::core::Result<void, StateManagementErrc>(
+            StateManagementErrc::kTransitionNotAllowed);
+
+    const auto from = static_cast<uint8_t>(currentState_);
+    const auto target = static_cast<uint8_t>(targetState);
+    if (from == target)
+        return ara::core::Result<void, StateManagementErrc>();
+
+    const auto config = config_->Read();
+
+    TransitionRequestType triggers[kMaxTargetHops];
+    const std::size_t hops =
+        config->GetPlanner().Plan(from, target, triggers, kMaxTargetHops);
+
+    if (hops == 0U)
+        return ara::core::Result<void, StateManagementErrc>(
+            StateManagementErrc::kTransitionNotAllowed);
+
+    // Validate the whole chain first, so a failing guard leaves the state untouched
+    const config::ConditionMask conditions = ConditionWord::Get();
+    uint8_t path[kMaxTargetHops];
+    uint8_t state = from;
+    for (std::size_t i = 0; i < hops; i++)
+    {
+        state = config->FindTransition(state, triggers[i], conditions);
+        if (state == ConfigSnapshot::kNoMatch)
+            return ara::core::Result<void, StateManagementErrc>(
+                StateManagementErrc::kTransitionNotAllowed);
+
+        path[i] = state;
+    }
+
+    // A guard may select a different candidate than the planned edge
+    if (state != target)
+        return ara::core::Result<void, StateManagementErrc>(
+            StateManagementErrc::kTransitionNotAllowed);
+
+    for (std::size_t i = 0; i < hops; i++)
+    {
+        auto r = TransitionTo(static_cast<State>(path[i]), *config);
+        if (!r.HasValue())
+            return r;
+    }
+
+    return ara::core::Result<void, StateManagementErrc>();
 }
 
 // ============================================================================
@@ -113,8 +196,16 @@ void StateMachine::HandleErrorNotification(uint32_t executionError)
 
     errorRecoveryOngoing_ = true;
 
-    // uproszczony mechanizm — docelowo: z config::kErrorRecoveryTable
-    TransitionTo(State::kOff);
+    // Recovery state from the machine's ErrorRecoveryTable;
+    // non-mapped errors fall back to Off [SWS_SM_CONSTR_00014]
+    const auto config = config_->Read();
+    const uint8_t recovery = config->FindRecovery(
+        static_cast<uint8_t>(currentState_), executionError);
+
+    TransitionTo(recovery != ConfigSnapshot::kNoMatch
+                     ? static_cast<State>(recovery)
+                     : State::kOff,
+                 *config);
 
     errorRecoveryOngoing_ = false;
 }
@@ -143,6 +234,17 @@ StateMachine::State StateMachine::GetCurrentStateEnum() const
     return currentState_;
 }
 
+CompiledRuleTable::KeySet StateMachine::GetAllowedTriggers() const
+{
+    return config_->Read()->GetAllowedTriggers(
+        static_cast<uint8_t>(currentState_));
+}
+
+MachineConfig& StateMachine::GetConfig() const
+{
+    return *config_;
+}
+
 StateMachineStateNameType StateMachine::GetCurrentState() const
 {
     if (isInTransition_)
@@ -175,25 +277,22 @@ bool StateMachine::IsRunning() const
 // ExecuteActionList
 // ============================================================================
 
-void StateMachine::ExecuteActionList()
+ara::core::Result<void, StateManagementErrc>
+StateMachine::ExecuteActionList(State state, const ConfigSnapshot& config)
 {
-    using namespace ara::sm::config;
-
-    for (size_t i = 0; i < kActionTableCount; ++i)
+    const auto* e = config.FindResolvedActionList(static_cast<uint8_t>(state));
+    if (e != nullptr)
     {
-        const auto& e = kActionTable[i];
-        if (e.state == static_cast<uint8_t>(currentState_))
+        if (actionExecutor_)
         {
-            if (actionExecutor_)
-            {
-                actionExecutor_->ExecuteActionList(e.actions, e.actionCount);
-            }
-            return;
+            return actionExecutor_->ExecuteResolvedActionList(*e);
         }
+        return ara::core::Result<void, StateManagementErrc>();
     }
 
     std::cout << "[SM] No action list for state="
-              << StateToString(currentState_) << std::endl;
+              << StateToString(state) << std::endl;
+    return ara::core::Result<void, StateManagementErrc>();
 }
 
 // ============================================================================
@@ -202,6 +301,13 @@ void StateMachine::ExecuteActionList()
 
 ara::core::Result<void, StateManagementErrc>
 StateMachine::TransitionTo(State newState)
+{
+    const auto config = config_->Read();
+    return TransitionTo(newState, *config);
+}
+
+ara::core::Result<void, StateManagementErrc>
+StateMachine::TransitionTo(State newState, const ConfigSnapshot& config)
 {
     std::cout << "[SM] Transition: "
             //   << StateToString(currentState_)
@@ -209,7 +315,17 @@ StateMachine::TransitionTo(State newState)
 
     isInTransition_ = true;
 
-    ExecuteActionList();
+    // The target state's action list decides the transition; if it
+    // fails, the current state stays in place
+    auto r = ExecuteActionList(newState, config);
+    if (!r.HasValue())
+    {
+        isInTransition_ = false;
+        std::cout << "[SM] Transition failed, staying in "
+                  << StateToString(currentState_) << std::endl;
+        return ara::core::Result<void, StateManagementErrc>(
+            StateManagementErrc::kTransitionFailed);
+    }
 
     currentState_ = newState;
     isInTransition_ = false;
@@ -236,13 +352,5 @@ std::string StateMachine::StateToString(State state)
     }
 }
 
-bool StateMachine::IsTransitionAllowed(TransitionRequestType request) const
-{
-    return TransitionTable::IsTransitionAllowed(
-        static_cast<uint8_t>(currentState_),
-        request,
-        category_);
-}
-
 } // namespace sm
 } // namespace ara
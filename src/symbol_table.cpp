@@ -0,0 +1,83 @@
+#include "symbol_table.h"
+#include <atomic>
+
+/**
+ * @file symbol_table.cpp
+ * @brief Interning of action item names into dense symbol IDs
+ */
+
+namespace ara {
+namespace sm {
+
+uint64_t SymbolTable::NextGeneration()
+{
+    static std::atomic<uint64_t> next{1U};
+    return next.fetch_add(1U, std::memory_order_relaxed);
+}
+
+SymbolId SymbolTable::Intern(SymbolKind kind, const char* name)
+{
+    if (name == nullptr || name[0] == '\0' || kind >= SymbolKind::kCount) {
+        return kNoSymbol;
+    }
+
+    const auto k = static_cast<std::size_t>(kind);
+    const auto found = index_[k].find(std::string_view(name));
+    if (found != index_[k].end()) {
+        return found->second;
+    }
+    if (names_[k].size() >= kNoSymbol) {
+        return kNoSymbol;
+    }
+
+    strings_.emplace_back(name);
+    const std::string& stored = strings_.back();
+    const auto id = static_cast<SymbolId>(names_[k].size());
+    names_[k].push_back(stored.c_str());
+    index_[k].emplace(std::string_view(stored), id);
+    generation_ = NextGeneration();
+    return id;
+}
+
+SymbolId SymbolTable::Find(SymbolKind kind, const char* name) const
+{
+    if (name == nullptr || kind >= SymbolKind::kCount) {
+        return kNoSymbol;
+    }
+
+    const auto k = static_cast<std::size_t>(kind);
+    const auto found = index_[k].find(std::string_view(name));
+    return found != index_[k].end() ? found->second : kNoSymbol;
+}
+
+SymbolKind SymbolTable::TargetKind(config::ActionType type)
+{
+    switch (type) {
+        case config::ActionType::kSetFunctionGroupState:
+            return SymbolKind::kFunctionGroup;
+        case config::ActionType::kStartStateMachine:
+        case config::ActionType::kStopStateMachine:
+            return SymbolKind::kStateMachine;
+        case config::ActionType::kSetNetworkHandle:
+            return SymbolKind::kNetworkHandle;
+        default:
+            return SymbolKind::kCount;
+    }
+}
+
+SymbolKind SymbolTable::ParamKind(config::ActionType type)
+{
+    switch (type) {
+        case config::ActionType::kSetFunctionGroupState:
+            return SymbolKind::kFunctionGroupState;
+        case config::ActionType::kStartStateMachine:
+            return SymbolKind::kStateMachineState;
+        case config::ActionType::kSetNetworkHandle:
+            return SymbolKind::kNetworkState;
+        default:
+            return SymbolKind::kCount;
+    }
+}
+
+} // namespace sm
+} // namespace ara
@@ -0,0 +1,109 @@
+#include "transition_planner.h"
+#include <deque>
+
+/**
+ * @file transition_planner.cpp
+ * @brief Shortest-path precomputation for multi-hop transitions
+ */
+
+namespace ara {
+namespace sm {
+
+TransitionPlanner TransitionPlanner::Build(const CompiledRuleTable& table)
+{
+    return Build(table.GetEdges());
+}
+
+TransitionPlanner TransitionPlanner::Build(const std::vector<CompiledRuleTable::Edge>& edges)
+{
+    TransitionPlanner planner;
+
+    auto addState = [&planner](uint8_t state) {
+        if (planner.stateIndex_[state] == 0U) {
+            planner.states_.push_back(state);
+            planner.stateIndex_[state] = static_cast<uint8_t>(planner.states_.size());
+        }
+    };
+    for (const auto& edge : edges) {
+        addState(edge.fromState);
+        addState(edge.toState);
+    }
+
+    // Adjacency in edge order keeps the result deterministic
+    const std::size_t n = planner.states_.size();
+    std::vector<std::vector<const CompiledRuleTable::Edge*>> adjacency(n);
+    for (const auto& edge : edges) {
+        adjacency[static_cast<std::size_t>(planner.Index(edge.fromState))].push_back(&edge);
+    }
+
+    planner.hops_.assign(n * n, Hop{0U, 0U, kUnreachable});
+
+    for (std::size_t source = 0; source < n; source++) {
+        Hop* row = planner.hops_.data() + source * n;
+        row[source] = Hop{0U, planner.states_[source], 0U};
+
+        std::deque<std::size_t> queue{source};
+        while (!queue.empty()) {
+            const std::size_t current = queue.front();
+            queue.pop_front();
+
+            for (const CompiledRuleTable::Edge* edge : adjacency[current]) {
+                const auto next = static_cast<std::size_t>(planner.Index(edge->toState));
+                if (row[next].distance != kUnreachable) {
+                    continue;
+                }
+                // First hop is inherited from the predecessor
+                row[next] = (current == source)
+                    ? Hop{edge->key, edge->toState, 1U}
+                    : Hop{row[current].trigger, row[current].nextState,
+                          static_cast<uint8_t>(row[current].distance + 1U)};
+                queue.push_back(next);
+            }
+        }
+    }
+
+    return planner;
+}
+
+int TransitionPlanner::Index(uint8_t state) const
+{
+    return static_cast<int>(stateIndex_[state]) - 1;
+}
+
+uint8_t TransitionPlanner::GetDistance(uint8_t fromState, uint8_t toState) const
+{
+    const int from = Index(fromState);
+    const int to = Index(toState);
+    if (from < 0 || to < 0) {
+        return (fromState == toState) ? 0U : kUnreachable;
+    }
+
+    return hops_[static_cast<std::size_t>(from) * states_.size() +
+                 static_cast<std::size_t>(to)].distance;
+}
+
+std::size_t TransitionPlanner::Plan(uint8_t fromState,
+                                    uint8_t toState,
+                                    TransitionRequestType* triggers,
+                                    std::size_t maxHops) const
+{
+    const uint8_t distance = GetDistance(fromState, toState);
+    if (distance == kUnreachable || distance == 0U || distance > maxHops) {
+        return 0U;
+    }
+
+    const std::size_t n = states_.size();
+    const auto to = static_cast<std::size_t>(Index(toState));
+    uint8_t current = fromState;
+
+    for (std::size_t i = 0; i < distance; i++) {
+        const Hop& hop = hops_[static_cast<std::size_t>(Index(current)) * n + to];
+        triggers[i] = hop.trigger;
+        current = hop.nextState;
+    }
+
+    return distance;
+}
+
+} // namespace sm
+} // namespace ara
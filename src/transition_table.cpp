@@ -1,36 +1,38 @@
 #include "transition_table.h"
+#include "compiled_rule_table.h"
+#include "sm_perfect_hash_tables.h"
+#include "condition_word.h"
 #include "static_config.h"
 #include <iostream>
 
 namespace ara {
 namespace sm {
 
+// ============================================================================
+// Matchers (generated at build time)
+// ============================================================================
+
+const RuleMatcher& TransitionTable::GetMatcher(
+    StateMachine::Category category)
+{
+    // Generated from static_config at build time (tools/perfect_hash_gen)
+    static const RuleMatcher controller =
+        RuleMatcher::FromPerfectHash(generated::kControllerTransitionHash);
+
+    static const RuleMatcher agent =
+        RuleMatcher::FromPerfectHash(generated::kAgentTransitionHash);
+
+    return (category == StateMachine::Category::kController) ? controller : agent;
+}
+
 bool TransitionTable::IsTransitionAllowed(
     uint8_t currentState,
     TransitionRequestType request,
     StateMachine::Category category)
 {
-    if (category == StateMachine::Category::kController) {
-        // Search in Controller transition table
-        for (size_t i = 0; i < config::kControllerTransitionsCount; i++) {
-            const auto& rule = config::kControllerTransitions[i];
-            if (static_cast<uint8_t>(rule.fromState) == currentState &&
-                rule.trigger == request) {
-                return true;
-            }
-        }
-    } else {
-        // Search in Agent transition table
-        for (size_t i = 0; i < config::kInfotainmentTransitionsCount; i++) {
-            const auto& rule = config::kInfotainmentTransitions[i];
-            if (static_cast<uint8_t>(rule.fromState) == currentState &&
-                rule.trigger == request) {
-                return true;
-            }
-        }
-    }
-    
-    return false;
+    return GetMatcher(category).Find(
+               currentState, request, ConditionWord::Get()) !=
+           CompiledRuleTable::kNoMatch;
 }
 
 uint8_t TransitionTable::GetNextState(
@@ -38,22 +40,10 @@ uint8_t TransitionTable::GetNextState(
     TransitionRequestType request,
     StateMachine::Category category)
 {
-    if (category == StateMachine::Category::kController) {
-        for (size_t i = 0; i < config::kControllerTransitionsCount; i++) {
-            const auto& rule = config::kControllerTransitions[i];
-            if (static_cast<uint8_t>(rule.fromState) == currentState &&
-                rule.trigger == request) {
-                return static_cast<uint8_t>(rule.toState);
-            }
-        }
-    } else {
-        for (size_t i = 0; i < config::kInfotainmentTransitionsCount; i++) {
-            const auto& rule = config::kInfotainmentTransitions[i];
-            if (static_cast<uint8_t>(rule.fromState) == currentState &&
-                rule.trigger == request) {
-                return static_cast<uint8_t>(rule.toState);
-            }
-        }
+    const uint8_t next = GetMatcher(category).Find(
+        currentState, request, ConditionWord::Get());
+    if (next != CompiledRuleTable::kNoMatch) {
+        return next;
     }
     
     std::cerr << "[TransitionTable] No transition found for state=" 
@@ -64,4 +54,4 @@ uint8_t TransitionTable::GetNextState(
 }
 
 } // namespace sm
-} // namespace ara
\ No newline at end of file
+} // namespace ara
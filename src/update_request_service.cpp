@@ -11,6 +11,8 @@
 
 #include "update_request_service.h"
 #include "state_machine.h"
+#include "condition_word.h"
+#include "static_config.h"
 #include <iostream>
 #include <memory>
 
@@ -38,12 +40,18 @@ public:
     // Reference to Controller StateMachine
     StateMachine* controllerSM = nullptr;
     
-    // Update session state
+    // Update session state (mirrored to Conditions::kUpdateSessionActive)
     bool updateSessionActive = false;
     UpdateStatusType resetMachineStatus = UpdateStatusType::kIdle;
     
     // Update allowed flag (set by SMControlApplication via UpdateAllowedService)
-    UpdateAllowedType updateAllowed = UpdateAllowedType::kUpdateNotAllowed;
+    // lives in the shared ConditionWord as Conditions::kUpdateAllowed, where
+    // guarded transitions (e.g. Running -> PrepareUpdate) evaluate it.
+    
+    void SetSessionActive(bool active) {
+        updateSessionActive = active;
+        ConditionWord::Assign(config::Conditions::kUpdateSessionActive, active);
+    }
     
 private:
     UpdateRequestServiceImpl() = default;
@@ -100,7 +108,7 @@ UpdateRequestService::RequestUpdateSession()
     
     // Check if update is allowed (set by SMControlApplication)
     // @req [SWS_SM_00630] Rejection
-    if (impl.updateAllowed == UpdateAllowedType::kUpdateNotAllowed) {
+    if (!ConditionWord::IsSet(config::Conditions::kUpdateAllowed)) {
         std::cout << "[UpdateRequestService] Update not allowed by SMControlApplication" 
                   << std::endl;
         return ara::core::Result<void, StateManagementErrc>(
@@ -111,7 +119,7 @@ UpdateRequestService::RequestUpdateSession()
     std::cout << "[UpdateRequestService] Update session GRANTED" << std::endl;
     
     // Mark session as active
-    impl.updateSessionActive = true;
+    impl.SetSessionActive(true);
     
     // @req [SWS_SM_00659] Set ResetMachineNotifier to default (kIdle)
     impl.resetMachineStatus = UpdateStatusType::kIdle;
@@ -424,7 +432,7 @@ UpdateRequestService::StopUpdateSession()
     
     // Mark session as inactive
     // LCOV_EXCL_LINE
-    impl.updateSessionActive = false;
+    impl.SetSessionActive(false);
     
     // @req [SWS_SM_00660] Reset ResetMachineNotifier to default
     impl.resetMachineStatus = UpdateStatusType::kIdle;
@@ -515,8 +523,8 @@ bool UpdateRequestService::IsUpdateSessionActive() const
  */
 void UpdateRequestService::SetUpdateAllowed(UpdateAllowedType allowed)
 {
-    auto& impl = UpdateRequestServiceImpl::GetInstance();
-    impl.updateAllowed = allowed;
+    ConditionWord::Assign(config::Conditions::kUpdateAllowed,
+                          allowed == UpdateAllowedType::kUpdateAllowed);
     
     std::cout << "[UpdateRequestService] UpdateAllowed: " 
               << UpdateAllowedToString(allowed) << std::endl;
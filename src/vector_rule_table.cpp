@@ -0,0 +1,263 @@
+#include "vector_rule_table.h"
+#include <algorithm>
+#include <unordered_set>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ARA_SM_VECTOR_AVX2 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @file vector_rule_table.cpp
+ * @brief SoA rule table with AVX2 / scalar key matching
+ *
+ * @req [SWS_SM_00603-00607], [SWS_SM_00601], [SWS_SM_CONSTR_00014]
+ */
+
+namespace ara {
+namespace sm {
+
+// ============================================================================
+// Key matching kernels - index of first keys[i] == key in [begin, end)
+// ============================================================================
+
+namespace {
+
+std::size_t MatchScalar(const uint32_t* keys, std::size_t begin,
+                        std::size_t end, uint32_t key)
+{
+    for (std::size_t i = begin; i < end; i++) {
+        if (keys[i] == key) {
+            return i;
+        }
+    }
+    return end;
+}
+
+#ifdef ARA_SM_VECTOR_AVX2
+__attribute__((target("avx2")))
+std::size_t MatchAvx2(const uint32_t* keys, std::size_t begin,
+                      std::size_t end, uint32_t key)
+{
+    const __m256i needle = _mm256_set1_epi32(static_cast<int>(key));
+    std::size_t i = begin;
+
+    for (; i + 8U <= end; i += 8U) {
+        const __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+        const auto mask = static_cast<unsigned>(_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpeq_epi32(lanes, needle))));
+        if (mask != 0U) {
+            return i + static_cast<std::size_t>(__builtin_ctz(mask));
+        }
+    }
+
+    return MatchScalar(keys, i, end, key);
+}
+#endif
+
+} // namespace
+
+VectorRuleTable::VectorRuleTable()
+    : rangeBegin_(257U, 0U)
+    , isa_(Isa::kScalar)
+    , match_(&MatchScalar)
+{
+    std::fill(wildcard_, wildcard_ + 256, kNoMatch);
+    std::fill(parent_, parent_ + 256, kNoMatch);
+    SelectIsa(DetectIsa());
+}
+
+VectorRuleTable::Isa VectorRuleTable::DetectIsa()
+{
+#ifdef ARA_SM_VECTOR_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        return Isa::kAvx2;
+    }
+#endif
+    return Isa::kScalar;
+}
+
+bool VectorRuleTable::SelectIsa(Isa isa)
+{
+    if (isa == Isa::kScalar) {
+        isa_ = isa;
+        match_ = &MatchScalar;
+        return true;
+    }
+
+#ifdef ARA_SM_VECTOR_AVX2
+    if (DetectIsa() == Isa::kAvx2) {
+        isa_ = isa;
+        match_ = &MatchAvx2;
+        return true;
+    }
+#endif
+    return false;
+}
+
+// ============================================================================
+// Factories
+// ============================================================================
+
+VectorRuleTable VectorRuleTable::FromTransitions(
+    const config::TransitionRule* rules,
+    std::size_t count,
+    const config::StateHierarchyRule* hierarchy,
+    std::size_t hierarchyCount)
+{
+    std::vector<Rule> normalized;
+    normalized.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        normalized.push_back({rules[i].fromState, rules[i].trigger,
+                              rules[i].toState, rules[i].guard});
+    }
+
+    return Build(normalized, hierarchy, hierarchyCount, false, 0U);
+}
+
+VectorRuleTable VectorRuleTable::FromErrorRecovery(
+    const config::ErrorRecoveryRule* rules,
+    std::size_t count,
+    const config::StateHierarchyRule* hierarchy,
+    std::size_t hierarchyCount)
+{
+    std::vector<Rule> normalized;
+    normalized.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        normalized.push_back({rules[i].fromState, rules[i].errorCode,
+                              rules[i].toState, {0U, 0U}});
+    }
+
+    return Build(normalized, hierarchy, hierarchyCount,
+                 true, config::kExecutionErrorAny);
+}
+
+VectorRuleTable VectorRuleTable::Build(
+    const std::vector<Rule>& rules,
+    const config::StateHierarchyRule* hierarchy,
+    std::size_t hierarchyCount,
+    bool hasWildcard,
+    uint32_t wildcardKey)
+{
+    VectorRuleTable table;
+
+    // Parent links (first entry for a child wins)
+    for (std::size_t i = 0; i < hierarchyCount; i++) {
+        const uint8_t child = static_cast<uint8_t>(hierarchy[i].state);
+        if (table.parent_[child] == kNoMatch) {
+            table.parent_[child] = static_cast<uint8_t>(hierarchy[i].parentState);
+        }
+    }
+
+    // Counting sort by fromState keeps configuration order within a state;
+    // the last wildcard of a state is kept aside
+    std::vector<uint32_t> counts(256U, 0U);
+    for (const auto& rule : rules) {
+        const uint8_t state = static_cast<uint8_t>(rule.fromState);
+        if (hasWildcard && rule.key == wildcardKey) {
+            table.wildcard_[state] = static_cast<uint8_t>(rule.toState);
+            continue;
+        }
+        counts[state]++;
+    }
+
+    for (std::size_t state = 0; state < 256U; state++) {
+        table.rangeBegin_[state + 1U] = table.rangeBegin_[state] + counts[state];
+    }
+
+    const std::size_t total = table.rangeBegin_[256];
+    table.keys_.resize(total);
+    table.toStates_.resize(total);
+    table.allOf_.resize(total);
+    table.noneOf_.resize(total);
+
+    std::vector<uint32_t> next(table.rangeBegin_.begin(), table.rangeBegin_.end() - 1);
+    for (const auto& rule : rules) {
+        if (hasWildcard && rule.key == wildcardKey) {
+            continue;
+        }
+        const uint32_t index = next[static_cast<uint8_t>(rule.fromState)]++;
+        table.keys_[index] = rule.key;
+        table.toStates_[index] = static_cast<uint8_t>(rule.toState);
+        table.allOf_[index] = rule.guard.allOf;
+        table.noneOf_[index] = rule.guard.noneOf;
+    }
+
+    return table;
+}
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+uint8_t VectorRuleTable::Find(uint8_t state, uint32_t key,
+                              config::ConditionMask conditions) const
+{
+    uint8_t level = state;
+
+    for (std::size_t depth = 0; level != kNoMatch && depth < kMaxHierarchyDepth; depth++) {
+        const std::size_t end = rangeBegin_[level + 1U];
+        std::size_t i = match_(keys_.data(), rangeBegin_[level], end, key);
+
+        while (i < end) {
+            if (config::EvaluateGuard({allOf_[i], noneOf_[i]}, conditions)) {
+                return toStates_[i];
+            }
+            i = match_(keys_.data(), i + 1U, end, key);
+        }
+
+        if (wildcard_[level] != kNoMatch) {
+            return wildcard_[level];
+        }
+
+        level = parent_[level];
+    }
+
+    return kNoMatch;
+}
+
+std::vector<CompiledRuleTable::Edge> VectorRuleTable::GetEdges() const
+{
+    std::vector<CompiledRuleTable::Edge> edges;
+    std::unordered_set<uint32_t> closed;
+
+    for (std::size_t state = 0; state < 256U; state++) {
+        const std::size_t first = edges.size();
+        closed.clear();
+
+        // Walk the levels like Find(); an unguarded rule closes its key and
+        // a wildcard level shadows everything above it
+        auto level = static_cast<uint8_t>(state);
+        for (std::size_t depth = 0; level != kNoMatch && depth < kMaxHierarchyDepth; depth++) {
+            for (std::size_t i = rangeBegin_[level]; i < rangeBegin_[level + 1U]; i++) {
+                if (closed.count(keys_[i]) != 0U) {
+                    continue;
+                }
+                const config::TransitionGuard guard{allOf_[i], noneOf_[i]};
+                edges.push_back({static_cast<uint8_t>(state), keys_[i], toStates_[i],
+                                 guard, false});
+                if (guard.allOf == 0U && guard.noneOf == 0U) {
+                    closed.insert(keys_[i]);
+                }
+            }
+            if (wildcard_[level] != kNoMatch) {
+                break;
+            }
+            level = parent_[level];
+        }
+
+        const auto begin = edges.begin() + static_cast<std::ptrdiff_t>(first);
+        std::stable_sort(begin, edges.end(),
+            [](const CompiledRuleTable::Edge& a, const CompiledRuleTable::Edge& b) {
+                return a.key < b.key;
+            });
+        for (std::size_t i = first; i < edges.size(); i++) {
+            edges[i].last = (i + 1U == edges.size() || edges[i + 1U].key != edges[i].key);
+        }
+    }
+
+    return edges;
+}
+
+} // namespace sm
+} // namespace ara
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cgroup_manager.h"
+#include "local_execution_manager.h"
+#include "static_config.h"
+
+using ara::sm::CgroupManager;
+using ara::sm::LocalExecutionManager;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Function group start under CPU contention
+ *
+ *  - CriticalStart/cgroups/hogs : CriticalFG (2 daemons) is started while
+ *                                 HogFG runs N busy loops; with cgroups 1
+ *                                 CriticalFG and HogFG have cpu.weight
+ *                                 1000 and 10 (needs the cpu controller
+ *                                 enabled for the cgroup2 root)
+ *
+ * Counters are the mean and worst CriticalFG start latency reported by
+ * the manager. Stopping CriticalFG is excluded from the timing.
+ */
+
+namespace {
+
+constexpr const char* kReady = "printf R >&3; exec sleep 3600";
+constexpr const char* kBusy = "printf R >&3; while :; do :; done";
+
+constexpr ResourceItem kResources[] = {
+    {"CriticalFG", nullptr, 1000, 1000, nullptr},
+    {"HogFG", nullptr, 10, 10, nullptr},
+};
+
+class QuietCout {
+public:
+    QuietCout() : saved_(std::cout.rdbuf(nullptr)) {}
+    ~QuietCout()
+    {
+        std::cout.rdbuf(saved_);
+        std::cout.clear();
+    }
+
+private:
+    std::streambuf* saved_;
+};
+
+} // namespace
+
+static void BM_CriticalStart(benchmark::State& state)
+{
+    const bool isolated = state.range(0) != 0;
+    const auto hogs = static_cast<std::size_t>(state.range(1));
+
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < hogs; i++) {
+        names.push_back("Hog" + std::to_string(i));
+    }
+    std::vector<ProcessItem> processes = {
+        {"CriticalFG", "Running", "Diag", {"/bin/sh", "-c", kReady, nullptr}},
+        {"CriticalFG", "Running", "Health", {"/bin/sh", "-c", kReady, nullptr}},
+    };
+    for (const auto& name : names) {
+        processes.push_back({"HogFG", "Running", name.c_str(), {"/bin/sh", "-c", kBusy, nullptr}});
+    }
+
+    QuietCout quiet;
+    CgroupManager cgroups(kResources, sizeof(kResources) / sizeof(ResourceItem));
+    LocalExecutionManager em(processes.data(), processes.size());
+    if (!em.Open().HasValue()) {
+        state.SkipWithError("No pidfd/epoll support");
+        return;
+    }
+    if (isolated) {
+        if (!cgroups.Open().HasValue()) {
+            state.SkipWithError("No cgroup v2 access");
+            return;
+        }
+        em.SetCgroupManager(&cgroups);
+    }
+
+    em.RequestFunctionGroupState("HogFG", "Running");
+    em.WaitReady();
+
+    double latencyUs = 0.0;
+    double worstUs = 0.0;
+
+    for (auto _ : state) {
+        em.RequestFunctionGroupState("CriticalFG", "Running");
+        em.WaitReady();
+
+        state.PauseTiming();
+        const auto us = static_cast<double>(em.GetReports().back().latency.count());
+        latencyUs += us;
+        worstUs = std::max(worstUs, us);
+        em.ClearReports();
+        em.RequestFunctionGroupState("CriticalFG", "Off");
+        em.WaitReady();
+        state.ResumeTiming();
+    }
+
+    em.StopAll();
+
+    state.counters["critical_start_us"] = benchmark::Counter(latencyUs, benchmark::Counter::kAvgIterations);
+    state.counters["worst_us"] = worstUs;
+}
+BENCHMARK(BM_CriticalStart)
+    ->ArgNames({"cgroups", "hogs"})
+    ->Args({0, 0})->Args({0, 4})->Args({1, 4})
+    ->UseRealTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,181 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <string>
+#include <vector>
+
+#include "local_execution_manager.h"
+#include "config_snapshot.h"
+#include "static_config.h"
+
+using ara::sm::ConfigSnapshot;
+using ara::sm::LocalExecutionManager;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Boot-time work through the local Execution Management stand-in
+ *
+ *  - ControllerBoot/cache
+ *                   : Initial, Startup and Running action lists of the
+ *                     Controller with kProcessTable (MachineFG Startup ->
+ *                     Running); with cache 0 the function group state
+ *                     cache is cleared before each list, so the Startup
+ *                     list sets MachineFG to Startup again
+ *  - ParallelStart  : one function group state with N daemons that
+ *                     report ready; shows spawn/readiness scaling
+ *  - InfotainmentToRunning/degraded/prelaunch
+ *                   : InfotainmentFG Off (0) or Degraded (1) -> Running,
+ *                     spawned (prelaunch 0) or released from processes
+ *                     parked by kPrelaunchTable (prelaunch 1)
+ *
+ * Counters are the per-FG start latencies reported by the manager.
+ * Process teardown is excluded from the timing.
+ */
+
+namespace {
+
+/// Silence the action logging while measuring
+class QuietCout {
+public:
+    QuietCout() : saved_(std::cout.rdbuf(nullptr)) {}
+    ~QuietCout()
+    {
+        std::cout.rdbuf(saved_);
+        std::cout.clear();
+    }
+
+private:
+    std::streambuf* saved_;
+};
+
+} // namespace
+
+static void BM_ControllerBoot(benchmark::State& state)
+{
+    ConfigSnapshot snapshot;
+    if (!snapshot.Load({"Controller",
+                        kControllerTransitions, kControllerTransitionsCount,
+                        kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                        kControllerStateHierarchy, kControllerStateHierarchyCount,
+                        kActionTable, kActionTableCount}).HasValue()) {
+        state.SkipWithError("Config load failed");
+        return;
+    }
+
+    LocalExecutionManager em(kProcessTable, kProcessTableCount);
+    if (!em.Open().HasValue()) {
+        state.SkipWithError("No pidfd/epoll support");
+        return;
+    }
+
+    QuietCout quiet;
+    const bool cache = state.range(0) != 0;
+    double startupUs = 0.0;
+    double runningUs = 0.0;
+
+    for (auto _ : state) {
+        for (const uint32_t s : {States::kInitial, States::kStartup, States::kRunning}) {
+            if (!cache) {
+                em.InvalidateFunctionGroupStates();
+            }
+            em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(s));
+        }
+
+        state.PauseTiming();
+        for (const auto& report : em.GetReports()) {
+            (report.state == "Startup" ? startupUs : runningUs) +=
+                static_cast<double>(report.latency.count());
+        }
+        em.ClearReports();
+        em.StopAll();
+        state.ResumeTiming();
+    }
+
+    state.counters["startup_us"] = benchmark::Counter(startupUs, benchmark::Counter::kAvgIterations);
+    state.counters["running_us"] = benchmark::Counter(runningUs, benchmark::Counter::kAvgIterations);
+    state.counters["elided"] = benchmark::Counter(
+        static_cast<double>(em.GetElidedCount()), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ControllerBoot)->ArgName("cache")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+static void BM_ParallelStart(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < count; i++) {
+        names.push_back("P" + std::to_string(i));
+    }
+    std::vector<ProcessItem> processes;
+    for (const auto& name : names) {
+        processes.push_back({"BenchFG", "Running", name.c_str(),
+                             {"/bin/sh", "-c", "printf R >&3; exec sleep 3600", nullptr}});
+    }
+
+    LocalExecutionManager em(processes.data(), processes.size());
+    if (!em.Open().HasValue()) {
+        state.SkipWithError("No pidfd/epoll support");
+        return;
+    }
+
+    QuietCout quiet;
+    double latencyUs = 0.0;
+
+    for (auto _ : state) {
+        em.RequestFunctionGroupState("BenchFG", "Running");
+        em.WaitReady();
+
+        state.PauseTiming();
+        latencyUs += static_cast<double>(em.GetReports().back().latency.count());
+        em.ClearReports();
+        em.StopAll();
+        state.ResumeTiming();
+    }
+
+    state.counters["fg_start_us"] = benchmark::Counter(latencyUs, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ParallelStart)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+
+static void BM_InfotainmentToRunning(benchmark::State& state)
+{
+    const char* from = state.range(0) != 0 ? "Degraded" : "Off";
+    const bool prelaunch = state.range(1) != 0;
+
+    QuietCout quiet;
+    LocalExecutionManager em(kProcessTable, kProcessTableCount);
+    if (!em.Open().HasValue()) {
+        state.SkipWithError("No pidfd/epoll support");
+        return;
+    }
+    if (prelaunch) {
+        em.SetPrelaunchTable(kPrelaunchTable, kPrelaunchTableCount);
+    }
+
+    double latencyUs = 0.0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        em.RequestFunctionGroupState("InfotainmentFG", from);
+        em.WaitReady();
+        // Give the prelaunched processes time to reach their park point
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        em.ClearReports();
+        state.ResumeTiming();
+
+        em.RequestFunctionGroupState("InfotainmentFG", "Running");
+        em.WaitReady();
+
+        state.PauseTiming();
+        latencyUs += static_cast<double>(em.GetReports().back().latency.count());
+        state.ResumeTiming();
+    }
+
+    state.counters["fg_start_us"] = benchmark::Counter(latencyUs, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_InfotainmentToRunning)
+    ->ArgNames({"degraded", "prelaunch"})
+    ->Args({0, 0})->Args({0, 1})->Args({1, 0})->Args({1, 1})
+    ->UseRealTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+#include <vector>
+
+#include "action_executor.h"
+#include "config_snapshot.h"
+#include "network_management.h"
+#include "static_config.h"
+
+using ara::sm::ActionExecutor;
+using ara::sm::ConfigSnapshot;
+using ara::sm::LocalNetworkManager;
+using ara::sm::NetworkManagementClient;
+using ara::sm::NmStateRequestEnum;
+using ara::sm::ResolvedActionList;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief SetNetworkHandle cost through the Network Management stand-in
+ *
+ *  - NetworkRequests/cached:0 : every SetNetworkHandle is its own round
+ *                               trip (no cache, no batching)
+ *  - NetworkRequests/cached:1 : ActionExecutor with NetworkManagementClient
+ *
+ * One iteration runs the Infotainment agent through Running, Degraded,
+ * Running and Off, plus a bus wake-up list that switches four handles
+ * in one segment. round_trips counts requests per iteration.
+ */
+
+namespace {
+
+const ActionItem kWakeUpActions[] = {
+    {ActionType::kSetNetworkHandle, "VehicleNetwork", "FullCom", 0U},
+    {ActionType::kSetNetworkHandle, "DiagNetwork", "FullCom", 0U},
+    {ActionType::kSetNetworkHandle, "BodyNetwork", "FullCom", 0U},
+    {ActionType::kSetNetworkHandle, "ChassisNetwork", "FullCom", 0U},
+    {ActionType::kSync, nullptr, nullptr, 0U},
+};
+
+const ActionItem kSleepActions[] = {
+    {ActionType::kSetNetworkHandle, "VehicleNetwork", "NoCom", 0U},
+    {ActionType::kSetNetworkHandle, "DiagNetwork", "NoCom", 0U},
+    {ActionType::kSetNetworkHandle, "BodyNetwork", "NoCom", 0U},
+    {ActionType::kSetNetworkHandle, "ChassisNetwork", "NoCom", 0U},
+    {ActionType::kSync, nullptr, nullptr, 0U},
+};
+
+class QuietCout {
+public:
+    QuietCout() : saved_(std::cout.rdbuf(nullptr)) {}
+    ~QuietCout()
+    {
+        std::cout.rdbuf(saved_);
+        std::cout.clear();
+    }
+
+private:
+    std::streambuf* saved_;
+};
+
+/// One round trip per action, as without a client
+void RequestEach(NetworkManagementClient& client, const ActionItem* items, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++) {
+        NmStateRequestEnum state;
+        if (items[i].type == ActionType::kSetNetworkHandle &&
+            NetworkManagementClient::ParseState(items[i].param, state)) {
+            client.Invalidate();
+            client.Request(items[i].target, state);
+            client.Flush();
+        }
+    }
+}
+
+} // namespace
+
+static void BM_NetworkRequests(benchmark::State& state)
+{
+    const bool cached = state.range(0) != 0;
+
+    ConfigSnapshot snapshot;
+    if (!snapshot.Load({"Infotainment",
+                        kInfotainmentTransitions, kInfotainmentTransitionsCount,
+                        kInfotainmentErrorRecovery, kInfotainmentErrorRecoveryCount,
+                        kInfotainmentStateHierarchy, kInfotainmentStateHierarchyCount,
+                        kInfotainmentActionTable, kInfotainmentActionTableCount}).HasValue()) {
+        state.SkipWithError("Config load failed");
+        return;
+    }
+    std::vector<const ResolvedActionList*> cycle;
+    for (const uint32_t s : {States::kRunning, States::kDegraded, States::kRunning, States::kOff}) {
+        cycle.push_back(snapshot.FindResolvedActionList(s));
+    }
+
+    QuietCout quiet;
+    LocalNetworkManager nm;
+    if (!nm.Open().HasValue()) {
+        state.SkipWithError("No socketpair support");
+        return;
+    }
+    NetworkManagementClient client;
+    client.Connect(nm.GetClientFd());
+    ActionExecutor executor;
+    executor.SetNetworkManagement(&client);
+
+    for (auto _ : state) {
+        if (cached) {
+            executor.ExecuteActionList(kWakeUpActions, 5U);
+            for (const auto* list : cycle) {
+                executor.ExecuteResolvedActionList(*list);
+            }
+            executor.ExecuteActionList(kSleepActions, 5U);
+        } else {
+            RequestEach(client, kWakeUpActions, 5U);
+            for (const auto* list : cycle) {
+                RequestEach(client, list->items, list->actionCount);
+            }
+            RequestEach(client, kSleepActions, 5U);
+        }
+    }
+
+    state.counters["round_trips"] = benchmark::Counter(
+        static_cast<double>(nm.GetRequestCount()), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_NetworkRequests)->ArgName("cached")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
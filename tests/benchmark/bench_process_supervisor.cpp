@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "process_supervisor.h"
+#include "local_execution_manager.h"
+#include "machine_config.h"
+#include "state_machine.h"
+#include "static_config.h"
+
+using ara::sm::LocalExecutionManager;
+using ara::sm::MachineConfig;
+using ara::sm::ProcessSupervisor;
+using ara::sm::StateMachine;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Crash detection latency of ProcessSupervisor
+ *
+ *  - DetectionLatency/N : N supervised processes, one is SIGKILLed;
+ *                         time from kill() to the notification being
+ *                         delivered by Dispatch() (manual time)
+ *
+ * Respawning the killed process is excluded from the timing.
+ */
+
+namespace {
+
+const ErrorRecoveryRule kRecovery[] = {
+    {States::kRunning, kExecutionErrorAny, States::kRunning},
+};
+
+class QuietCout {
+public:
+    QuietCout() : saved_(std::cout.rdbuf(nullptr)) {}
+    ~QuietCout()
+    {
+        std::cout.rdbuf(saved_);
+        std::cout.clear();
+    }
+
+private:
+    std::streambuf* saved_;
+};
+
+} // namespace
+
+static void BM_DetectionLatency(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < count; i++) {
+        names.push_back("P" + std::to_string(i));
+    }
+    std::vector<ProcessItem> processes;
+    for (const auto& name : names) {
+        processes.push_back({"BenchFG", "Running", name.c_str(),
+                             {"/bin/sh", "-c", "printf R >&3; exec sleep 3600", nullptr}});
+    }
+
+    QuietCout quiet;
+    MachineConfig config;
+    config.Load({"Bench", nullptr, 0U, kRecovery, 1U, nullptr, 0U, nullptr, 0U});
+    StateMachine sm("Bench", StateMachine::Category::kAgent, config);
+
+    ProcessSupervisor supervisor;
+    LocalExecutionManager em(processes.data(), processes.size());
+    if (!supervisor.Open().HasValue() || !em.Open().HasValue()) {
+        state.SkipWithError("No pidfd/epoll support");
+        return;
+    }
+
+    sm.Start(static_cast<StateMachine::State>(States::kRunning));
+    em.SetSupervisor(&supervisor, &sm);
+    em.RequestFunctionGroupState("BenchFG", "Running");
+    em.WaitReady();
+
+    const char* victim = names[count / 2U].c_str();
+    for (auto _ : state) {
+        const auto begin = std::chrono::steady_clock::now();
+        kill(em.GetPid("BenchFG", victim), SIGKILL);
+        const std::size_t delivered = supervisor.Dispatch(1000);
+        const auto end = std::chrono::steady_clock::now();
+
+        state.SetIterationTime(std::chrono::duration<double>(end - begin).count());
+        if (delivered != 1U) {
+            state.SkipWithError("Crash not delivered");
+            break;
+        }
+
+        // Respawn the victim (reaps it and restarts the missing process)
+        em.RequestFunctionGroupState("BenchFG", "Running");
+        em.WaitReady();
+    }
+}
+BENCHMARK(BM_DetectionLatency)->Arg(1)->Arg(16)->Arg(128)
+    ->UseManualTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+#include "static_state_machine.h"
+#include "controller_machine_config.h"
+#include "compiled_rule_table.h"
+#include "perfect_hash.h"
+#include "condition_word.h"
+#include "static_config.h"
+
+using ara::sm::CompiledRuleTable;
+using ara::sm::ConditionWord;
+using ara::sm::StaticStateMachine;
+
+namespace machine = ara::sm::generated::controller_machine;
+using namespace ara::sm::config;
+
+/**
+ * @brief Controller transition lookup: compile-time vs runtime tables
+ *
+ * Queries cycle over every (state, trigger) pair of the Controller
+ * manifest (hits and misses, inherited rules included).
+ *
+ *  - RuntimeScan : scan TransitionRule[] per hierarchy level (original lookup)
+ *  - Dense       : CompiledRuleTable built at startup
+ *  - PerfectHash : generated constexpr PerfectHashTable
+ *  - Static      : StaticStateMachine<Tables> jump tables
+ *  - StaticRequest : StaticStateMachine::RequestTransition through the
+ *                  guarded update cycle
+ */
+
+namespace {
+
+using ControllerMachine = StaticStateMachine<machine::Tables>;
+
+std::vector<std::pair<uint8_t, uint32_t>> MakeQueries()
+{
+    std::vector<std::pair<uint8_t, uint32_t>> queries;
+    for (std::size_t s = 0; s < machine::kStateCount; s++) {
+        for (uint32_t trigger = 0; trigger <= 16U; trigger++) {
+            queries.emplace_back(static_cast<uint8_t>(machine::kStateIds[s]), trigger);
+        }
+    }
+    return queries;
+}
+
+uint8_t RuntimeScan(uint8_t state, uint32_t trigger, ConditionMask conditions)
+{
+    for (std::size_t depth = 0; depth < CompiledRuleTable::kMaxHierarchyDepth; depth++) {
+        for (std::size_t i = 0; i < machine::kTransitionsCount; i++) {
+            const auto& rule = machine::kTransitions[i];
+            if (static_cast<uint8_t>(rule.fromState) == state && rule.trigger == trigger &&
+                EvaluateGuard(rule.guard, conditions)) {
+                return static_cast<uint8_t>(rule.toState);
+            }
+        }
+
+        uint8_t parent = CompiledRuleTable::kNoMatch;
+        for (std::size_t i = 0; i < machine::kStateHierarchyCount; i++) {
+            if (static_cast<uint8_t>(machine::kStateHierarchy[i].state) == state) {
+                parent = static_cast<uint8_t>(machine::kStateHierarchy[i].parentState);
+                break;
+            }
+        }
+        if (parent == CompiledRuleTable::kNoMatch) {
+            break;
+        }
+        state = parent;
+    }
+    return CompiledRuleTable::kNoMatch;
+}
+
+template <typename Lookup>
+void Run(benchmark::State& state, Lookup lookup)
+{
+    const auto queries = MakeQueries();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto& query = queries[i];
+        i = (i + 1U == queries.size()) ? 0U : i + 1U;
+        benchmark::DoNotOptimize(lookup(query.first, query.second));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+} // namespace
+
+static void BM_RuntimeScan(benchmark::State& state)
+{
+    Run(state, [](uint8_t s, uint32_t t) { return RuntimeScan(s, t, 0U); });
+}
+
+static void BM_Dense(benchmark::State& state)
+{
+    const auto table = CompiledRuleTable::FromTransitions(
+        machine::kTransitions, machine::kTransitionsCount,
+        machine::kStateHierarchy, machine::kStateHierarchyCount);
+    Run(state, [&table](uint8_t s, uint32_t t) { return table.Find(s, t, 0U); });
+}
+
+static void BM_PerfectHash(benchmark::State& state)
+{
+    Run(state, [](uint8_t s, uint32_t t) { return machine::kTransitionHash.Find(s, t, 0U); });
+}
+
+static void BM_Static(benchmark::State& state)
+{
+    Run(state, [](uint8_t s, uint32_t t) { return ControllerMachine::FindTransition(s, t, 0U); });
+}
+
+static void BM_StaticRequest(benchmark::State& state)
+{
+    // Update cycle: Running -> PrepareUpdate -> VerifyUpdate -> AfterUpdate -> Running
+    ConditionWord::Set(machine::Conditions::kUpdateAllowed |
+                       machine::Conditions::kUpdateSessionActive);
+    ControllerMachine sm(nullptr, machine::States::kRunning);
+    const ara::sm::TransitionRequestType cycle[] = {
+        machine::Triggers::kPrepareUpdateRequest,
+        machine::Triggers::kVerifyUpdateRequest,
+        machine::Triggers::kFinishUpdateRequest,
+        machine::Triggers::kGoToRunning,
+    };
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        auto r = sm.RequestTransition(cycle[i++ & 3U]);
+        benchmark::DoNotOptimize(r);
+    }
+    if (sm.GetCurrentState() > machine::States::kUpdateSession) {
+        state.SkipWithError("update cycle broken");
+    }
+
+    ConditionWord::Clear(machine::Conditions::kUpdateAllowed |
+                         machine::Conditions::kUpdateSessionActive);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_RuntimeScan);
+BENCHMARK(BM_Dense);
+BENCHMARK(BM_PerfectHash);
+BENCHMARK(BM_Static);
+BENCHMARK(BM_StaticRequest);
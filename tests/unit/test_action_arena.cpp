@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include "action_arena.h"
+#include "config_snapshot.h"
+#include "static_config.h"
+
+using ara::sm::ActionArena;
+using ara::sm::ActionSpan;
+using ara::sm::ConfigSnapshot;
+using ara::sm::ConfigTables;
+using ara::sm::kNoSymbol;
+using ara::sm::PackedAction;
+using ara::sm::SymbolKind;
+using ara::sm::SymbolTable;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for ActionArena (packed, contiguous action lists)
+ */
+
+// ============================================================================
+// Packing
+// ============================================================================
+
+TEST(ActionArenaTest, PackNetworkHandle)
+{
+    SymbolTable symbols;
+    PackedAction packed{};
+
+    ASSERT_TRUE(ActionArena::Pack({ActionType::kSetNetworkHandle, "VehicleNetwork", "FullCom", 0U},
+                                  symbols, packed));
+
+    EXPECT_EQ(packed.type, ActionType::kSetNetworkHandle);
+    EXPECT_STREQ(symbols.GetName(SymbolKind::kNetworkHandle, packed.target), "VehicleNetwork");
+    EXPECT_STREQ(symbols.GetName(SymbolKind::kNetworkState, packed.GetParam()), "FullCom");
+    EXPECT_EQ(packed.GetSleepTimeMs(), 0U);
+}
+
+TEST(ActionArenaTest, PackSleepUsesOperand)
+{
+    SymbolTable symbols;
+    PackedAction packed{};
+
+    ASSERT_TRUE(ActionArena::Pack({ActionType::kSleep, nullptr, nullptr, 500U}, symbols, packed));
+
+    EXPECT_EQ(packed.target, kNoSymbol);
+    EXPECT_EQ(packed.GetParam(), kNoSymbol);
+    EXPECT_EQ(packed.GetSleepTimeMs(), 500U);
+}
+
+TEST(ActionArenaTest, PackSyncTimeoutUsesOperand)
+{
+    SymbolTable symbols;
+    PackedAction packed{};
+
+    ASSERT_TRUE(ActionArena::Pack({ActionType::kSync, nullptr, nullptr, 0U, 200U}, symbols, packed));
+
+    EXPECT_EQ(packed.GetParam(), kNoSymbol);
+    EXPECT_EQ(packed.GetTimeoutMs(), 200U);
+    EXPECT_EQ(packed.GetSleepTimeMs(), 0U);
+}
+
+TEST(ActionArenaTest, PackDefaultInitialState)
+{
+    SymbolTable symbols;
+    PackedAction packed{};
+
+    ASSERT_TRUE(ActionArena::Pack({ActionType::kStartStateMachine, "InfotainmentSM", "", 0U},
+                                  symbols, packed));
+
+    EXPECT_EQ(packed.target, 0U);
+    EXPECT_EQ(packed.GetParam(), kNoSymbol);
+}
+
+// ============================================================================
+// Arena
+// ============================================================================
+
+TEST(ActionArenaTest, ListsAreAdjacent)
+{
+    const ActionItem first[] = {
+        {ActionType::kSetFunctionGroupState, "MachineFG", "Startup", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+    const ActionItem second[] = {
+        {ActionType::kSetFunctionGroupState, "MachineFG", "Running", 0U},
+    };
+
+    SymbolTable symbols;
+    ActionArena arena;
+    ActionSpan a{};
+    ActionSpan b{};
+    ASSERT_TRUE(arena.Append(first, 2U, symbols, a));
+    ASSERT_TRUE(arena.Append(second, 1U, symbols, b));
+
+    EXPECT_EQ(a.offset, 0U);
+    EXPECT_EQ(a.length, 2U);
+    EXPECT_EQ(b.offset, 2U);
+    EXPECT_EQ(b.length, 1U);
+    EXPECT_EQ(arena.GetSize(), 3U);
+    EXPECT_EQ(arena.Get(b), arena.GetData() + 2);
+
+    // Same target, one symbol
+    EXPECT_EQ(arena.Get(a)[0].target, arena.Get(b)[0].target);
+    EXPECT_EQ(symbols.GetCount(SymbolKind::kFunctionGroupState), 2U);
+}
+
+TEST(ActionArenaTest, SnapshotPacksAllListsInOneArena)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Controller",
+                               kControllerTransitions, kControllerTransitionsCount,
+                               kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                               kControllerStateHierarchy, kControllerStateHierarchyCount,
+                               kActionTable, kActionTableCount}).HasValue());
+
+    const ActionArena& arena = snapshot.GetActionArena();
+    std::size_t total = 0U;
+    for (std::size_t i = 0; i < kActionTableCount; i++) {
+        const auto* list = snapshot.FindResolvedActionList(
+            static_cast<uint8_t>(kActionTable[i].state));
+        ASSERT_NE(list, nullptr);
+        EXPECT_GE(list->actions, arena.GetData());
+        EXPECT_LE(list->actions + list->actionCount, arena.GetData() + arena.GetSize());
+        total += list->actionCount;
+    }
+    EXPECT_EQ(arena.GetSize(), total);
+
+    // Boot sequence Initial -> Startup -> Running is back to back
+    const auto* initial = snapshot.FindResolvedActionList(States::kInitial);
+    const auto* running = snapshot.FindResolvedActionList(States::kRunning);
+    EXPECT_EQ(running->actions, initial->actions + 6);
+}
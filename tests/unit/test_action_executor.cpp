@@ -191,3 +191,132 @@ TEST_F(ActionExecutorTest, ExecuteAction_UnknownActionType)
 
     executor.ExecuteAction(action);
 }
+
+// ============================================================================
+// Function Group state cache
+// ============================================================================
+
+TEST_F(ActionExecutorTest, SetFunctionGroupState_ActiveStateElided)
+{
+    const ActionItem actions[] = {
+        { ActionType::kSetFunctionGroupState, "MachineFG", "Startup", 0U },
+        { ActionType::kSync, nullptr, nullptr, 0U },
+        { ActionType::kSetFunctionGroupState, "MachineFG", "Startup", 0U },   // elided
+        { ActionType::kSetFunctionGroupState, "InfotainmentFG", "Off", 0U },
+        { ActionType::kSetFunctionGroupState, "MachineFG", "Running", 0U },
+        { ActionType::kSetFunctionGroupState, "InfotainmentFG", "Off", 0U },  // elided
+    };
+
+    executor.ExecuteActionList(actions, 6U);
+
+    EXPECT_EQ(executor.GetElidedCount(), 2U);
+    EXPECT_EQ(executor.GetElidedCount("MachineFG"), 1U);
+    EXPECT_EQ(executor.GetElidedCount("InfotainmentFG"), 1U);
+    EXPECT_EQ(executor.GetElidedCount("UnknownFG"), 0U);
+    EXPECT_STREQ(executor.GetFunctionGroupState("MachineFG"), "Running");
+    EXPECT_STREQ(executor.GetFunctionGroupState("InfotainmentFG"), "Off");
+}
+
+TEST_F(ActionExecutorTest, SetFunctionGroupState_InvalidatedStateRequested)
+{
+    const ActionItem action { ActionType::kSetFunctionGroupState, "MachineFG", "Running", 0U };
+
+    executor.ExecuteAction(action);
+    executor.InvalidateFunctionGroupStates();
+    EXPECT_EQ(executor.GetFunctionGroupState("MachineFG"), nullptr);
+
+    executor.ExecuteAction(action);
+    EXPECT_EQ(executor.GetElidedCount(), 0U);
+    EXPECT_STREQ(executor.GetFunctionGroupState("MachineFG"), "Running");
+}
+
+TEST_F(ActionExecutorTest, SetFunctionGroupState_BatchesOfTwoConfigurations)
+{
+    using ara::sm::SymbolKind;
+
+    // Same names, other IDs
+    ara::sm::SymbolTable first;
+    first.Intern(SymbolKind::kFunctionGroup, "MachineFG");
+    first.Intern(SymbolKind::kFunctionGroup, "InfotainmentFG");
+    first.Intern(SymbolKind::kFunctionGroupState, "Running");
+    ara::sm::SymbolTable second;
+    second.Intern(SymbolKind::kFunctionGroup, "InfotainmentFG");
+    second.Intern(SymbolKind::kFunctionGroup, "MachineFG");
+    second.Intern(SymbolKind::kFunctionGroupState, "Off");
+    second.Intern(SymbolKind::kFunctionGroupState, "Running");
+
+    const ara::sm::PackedAction machineRunning { ActionType::kSetFunctionGroupState, 0U, 0U, 0U };
+    const ara::sm::PackedAction inMachineRunning { ActionType::kSetFunctionGroupState, 0U, 1U, 1U };
+    const ara::sm::PackedAction inInfotainmentOff { ActionType::kSetFunctionGroupState, 0U, 0U, 0U };
+
+    const auto group = ara::sm::ActionGroup::kSetFunctionGroupState;
+    EXPECT_TRUE(executor.ExecuteActionBatch({ group, &machineRunning, 1U, &first }).HasValue());
+    EXPECT_TRUE(executor.ExecuteActionBatch({ group, &inMachineRunning, 1U, &second }).HasValue());
+    EXPECT_TRUE(executor.ExecuteActionBatch({ group, &inInfotainmentOff, 1U, &second }).HasValue());
+
+    EXPECT_EQ(executor.GetElidedCount("MachineFG"), 1U);
+    EXPECT_STREQ(executor.GetFunctionGroupState("MachineFG"), "Running");
+    EXPECT_STREQ(executor.GetFunctionGroupState("InfotainmentFG"), "Off");
+}
+
+// ============================================================================
+// Failure and compensation
+// ============================================================================
+
+TEST_F(ActionExecutorTest, FailedActionStopsList)
+{
+    const ActionItem actions[] = {
+        { ActionType::kSetFunctionGroupState, "MachineFG", nullptr, 0U },     // fails
+        { ActionType::kSetFunctionGroupState, "InfotainmentFG", "On", 0U },
+    };
+
+    const auto result = executor.ExecuteActionList(actions, 2U);
+
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), ara::sm::StateManagementErrc::kTransitionFailed);
+    EXPECT_EQ(executor.GetFunctionGroupState("InfotainmentFG"), nullptr);
+    EXPECT_EQ(executor.GetCompensatedCount(), 0U);
+}
+
+TEST_F(ActionExecutorTest, FailedSegmentCompensated)
+{
+    const ActionItem actions[] = {
+        { ActionType::kSetFunctionGroupState, "MachineFG", "Startup", 0U },
+        { ActionType::kSync, nullptr, nullptr, 0U },
+        { ActionType::kSetFunctionGroupState, "MachineFG", "Running", 0U },
+        { ActionType::kStartStateMachine, "InfotainmentSM", nullptr, 0U },
+        { ActionType::kSetFunctionGroupState, "InfotainmentFG", "On", 0U },   // no previous state
+        { ActionType::kSetFunctionGroupState, "DiagFG", nullptr, 0U },        // fails
+    };
+    executor.SetCompensationMode(ara::sm::CompensationMode::kFailedSegment);
+
+    EXPECT_FALSE(executor.ExecuteActionList(actions, 6U).HasValue());
+
+    // MachineFG back to Startup, InfotainmentSM stopped; the first segment is kept
+    EXPECT_EQ(executor.GetCompensatedCount(), 2U);
+    EXPECT_STREQ(executor.GetFunctionGroupState("MachineFG"), "Startup");
+    EXPECT_STREQ(executor.GetFunctionGroupState("InfotainmentFG"), "On");
+}
+
+TEST_F(ActionExecutorTest, CommittedSegmentNotCompensated)
+{
+    const ActionItem actions[] = {
+        { ActionType::kSetFunctionGroupState, "MachineFG", "Startup", 0U },
+        { ActionType::kSync, nullptr, nullptr, 0U },
+        { ActionType::kSetFunctionGroupState, "MachineFG", "Running", 0U },
+        { ActionType::kSync, nullptr, nullptr, 0U },
+    };
+    const ActionItem failing[] = {
+        { ActionType::kSetFunctionGroupState, "MachineFG", "Running", 0U },   // elided
+        { ActionType::kSetFunctionGroupState, "MachineFG", nullptr, 0U },     // fails
+    };
+    executor.SetCompensationMode(ara::sm::CompensationMode::kFailedSegment);
+
+    EXPECT_TRUE(executor.ExecuteActionList(actions, 4U).HasValue());
+    EXPECT_FALSE(executor.ExecuteActionList(failing, 2U).HasValue());
+
+    EXPECT_EQ(executor.GetCompensatedCount(), 0U);
+    EXPECT_EQ(executor.GetElidedCount(), 1U);
+    EXPECT_STREQ(executor.GetFunctionGroupState("MachineFG"), "Running");
+    EXPECT_TRUE(executor.ExecuteActionList(actions, 4U).HasValue());
+}
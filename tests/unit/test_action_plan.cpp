@@ -0,0 +1,413 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "action_plan.h"
+#include "action_arena.h"
+#include "action_executor.h"
+#include "config_snapshot.h"
+#include "static_config.h"
+
+using ara::sm::ActionArena;
+using ara::sm::ActionExecutor;
+using ara::sm::ActionGroup;
+using ara::sm::ActionPlan;
+using ara::sm::ActionPlanSet;
+using ara::sm::ActionSpan;
+using ara::sm::ConfigSnapshot;
+using ara::sm::PlanSegment;
+using ara::sm::SymbolKind;
+using ara::sm::SymbolTable;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for ActionPlanSet (precompiled, barrier-segmented and dependency plans)
+ */
+
+namespace {
+
+class ActionPlanTest : public ::testing::Test {
+protected:
+    ActionPlan Compile(const ActionItem* items, std::size_t count)
+    {
+        ActionSpan span{};
+        EXPECT_TRUE(arena.Append(items, count, symbols, span));
+        return plans.Get(plans.Add(arena.Get(span), span.length, items));
+    }
+
+    static std::size_t GroupSize(const PlanSegment& segment, ActionGroup group)
+    {
+        return segment.GroupEnd(group) - segment.GroupBegin(group);
+    }
+
+    SymbolTable symbols;
+    ActionArena arena;
+    ActionPlanSet plans;
+};
+
+} // namespace
+
+// ============================================================================
+// Segmentation
+// ============================================================================
+
+TEST_F(ActionPlanTest, SplitAtSync)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "MachineFG", "Startup", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kStartStateMachine, "InfotainmentSM", "", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+
+    const ActionPlan plan = Compile(items, 4U);
+
+    ASSERT_EQ(plan.segmentCount, 2U);
+    EXPECT_TRUE(plan.segments[0].sync);
+    EXPECT_TRUE(plan.segments[1].sync);
+    EXPECT_EQ(GroupSize(plan.segments[0], ActionGroup::kSetFunctionGroupState), 1U);
+    EXPECT_EQ(GroupSize(plan.segments[1], ActionGroup::kStartStateMachine), 1U);
+    EXPECT_EQ(plan.segments[1].GetActionCount(), 1U);
+    EXPECT_EQ(plan.totalSleepMs, 0U);
+}
+
+TEST_F(ActionPlanTest, GroupsByTypeWithinSegment)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetNetworkHandle, "VehicleNetwork", "FullCom", 0U},
+        {ActionType::kSetFunctionGroupState, "MachineFG", "Running", 0U},
+        {ActionType::kStartStateMachine, "InfotainmentSM", "Running", 0U},
+        {ActionType::kSetFunctionGroupState, "InfotainmentFG", "Running", 0U},
+    };
+
+    const ActionPlan plan = Compile(items, 4U);
+
+    ASSERT_EQ(plan.segmentCount, 1U);
+    const PlanSegment& segment = plan.segments[0];
+    EXPECT_FALSE(segment.sync);
+    EXPECT_EQ(GroupSize(segment, ActionGroup::kSetFunctionGroupState), 2U);
+    EXPECT_EQ(GroupSize(segment, ActionGroup::kStartStateMachine), 1U);
+    EXPECT_EQ(GroupSize(segment, ActionGroup::kStopStateMachine), 0U);
+    EXPECT_EQ(GroupSize(segment, ActionGroup::kSetNetworkHandle), 1U);
+
+    // Stable within a group
+    const auto first = segment.GroupBegin(ActionGroup::kSetFunctionGroupState);
+    EXPECT_STREQ(symbols.GetName(SymbolKind::kFunctionGroup, plan.actions[first].target),
+                 "MachineFG");
+    EXPECT_STREQ(symbols.GetName(SymbolKind::kFunctionGroup, plan.actions[first + 1].target),
+                 "InfotainmentFG");
+}
+
+TEST_F(ActionPlanTest, SleepsAreSummedAndKeepOrder)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetNetworkHandle, "VehicleNetwork", "NoCom", 0U},
+        {ActionType::kSleep, nullptr, nullptr, 300U},
+        {ActionType::kSleep, nullptr, nullptr, 200U},
+        {ActionType::kSetFunctionGroupState, "MachineFG", "Shutdown", 0U},
+    };
+
+    const ActionPlan plan = Compile(items, 4U);
+
+    // Shutdown is only issued after the sleep
+    ASSERT_EQ(plan.segmentCount, 2U);
+    EXPECT_EQ(plan.segments[0].sleepMs, 500U);
+    EXPECT_EQ(GroupSize(plan.segments[0], ActionGroup::kSetNetworkHandle), 1U);
+    EXPECT_EQ(plan.segments[1].sleepMs, 0U);
+    EXPECT_EQ(GroupSize(plan.segments[1], ActionGroup::kSetFunctionGroupState), 1U);
+    EXPECT_EQ(plan.totalSleepMs, 500U);
+}
+
+TEST_F(ActionPlanTest, TerminatorEndsPlan)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "FG1", "Running", 0U},
+        {ActionType::kSetFunctionGroupState, nullptr, nullptr, 0U},     // terminator
+        {ActionType::kSetFunctionGroupState, "FG2", "Off", 0U},
+    };
+
+    const ActionPlan plan = Compile(items, 3U);
+
+    ASSERT_EQ(plan.segmentCount, 1U);
+    EXPECT_EQ(plan.segments[0].GetActionCount(), 1U);
+    EXPECT_EQ(symbols.Find(SymbolKind::kFunctionGroup, "FG2"), 1U);     // interned, not planned
+}
+
+TEST_F(ActionPlanTest, RepeatedAndLeadingSyncCollapse)
+{
+    const ActionItem items[] = {
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kStopStateMachine, "InfotainmentSM", nullptr, 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+
+    const ActionPlan plan = Compile(items, 4U);
+
+    ASSERT_EQ(plan.segmentCount, 1U);
+    EXPECT_TRUE(plan.segments[0].sync);
+    EXPECT_EQ(GroupSize(plan.segments[0], ActionGroup::kStopStateMachine), 1U);
+}
+
+TEST_F(ActionPlanTest, SyncTimeoutOnBarrier)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "MachineFG", "Startup", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U, 200U},
+        {ActionType::kStartStateMachine, "InfotainmentSM", "", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U, 50U},
+    };
+
+    const ActionPlan plan = Compile(items, 5U);
+
+    ASSERT_EQ(plan.segmentCount, 2U);
+    EXPECT_EQ(plan.segments[0].timeoutMs, 200U);
+    EXPECT_EQ(plan.segments[1].timeoutMs, 50U);         // Repeated SYNC sets it
+}
+
+TEST_F(ActionPlanTest, EmptyList)
+{
+    const ActionPlan plan = plans.Get(plans.Add(nullptr, 0U));
+
+    EXPECT_EQ(plan.segmentCount, 0U);
+    EXPECT_EQ(plan.totalSleepMs, 0U);
+}
+
+// ============================================================================
+// Dependencies
+// ============================================================================
+
+TEST_F(ActionPlanTest, NodesInCriticalPathOrder)
+{
+    const ActionItem items[] = {
+        {ActionType::kStartStateMachine, "InfotainmentSM", "Running", 0U, 0U, 0U},
+        {ActionType::kSetFunctionGroupState, "FG1", "Running", 0U, 0U, 0U},
+        {ActionType::kSleep, nullptr, nullptr, 50U, 0U, DependsOn(1)},
+        {ActionType::kSetFunctionGroupState, "FG2", "Running", 0U, 0U, DependsOn(2)},
+        {ActionType::kSetNetworkHandle, "Net", "FullCom", 0U, 0U, DependsOn(0)},
+    };
+
+    const ActionPlan plan = Compile(items, 5U);
+
+    // FG1 (52) | sleep (51) | Start SM (2) | FG2 (1) | Net (1)
+    ASSERT_EQ(plan.nodeCount, 5U);
+    EXPECT_EQ(plan.criticalPathMs, 52U);
+    const uint32_t ranks[] = {52U, 51U, 2U, 1U, 1U};
+    const ActionType types[] = {ActionType::kSetFunctionGroupState, ActionType::kSleep,
+                                ActionType::kStartStateMachine, ActionType::kSetFunctionGroupState,
+                                ActionType::kSetNetworkHandle};
+    for (std::size_t n = 0; n < 5U; n++) {
+        EXPECT_EQ(plan.nodes[n].rank, ranks[n]) << n;
+        EXPECT_EQ(plan.actions[plan.nodes[n].action].type, types[n]) << n;
+    }
+
+    // FG1 -> sleep -> FG2, Start SM -> Net
+    ASSERT_EQ(plan.nodes[0].successorCount, 1U);
+    EXPECT_EQ(plan.successors[plan.nodes[0].firstSuccessor], 1U);
+    ASSERT_EQ(plan.nodes[2].successorCount, 1U);
+    EXPECT_EQ(plan.successors[plan.nodes[2].firstSuccessor], 4U);
+    EXPECT_EQ(plan.nodes[0].dependencyCount, 0U);
+    EXPECT_EQ(plan.nodes[4].dependencyCount, 1U);
+}
+
+TEST_F(ActionPlanTest, DependenciesLinearizedWithBarriers)
+{
+    const ActionItem items[] = {
+        {ActionType::kStartStateMachine, "InfotainmentSM", "Running", 0U, 0U, 0U},
+        {ActionType::kSetFunctionGroupState, "FG1", "Running", 0U, 0U, 0U},
+        {ActionType::kSleep, nullptr, nullptr, 50U, 0U, DependsOn(1)},
+        {ActionType::kSetFunctionGroupState, "FG2", "Running", 0U, 0U, DependsOn(2)},
+        {ActionType::kSetNetworkHandle, "Net", "FullCom", 0U, 0U, DependsOn(0)},
+    };
+
+    const ActionPlan plan = Compile(items, 5U);
+
+    // Start SM, FG1 | SYNC, sleep 50 | FG2, Net (Start SM is already behind the SYNC)
+    ASSERT_EQ(plan.segmentCount, 3U);
+    EXPECT_TRUE(plan.segments[0].sync);
+    EXPECT_EQ(plan.segments[0].GetActionCount(), 2U);
+    EXPECT_EQ(plan.segments[1].sleepMs, 50U);
+    EXPECT_EQ(plan.segments[1].GetActionCount(), 0U);
+    EXPECT_EQ(plan.segments[2].GetActionCount(), 2U);
+    EXPECT_FALSE(plan.segments[2].sync);
+}
+
+TEST_F(ActionPlanTest, NoNodesWithoutDependencies)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "FG1", "Running", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+
+    const ActionPlan plan = Compile(items, 2U);
+
+    EXPECT_EQ(plan.nodeCount, 0U);
+    EXPECT_EQ(plan.nodes, nullptr);
+    EXPECT_EQ(plan.criticalPathMs, 0U);
+}
+
+// ============================================================================
+// Snapshot and executor
+// ============================================================================
+
+TEST_F(ActionPlanTest, SnapshotCompilesControllerShutdown)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Controller",
+                               kControllerTransitions, kControllerTransitionsCount,
+                               kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                               kControllerStateHierarchy, kControllerStateHierarchyCount,
+                               kActionTable, kActionTableCount}).HasValue());
+
+    // Linearized: Stop SM, NoCom | SYNC, sleep 500 | MachineFG Shutdown
+    const ActionPlan& plan = snapshot.FindResolvedActionList(States::kShutdown)->plan;
+    ASSERT_EQ(plan.segmentCount, 3U);
+    EXPECT_TRUE(plan.segments[0].sync);
+    EXPECT_EQ(plan.segments[0].GetActionCount(), 2U);
+    EXPECT_EQ(plan.segments[1].sleepMs, 500U);
+    EXPECT_FALSE(plan.segments[1].sync);
+    EXPECT_EQ(plan.segments[2].GetActionCount(), 1U);
+    EXPECT_EQ(plan.totalSleepMs, 500U);
+
+    // Graph: NoCom -> sleep 500 -> MachineFG <- Stop SM
+    ASSERT_EQ(plan.nodeCount, 4U);
+    EXPECT_EQ(plan.criticalPathMs, 502U);
+    EXPECT_EQ(plan.actions[plan.nodes[0].action].type, ActionType::kSetNetworkHandle);
+    EXPECT_EQ(plan.actions[plan.nodes[1].action].type, ActionType::kSleep);
+    EXPECT_EQ(plan.actions[plan.nodes[2].action].type, ActionType::kStopStateMachine);
+    EXPECT_EQ(plan.actions[plan.nodes[3].action].type, ActionType::kSetFunctionGroupState);
+    EXPECT_EQ(plan.nodes[3].dependencyCount, 2U);
+}
+
+TEST_F(ActionPlanTest, ActionExecutorRunsPlan)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "FG1", "Running", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kSetNetworkHandle, "Net", "FullCom", 0U},
+        {ActionType::kSleep, nullptr, nullptr, 1U},
+        {ActionType::kStopStateMachine, "SM", nullptr, 0U},
+        {ActionType::kStartStateMachine, "SM", "Running", 0U},
+    };
+    ActionSpan span{};
+    ASSERT_TRUE(arena.Append(items, 6U, symbols, span));
+    const ActionPlan plan = plans.Get(plans.Add(arena.Get(span), span.length));
+
+    ActionExecutor executor;
+    executor.ExecuteResolvedActionList({States::kRunning, arena.Get(span), items, 6U,
+                                        &symbols, plan});
+    EXPECT_TRUE(executor.GetListResult().HasValue());
+}
+
+TEST_F(ActionPlanTest, ActionExecutorOverlapsIndependentChains)
+{
+    // The second sleep only waits for Net, not for the first sleep
+    const ActionItem items[] = {
+        {ActionType::kSleep, nullptr, nullptr, 150U, 0U, 0U},
+        {ActionType::kSetNetworkHandle, "Net", "NoCom", 0U, 0U, 0U},
+        {ActionType::kSleep, nullptr, nullptr, 150U, 0U, DependsOn(1)},
+        {ActionType::kSetFunctionGroupState, "FG1", "Off", 0U, 0U, DependsOn(0) | DependsOn(2)},
+    };
+    ActionSpan span{};
+    ASSERT_TRUE(arena.Append(items, 4U, symbols, span));
+    const ActionPlan plan = plans.Get(plans.Add(arena.Get(span), span.length, items));
+    ASSERT_EQ(plan.totalSleepMs, 300U);
+
+    ActionExecutor executor;
+    const auto begin = std::chrono::steady_clock::now();
+    executor.ExecuteResolvedActionList({States::kRunning, arena.Get(span), items, 4U,
+                                        &symbols, plan});
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_TRUE(executor.GetListResult().HasValue());
+    EXPECT_GE(elapsed, std::chrono::milliseconds(150));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(280));
+    ASSERT_NE(executor.GetFunctionGroupState("FG1"), nullptr);
+    EXPECT_STREQ(executor.GetFunctionGroupState("FG1"), "Off");
+}
+
+TEST_F(ActionPlanTest, ListDeadlineStopsGraph)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetNetworkHandle, "Net", "FullCom", 0U, 0U, 0U},
+        {ActionType::kSleep, nullptr, nullptr, 2000U, 0U, DependsOn(0)},
+        {ActionType::kSetFunctionGroupState, "FG1", "Running", 0U, 0U, DependsOn(1)},
+    };
+    ActionSpan span{};
+    ASSERT_TRUE(arena.Append(items, 3U, symbols, span));
+    const ActionPlan plan = plans.Get(plans.Add(arena.Get(span), span.length, items));
+
+    ActionExecutor executor;
+    const auto begin = std::chrono::steady_clock::now();
+    executor.ExecuteResolvedActionList({States::kRunning, arena.Get(span), items, 3U,
+                                        &symbols, plan, 50U});
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+    ASSERT_FALSE(executor.GetListResult().HasValue());
+    EXPECT_EQ(executor.GetFunctionGroupState("FG1"), nullptr);     // Not issued
+}
+
+TEST_F(ActionPlanTest, ListDeadlineCutsSleepAndSkipsRest)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetNetworkHandle, "Net", "FullCom", 0U},
+        {ActionType::kSleep, nullptr, nullptr, 2000U},
+        {ActionType::kSetFunctionGroupState, "FG1", "Running", 0U},
+    };
+    ActionSpan span{};
+    ASSERT_TRUE(arena.Append(items, 3U, symbols, span));
+    const ActionPlan plan = plans.Get(plans.Add(arena.Get(span), span.length));
+
+    ActionExecutor executor;
+    const auto begin = std::chrono::steady_clock::now();
+    executor.ExecuteResolvedActionList({States::kRunning, arena.Get(span), items, 3U,
+                                        &symbols, plan, 50U});
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+    ASSERT_FALSE(executor.GetListResult().HasValue());
+    EXPECT_EQ(executor.GetListResult().Error(), ara::sm::StateManagementErrc::kTransitionFailed);
+    EXPECT_EQ(executor.GetFunctionGroupState("FG1"), nullptr);     // Not issued
+}
+
+TEST_F(ActionPlanTest, ListDeadlineInFinalSleepFails)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetNetworkHandle, "Net", "FullCom", 0U},
+        {ActionType::kSleep, nullptr, nullptr, 2000U},
+    };
+    ActionSpan span{};
+    ASSERT_TRUE(arena.Append(items, 2U, symbols, span));
+    const ActionPlan plan = plans.Get(plans.Add(arena.Get(span), span.length));
+
+    ActionExecutor executor;
+    const auto begin = std::chrono::steady_clock::now();
+    const auto result = executor.ExecuteResolvedActionList({States::kRunning, arena.Get(span), items, 2U,
+                                                            &symbols, plan, 50U});
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), ara::sm::StateManagementErrc::kTransitionFailed);
+}
+
+TEST_F(ActionPlanTest, ItemListDeadline)
+{
+    const ActionItem items[] = {
+        {ActionType::kSleep, nullptr, nullptr, 2000U},
+        {ActionType::kSetFunctionGroupState, "FG1", "Running", 0U},
+    };
+
+    ActionExecutor executor;
+    const auto begin = std::chrono::steady_clock::now();
+    const auto result = executor.ExecuteActionList(items, 2U, 50U);
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(executor.GetFunctionGroupState("FG1"), nullptr);     // Not issued
+    EXPECT_TRUE(executor.ExecuteActionList(items + 1, 1U, 50U).HasValue());
+}
@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "i_batch_action_executor.h"
+#include "action_executor.h"
+#include "config_snapshot.h"
+#include "state_machine.h"
+#include "static_config.h"
+
+using ara::sm::ActionArena;
+using ara::sm::ActionBatch;
+using ara::sm::ActionExecutor;
+using ara::sm::ActionGroup;
+using ara::sm::ActionPlanSet;
+using ara::sm::ActionSpan;
+using ara::sm::ConfigSnapshot;
+using ara::sm::IBatchActionExecutor;
+using ara::sm::StateMachine;
+using ara::sm::SymbolTable;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for IBatchActionExecutor (one call per typed segment)
+ */
+
+namespace {
+
+struct Call {
+    ActionGroup group;              ///< kCount for a barrier
+    std::size_t count;
+    uint32_t sleepMs;
+    bool sync;
+    uint32_t timeoutMs;
+};
+
+class RecordingBatchExecutor final : public IBatchActionExecutor {
+public:
+    Result ExecuteActionList(const ActionItem*, size_t) override { ++itemListCalls; return Result(); }
+    Result ExecuteAction(const ActionItem&) override { ++itemCalls; return Result(); }
+
+    Result ExecuteActionBatch(const ActionBatch& batch) override
+    {
+        calls.push_back({batch.group, batch.count, 0U, false, 0U});
+        for (std::size_t i = 0; i < batch.count; i++) {
+            targets.emplace_back(batch.symbols->GetName(
+                SymbolTable::TargetKind(batch.actions[i].type), batch.actions[i].target));
+        }
+        return Result();
+    }
+
+    Result ExecuteSegmentBarrier(uint32_t sleepMs, bool sync, uint32_t timeoutMs) override
+    {
+        calls.push_back({ActionGroup::kCount, 0U, sleepMs, sync, timeoutMs});
+        return Result();
+    }
+
+    bool ListAborted() override { return calls.size() >= abortAfter; }
+
+    std::vector<Call> calls;
+    std::vector<std::string> targets;
+    std::size_t abortAfter{SIZE_MAX};   ///< Calls after which the list is aborted
+    int itemListCalls{0};
+    int itemCalls{0};
+};
+
+void LoadController(ConfigSnapshot& snapshot)
+{
+    ASSERT_TRUE(snapshot.Load({"Controller",
+                               kControllerTransitions, kControllerTransitionsCount,
+                               kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                               kControllerStateHierarchy, kControllerStateHierarchyCount,
+                               kActionTable, kActionTableCount}).HasValue());
+}
+
+} // namespace
+
+// ============================================================================
+// Batching
+// ============================================================================
+
+TEST(BatchActionExecutorTest, SameTypeActionsInOneCall)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "MachineFG", "Running", 0U},
+        {ActionType::kSetNetworkHandle, "VehicleNetwork", "FullCom", 0U},
+        {ActionType::kSetFunctionGroupState, "InfotainmentFG", "Running", 0U},
+        {ActionType::kSetFunctionGroupState, "DiagFG", "Running", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+    SymbolTable symbols;
+    ActionArena arena;
+    ActionPlanSet plans;
+    ActionSpan span{};
+    ASSERT_TRUE(arena.Append(items, 5U, symbols, span));
+    const auto plan = plans.Get(plans.Add(arena.Get(span), span.length));
+
+    RecordingBatchExecutor executor;
+    executor.ExecuteResolvedActionList({States::kRunning, arena.Get(span), items, 5U,
+                                        &symbols, plan});
+
+    ASSERT_EQ(executor.calls.size(), 3U);
+    EXPECT_EQ(executor.calls[0].group, ActionGroup::kSetFunctionGroupState);
+    EXPECT_EQ(executor.calls[0].count, 3U);
+    EXPECT_EQ(executor.calls[1].group, ActionGroup::kSetNetworkHandle);
+    EXPECT_EQ(executor.calls[1].count, 1U);
+    EXPECT_EQ(executor.calls[2].group, ActionGroup::kCount);
+    EXPECT_TRUE(executor.calls[2].sync);
+
+    const std::vector<std::string> expected{"MachineFG", "InfotainmentFG", "DiagFG",
+                                            "VehicleNetwork"};
+    EXPECT_EQ(executor.targets, expected);
+    EXPECT_EQ(executor.itemCalls, 0);
+    EXPECT_EQ(executor.itemListCalls, 0);
+}
+
+TEST(BatchActionExecutorTest, ControllerShutdownBarriers)
+{
+    ConfigSnapshot snapshot;
+    LoadController(snapshot);
+    RecordingBatchExecutor executor;
+
+    // Dependency list walked as its barrier linearization
+    executor.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kShutdown));
+
+    // Stop SM, NoCom | SYNC | sleep 500 | MachineFG Shutdown
+    ASSERT_EQ(executor.calls.size(), 5U);
+    EXPECT_EQ(executor.calls[0].group, ActionGroup::kStopStateMachine);
+    EXPECT_EQ(executor.calls[1].group, ActionGroup::kSetNetworkHandle);
+    EXPECT_TRUE(executor.calls[2].sync);
+    EXPECT_EQ(executor.calls[2].sleepMs, 0U);
+    EXPECT_EQ(executor.calls[3].sleepMs, 500U);
+    EXPECT_FALSE(executor.calls[3].sync);
+    EXPECT_EQ(executor.calls[4].group, ActionGroup::kSetFunctionGroupState);
+}
+
+TEST(BatchActionExecutorTest, AbortedListStopsBeforeNextSegment)
+{
+    ConfigSnapshot snapshot;
+    LoadController(snapshot);
+    RecordingBatchExecutor executor;
+    executor.abortAfter = 3U;
+
+    // Stop SM, NoCom | SYNC, then aborted before the sleep
+    executor.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kShutdown));
+
+    ASSERT_EQ(executor.calls.size(), 3U);
+    EXPECT_TRUE(executor.calls[2].sync);
+}
+
+TEST(BatchActionExecutorTest, NoBarrierWithoutSleepOrSync)
+{
+    const ActionItem items[] = {
+        {ActionType::kStartStateMachine, "InfotainmentSM", "", 0U},
+    };
+    SymbolTable symbols;
+    ActionArena arena;
+    ActionPlanSet plans;
+    ActionSpan span{};
+    ASSERT_TRUE(arena.Append(items, 1U, symbols, span));
+    const auto plan = plans.Get(plans.Add(arena.Get(span), span.length));
+
+    RecordingBatchExecutor executor;
+    executor.ExecuteResolvedActionList({States::kRunning, arena.Get(span), items, 1U,
+                                        &symbols, plan});
+
+    ASSERT_EQ(executor.calls.size(), 1U);
+    EXPECT_EQ(executor.calls[0].group, ActionGroup::kStartStateMachine);
+}
+
+// ============================================================================
+// StateMachine and ActionExecutor
+// ============================================================================
+
+TEST(BatchActionExecutorTest, StateMachineHandsOverBatches)
+{
+    RecordingBatchExecutor executor;
+    StateMachine sm("SM", StateMachine::Category::kController, &executor);
+
+    sm.Start(StateMachine::State::kInitial);
+    executor.calls.clear();
+    executor.targets.clear();
+
+    // Startup list: MachineFG Startup | SYNC
+    ASSERT_TRUE(sm.RequestTransition(Triggers::kStartup).HasValue());
+
+    ASSERT_EQ(executor.calls.size(), 2U);
+    EXPECT_EQ(executor.calls[0].group, ActionGroup::kSetFunctionGroupState);
+    EXPECT_TRUE(executor.calls[1].sync);
+    const std::vector<std::string> expected{"MachineFG"};
+    EXPECT_EQ(executor.targets, expected);
+    EXPECT_EQ(executor.itemCalls, 0);
+}
+
+TEST(BatchActionExecutorTest, ActionExecutorIsBatchExecutor)
+{
+    ConfigSnapshot snapshot;
+    LoadController(snapshot);
+    ActionExecutor executor;
+    IBatchActionExecutor& batch = executor;
+
+    batch.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kRunning));
+    batch.ExecuteSegmentBarrier(0U, true, 0U);
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "binary_config.h"
+#include "static_config.h"
+
+using ara::sm::BinaryConfigImage;
+using ara::sm::StateManagementErrc;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for BinaryConfigImage (memory-mapped config format)
+ */
+
+namespace {
+
+std::vector<uint8_t> BuildControllerImage()
+{
+    return BinaryConfigImage::Build(
+        "Controller",
+        kControllerTransitions, kControllerTransitionsCount,
+        kControllerErrorRecovery, kControllerErrorRecoveryCount,
+        kControllerStateHierarchy, kControllerStateHierarchyCount,
+        kActionTable, kActionTableCount);
+}
+
+bool SameText(const char* a, const char* b)
+{
+    if (a == nullptr || b == nullptr) {
+        return a == b;
+    }
+    return std::strcmp(a, b) == 0;
+}
+
+void ExpectControllerTables(const BinaryConfigImage& image)
+{
+    ASSERT_EQ(image.GetTransitionCount(), kControllerTransitionsCount);
+    for (std::size_t i = 0; i < kControllerTransitionsCount; i++) {
+        EXPECT_EQ(image.GetTransitions()[i].fromState, kControllerTransitions[i].fromState);
+        EXPECT_EQ(image.GetTransitions()[i].trigger, kControllerTransitions[i].trigger);
+        EXPECT_EQ(image.GetTransitions()[i].toState, kControllerTransitions[i].toState);
+        EXPECT_EQ(image.GetTransitions()[i].guard.allOf, kControllerTransitions[i].guard.allOf);
+    }
+
+    ASSERT_EQ(image.GetHierarchyCount(), kControllerStateHierarchyCount);
+    EXPECT_EQ(image.GetHierarchy()[0].parentState, kControllerStateHierarchy[0].parentState);
+
+    ASSERT_EQ(image.GetActionListCount(), kActionTableCount);
+    for (std::size_t i = 0; i < kActionTableCount; i++) {
+        const auto& list = image.GetActionLists()[i];
+        EXPECT_EQ(list.state, kActionTable[i].state);
+        EXPECT_EQ(list.timeoutMs, kActionTable[i].timeoutMs);
+        ASSERT_EQ(list.actionCount, kActionTable[i].actionCount);
+        for (std::size_t a = 0; a < list.actionCount; a++) {
+            const auto action = image.GetAction(list.firstAction + a);
+            EXPECT_EQ(action.type, kActionTable[i].actions[a].type);
+            EXPECT_TRUE(SameText(action.target, kActionTable[i].actions[a].target));
+            EXPECT_TRUE(SameText(action.param, kActionTable[i].actions[a].param));
+            EXPECT_EQ(action.sleepTimeMs, kActionTable[i].actions[a].sleepTimeMs);
+            EXPECT_EQ(action.timeoutMs, kActionTable[i].actions[a].timeoutMs);
+            EXPECT_EQ(action.dependsOn, kActionTable[i].actions[a].dependsOn);
+        }
+    }
+}
+
+} // namespace
+
+TEST(BinaryConfigTest, BuildAndAttachRoundTrip)
+{
+    const auto bytes = BuildControllerImage();
+
+    BinaryConfigImage image;
+    ASSERT_TRUE(image.Attach(bytes.data(), bytes.size()).HasValue());
+
+    EXPECT_STREQ(image.GetName(), "Controller");
+    EXPECT_EQ(image.GetErrorRecoveryCount(), kControllerErrorRecoveryCount);
+    ExpectControllerTables(image);
+
+    // Used in place, not copied
+    EXPECT_EQ(image.GetData(), bytes.data());
+    EXPECT_GE(reinterpret_cast<const uint8_t*>(image.GetTransitions()), bytes.data());
+    EXPECT_LT(reinterpret_cast<const uint8_t*>(image.GetTransitions()), bytes.data() + bytes.size());
+}
+
+TEST(BinaryConfigTest, OpenMapsFile)
+{
+    const std::string path = ::testing::TempDir() + "ara_sm_controller.smcfg";
+    ASSERT_TRUE(BinaryConfigImage::WriteFile(path, BuildControllerImage()).HasValue());
+
+    BinaryConfigImage image;
+    ASSERT_TRUE(image.Open(path).HasValue());
+    ExpectControllerTables(image);
+
+    BinaryConfigImage moved(std::move(image));
+    EXPECT_FALSE(image.IsOpen());
+    EXPECT_TRUE(moved.IsOpen());
+    EXPECT_STREQ(moved.GetName(), "Controller");
+
+    std::remove(path.c_str());
+}
+
+TEST(BinaryConfigTest, CorruptImagesRejected)
+{
+    const auto good = BuildControllerImage();
+    BinaryConfigImage image;
+
+    auto flipped = good;
+    flipped[flipped.size() / 2U] ^= 0x40U;
+    auto r = image.Attach(flipped.data(), flipped.size());
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kInvalidValue);
+    EXPECT_FALSE(image.IsOpen());
+
+    auto badMagic = good;
+    badMagic[0] ^= 0xFFU;
+    EXPECT_FALSE(image.Attach(badMagic.data(), badMagic.size()).HasValue());
+
+    EXPECT_FALSE(image.Attach(good.data(), good.size() - 4U).HasValue());
+    EXPECT_FALSE(image.Attach(good.data(), 8U).HasValue());
+}
+
+TEST(BinaryConfigTest, MissingFile)
+{
+    BinaryConfigImage image;
+    auto r = image.Open("/nonexistent/ara_sm.smcfg");
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kOperationFailed);
+}
+
+TEST(BinaryConfigTest, ImageFromManifestMatchesStaticConfig)
+{
+    BinaryConfigImage image;
+    ASSERT_TRUE(image.Open(std::string(ARA_SM_GENERATED_DIR) + "/controller_machine.smcfg").HasValue());
+
+    EXPECT_STREQ(image.GetName(), "controller_machine");
+    ExpectControllerTables(image);
+}
+
+TEST(BinaryConfigTest, Crc32KnownValue)
+{
+    const char* text = "123456789";
+    EXPECT_EQ(BinaryConfigImage::Crc32(reinterpret_cast<const uint8_t*>(text), 9U), 0xCBF43926U);
+}
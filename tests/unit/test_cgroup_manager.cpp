@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "cgroup_manager.h"
+#include "local_execution_manager.h"
+#include "static_config.h"
+
+using ara::sm::CgroupManager;
+using ara::sm::LocalExecutionManager;
+using ara::sm::StateManagementErrc;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for CgroupManager (cgroup v2 resource isolation)
+ *
+ * A temporary directory stands in for the cgroup file system; the
+ * interface files a kernel would provide are created by the fixture.
+ */
+
+namespace {
+
+constexpr ResourceItem kTestResources[] = {
+    {"CriticalFG", nullptr, 800, 500, nullptr},
+    {"CriticalFG", "Verify", 1000, 1000, nullptr},
+    {"LowFG", nullptr, 0, 0, nullptr},
+    {"LowFG", "Verify", 20, 10, "0"},
+};
+
+constexpr std::size_t kTestResourceCount = sizeof(kTestResources) / sizeof(ResourceItem);
+
+constexpr ProcessItem kTestProcesses[] = {
+    {"LowFG", "Running", "A", {"/bin/sh", "-c", "printf R >&3; exec sleep 30", nullptr}},
+};
+
+class CgroupManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        char path[] = "/tmp/ara_sm_cgroup_XXXXXX";
+        ASSERT_NE(mkdtemp(path), nullptr);
+        root = path;
+
+        // Controllers as enabled by the kernel: LowFG has no cpuset
+        CreateGroup("CriticalFG", {"cpu.weight", "io.weight", "cpuset.cpus", "cgroup.procs"});
+        CreateGroup("LowFG", {"cpu.weight", "io.weight", "cgroup.procs"});
+    }
+
+    void TearDown() override
+    {
+        std::system(("rm -rf " + root).c_str());
+    }
+
+    void CreateGroup(const std::string& group, std::initializer_list<const char*> files)
+    {
+        std::system(("mkdir -p " + root + "/" + group).c_str());
+        for (const char* file : files) {
+            std::ofstream(root + "/" + group + "/" + file);
+        }
+    }
+
+    std::string ReadFile(const std::string& group, const char* file) const
+    {
+        std::ifstream in(root + "/" + group + "/" + file);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    bool Exists(const std::string& group, const char* file) const
+    {
+        return std::ifstream(root + "/" + group + "/" + file).good();
+    }
+
+    std::string root;
+};
+
+} // namespace
+
+// ============================================================================
+// Limits
+// ============================================================================
+
+TEST_F(CgroupManagerTest, StateLimitsWritten)
+{
+    CgroupManager cgroups(kTestResources, kTestResourceCount, root);
+    ASSERT_TRUE(cgroups.Open().HasValue());
+
+    ASSERT_TRUE(cgroups.ApplyState("CriticalFG", "Verify").HasValue());
+
+    EXPECT_EQ(ReadFile("CriticalFG", "cpu.weight"), "1000");
+    EXPECT_EQ(ReadFile("CriticalFG", "io.weight"), "default 1000");
+    EXPECT_EQ(ReadFile("CriticalFG", "cpuset.cpus"), "");
+}
+
+TEST_F(CgroupManagerTest, GroupLimitsForOtherStates)
+{
+    CgroupManager cgroups(kTestResources, kTestResourceCount, root);
+    ASSERT_TRUE(cgroups.Open().HasValue());
+
+    ASSERT_TRUE(cgroups.ApplyState("CriticalFG", "Running").HasValue());
+
+    EXPECT_EQ(ReadFile("CriticalFG", "cpu.weight"), "800");
+    EXPECT_EQ(ReadFile("CriticalFG", "io.weight"), "default 500");
+}
+
+TEST_F(CgroupManagerTest, TightenedLimitsReset)
+{
+    CgroupManager cgroups(kTestResources, kTestResourceCount, root);
+    ASSERT_TRUE(cgroups.Open().HasValue());
+
+    ASSERT_TRUE(cgroups.ApplyState("LowFG", "Verify").HasValue());
+    EXPECT_EQ(ReadFile("LowFG", "cpu.weight"), "20");
+    EXPECT_EQ(ReadFile("LowFG", "io.weight"), "default 10");
+
+    // Group entry without limits: back to the defaults
+    ASSERT_TRUE(cgroups.ApplyState("LowFG", "Running").HasValue());
+    EXPECT_EQ(ReadFile("LowFG", "cpu.weight"), "100");
+    EXPECT_EQ(ReadFile("LowFG", "io.weight"), "default 100");
+}
+
+TEST_F(CgroupManagerTest, MissingControllerSkipped)
+{
+    CgroupManager cgroups(kTestResources, kTestResourceCount, root);
+    ASSERT_TRUE(cgroups.Open().HasValue());
+
+    EXPECT_TRUE(cgroups.ApplyState("LowFG", "Verify").HasValue());
+    EXPECT_FALSE(Exists("LowFG", "cpuset.cpus"));
+}
+
+TEST_F(CgroupManagerTest, UnconfiguredGroupCreated)
+{
+    CgroupManager cgroups(kTestResources, kTestResourceCount, root);
+    ASSERT_TRUE(cgroups.Open().HasValue());
+
+    EXPECT_EQ(cgroups.FindLimits("OtherFG", "Running"), nullptr);
+    EXPECT_TRUE(cgroups.ApplyState("OtherFG", "Running").HasValue());
+    EXPECT_EQ(cgroups.GetPath("OtherFG"), root + "/OtherFG");
+    EXPECT_TRUE(std::ifstream(root + "/OtherFG").good());
+}
+
+TEST_F(CgroupManagerTest, FindLimits)
+{
+    CgroupManager cgroups(kTestResources, kTestResourceCount, root);
+
+    EXPECT_EQ(cgroups.FindLimits("LowFG", "Verify"), &kTestResources[3]);
+    EXPECT_EQ(cgroups.FindLimits("LowFG", "Off"), &kTestResources[2]);
+    EXPECT_EQ(cgroups.FindLimits("CriticalFG", "Verify"), &kTestResources[1]);
+}
+
+// ============================================================================
+// Processes
+// ============================================================================
+
+TEST_F(CgroupManagerTest, AttachWritesPid)
+{
+    CgroupManager cgroups(kTestResources, kTestResourceCount, root);
+    ASSERT_TRUE(cgroups.Open().HasValue());
+
+    ASSERT_TRUE(cgroups.Attach("CriticalFG", 1234).HasValue());
+    EXPECT_EQ(ReadFile("CriticalFG", "cgroup.procs"), "1234");
+}
+
+TEST_F(CgroupManagerTest, ExecutionManagerAppliesAndAttaches)
+{
+    CgroupManager cgroups(kTestResources, kTestResourceCount, root);
+    ASSERT_TRUE(cgroups.Open().HasValue());
+
+    LocalExecutionManager em(kTestProcesses, 1U);
+    if (!em.Open().HasValue()) {
+        GTEST_SKIP() << "No pidfd/epoll support on this host";
+    }
+    em.SetCgroupManager(&cgroups);
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("LowFG", "Verify").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+    EXPECT_EQ(ReadFile("LowFG", "cpu.weight"), "20");
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("LowFG", "Running").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+    EXPECT_EQ(ReadFile("LowFG", "cpu.weight"), "100");
+    EXPECT_EQ(ReadFile("LowFG", "cgroup.procs"), std::to_string(em.GetPid("LowFG", "A")));
+}
+
+TEST(CgroupManagerStandaloneTest, NotOpen)
+{
+    CgroupManager cgroups(kTestResources, kTestResourceCount, "/nonexistent/ara_sm");
+
+    EXPECT_FALSE(cgroups.ApplyState("LowFG", "Running").HasValue());
+    EXPECT_FALSE(cgroups.Attach("LowFG", 1).HasValue());
+    EXPECT_FALSE(cgroups.Open().HasValue());
+}
@@ -0,0 +1,354 @@
+#include <gtest/gtest.h>
+
+#include "compiled_rule_table.h"
+#include "transition_table.h"
+#include "error_recovery.h"
+#include "static_config.h"
+
+using ara::sm::CompiledRuleTable;
+using ara::sm::TransitionTable;
+using ara::sm::ErrorRecoveryTable;
+using ara::sm::StateMachine;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for CompiledRuleTable (hierarchical state flattening)
+ *
+ * AUTOSAR:
+ *  - SWS_SM_00603 – SWS_SM_00607
+ *  - SWS_SM_00601, SWS_SM_CONSTR_00014
+ */
+
+namespace {
+
+constexpr uint32_t kParent = 50;
+constexpr uint32_t kGrandParent = 51;
+constexpr uint32_t kChild = 52;
+constexpr uint32_t kSibling = 53;
+
+const StateHierarchyRule kHierarchy[] = {
+    {kChild, kParent},
+    {kSibling, kParent},
+    {kParent, kGrandParent},
+};
+
+} // namespace
+
+// ============================================================================
+// Transitions
+// ============================================================================
+
+TEST(CompiledRuleTableTest, Transition_InheritedFromParentAndGrandParent)
+{
+    const TransitionRule rules[] = {
+        {kGrandParent, 7U, States::kOff},
+        {kParent, 5U, States::kRunning},
+        {kChild, 6U, States::kDegraded},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 3U, kHierarchy, 3U);
+
+    EXPECT_EQ(table.Find(kChild, 6U), States::kDegraded);
+    EXPECT_EQ(table.Find(kChild, 5U), States::kRunning);
+    EXPECT_EQ(table.Find(kChild, 7U), States::kOff);
+    EXPECT_EQ(table.Find(kSibling, 5U), States::kRunning);
+    EXPECT_EQ(table.Find(kSibling, 6U), CompiledRuleTable::kNoMatch);
+}
+
+TEST(CompiledRuleTableTest, Transition_ChildOverridesParent)
+{
+    const TransitionRule rules[] = {
+        {kParent, 5U, States::kRunning},
+        {kChild, 5U, States::kShutdown},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 2U, kHierarchy, 3U);
+
+    EXPECT_EQ(table.Find(kChild, 5U), States::kShutdown);
+    EXPECT_EQ(table.Find(kSibling, 5U), States::kRunning);
+}
+
+TEST(CompiledRuleTableTest, Transition_UnknownStateOrKey)
+{
+    const TransitionRule rules[] = {
+        {kParent, 5U, States::kRunning},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 1U, nullptr, 0U);
+
+    EXPECT_EQ(table.Find(0xAAU, 5U), CompiledRuleTable::kNoMatch);
+    EXPECT_EQ(table.Find(kParent, 0xAAAAU), CompiledRuleTable::kNoMatch);
+    EXPECT_EQ(table.GetStateCount(), 1U);
+    EXPECT_EQ(table.GetKeyCount(), 1U);
+}
+
+TEST(CompiledRuleTableTest, Transition_LargeSparseKeys)
+{
+    const TransitionRule rules[] = {
+        {kParent, 0x80000000U, States::kRunning},
+        {kChild, 3U, States::kOff},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 2U, kHierarchy, 3U);
+
+    EXPECT_EQ(table.Find(kChild, 0x80000000U), States::kRunning);
+    EXPECT_EQ(table.Find(kChild, 3U), States::kOff);
+    EXPECT_EQ(table.Find(kChild, 4U), CompiledRuleTable::kNoMatch);
+}
+
+TEST(CompiledRuleTableTest, Transition_CyclicHierarchyTerminates)
+{
+    const StateHierarchyRule cyclic[] = {
+        {kChild, kParent},
+        {kParent, kChild},
+    };
+    const TransitionRule rules[] = {
+        {kParent, 5U, States::kRunning},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 1U, cyclic, 2U);
+
+    EXPECT_EQ(table.Find(kChild, 5U), States::kRunning);
+    EXPECT_EQ(table.Find(kChild, 6U), CompiledRuleTable::kNoMatch);
+}
+
+// ============================================================================
+// Error recovery (wildcard)
+// ============================================================================
+
+TEST(CompiledRuleTableTest, Recovery_ExactBeatsWildcardOnSameLevel)
+{
+    const ErrorRecoveryRule rules[] = {
+        {kChild, kExecutionErrorAny, States::kOff},
+        {kChild, ExecutionErrors::kProcessCrashed, States::kDegraded},
+    };
+
+    const auto table = CompiledRuleTable::FromErrorRecovery(rules, 2U, kHierarchy, 3U);
+
+    EXPECT_EQ(table.Find(kChild, ExecutionErrors::kProcessCrashed), States::kDegraded);
+    EXPECT_EQ(table.Find(kChild, 0x12345678U), States::kOff);
+}
+
+TEST(CompiledRuleTableTest, Recovery_ChildWildcardBeatsParentExact)
+{
+    const ErrorRecoveryRule rules[] = {
+        {kParent, ExecutionErrors::kMemoryViolation, States::kRestart},
+        {kChild, kExecutionErrorAny, States::kOff},
+        {kGrandParent, kExecutionErrorAny, States::kShutdown},
+    };
+
+    const auto table = CompiledRuleTable::FromErrorRecovery(rules, 3U, kHierarchy, 3U);
+
+    EXPECT_EQ(table.Find(kChild, ExecutionErrors::kMemoryViolation), States::kOff);
+    EXPECT_EQ(table.Find(kSibling, ExecutionErrors::kMemoryViolation), States::kRestart);
+    EXPECT_EQ(table.Find(kSibling, 0xCAFEU), States::kShutdown);
+}
+
+TEST(CompiledRuleTableTest, Recovery_LastWildcardOfLevelWins)
+{
+    // As in the linear scan of the recovery table
+    const ErrorRecoveryRule rules[] = {
+        {kChild, kExecutionErrorAny, States::kOff},
+        {kChild, kExecutionErrorAny, States::kShutdown},
+        {kParent, ExecutionErrors::kMemoryViolation, States::kRestart},
+    };
+
+    const auto table = CompiledRuleTable::FromErrorRecovery(rules, 3U, kHierarchy, 3U);
+
+    EXPECT_EQ(table.Find(kChild, 0xCAFEU), States::kShutdown);
+    EXPECT_EQ(table.Find(kChild, ExecutionErrors::kMemoryViolation), States::kShutdown);
+}
+
+TEST(CompiledRuleTableTest, Recovery_NoWildcardNoMatch)
+{
+    const ErrorRecoveryRule rules[] = {
+        {kChild, ExecutionErrors::kProcessCrashed, States::kOff},
+    };
+
+    const auto table = CompiledRuleTable::FromErrorRecovery(rules, 1U, nullptr, 0U);
+
+    EXPECT_EQ(table.Find(kChild, 0xDEADU), CompiledRuleTable::kNoMatch);
+}
+
+// ============================================================================
+// Static configuration through the hierarchy
+// ============================================================================
+
+TEST(CompiledRuleTableTest, Controller_UpdateStatesInheritRollback)
+{
+    const uint32_t updateStates[] = {
+        States::kPrepareUpdate, States::kVerifyUpdate, States::kContinueUpdate
+    };
+
+    for (const uint32_t state : updateStates) {
+        EXPECT_TRUE(TransitionTable::IsTransitionAllowed(
+            static_cast<uint8_t>(state),
+            Triggers::kPrepareRollbackRequest,
+            StateMachine::Category::kController));
+
+        EXPECT_EQ(TransitionTable::GetNextState(
+            static_cast<uint8_t>(state),
+            Triggers::kPrepareRollbackRequest,
+            StateMachine::Category::kController),
+            States::kPrepareRollback);
+
+        EXPECT_EQ(ErrorRecoveryTable::GetRecoveryState(
+            static_cast<uint8_t>(state),
+            ExecutionErrors::kCommunicationError,
+            StateMachine::Category::kController),
+            States::kPrepareRollback);
+    }
+
+    EXPECT_FALSE(TransitionTable::IsTransitionAllowed(
+        static_cast<uint8_t>(States::kRunning),
+        Triggers::kPrepareRollbackRequest,
+        StateMachine::Category::kController));
+}
+
+TEST(CompiledRuleTableTest, Agent_OperationalStatesInheritShutdownAndUpdate)
+{
+    const uint32_t operationalStates[] = { States::kRunning, States::kDegraded };
+
+    for (const uint32_t state : operationalStates) {
+        EXPECT_EQ(TransitionTable::GetNextState(
+            static_cast<uint8_t>(state),
+            Triggers::kShutdownRequest,
+            StateMachine::Category::kAgent),
+            States::kOff);
+
+        EXPECT_EQ(TransitionTable::GetNextState(
+            static_cast<uint8_t>(state),
+            Triggers::kPrepareUpdateRequest,
+            StateMachine::Category::kAgent),
+            States::kPrepareUpdate);
+    }
+
+    EXPECT_EQ(TransitionTable::GetNextState(
+        static_cast<uint8_t>(States::kVerifyUpdate),
+        Triggers::kPrepareRollbackRequest,
+        StateMachine::Category::kAgent),
+        States::kPrepareRollback);
+}
+
+// ============================================================================
+// Guards
+// ============================================================================
+
+TEST(CompiledRuleTableTest, Guard_FirstPassingCandidateWins)
+{
+    const TransitionRule rules[] = {
+        {kChild, 5U, States::kRunning, {0x1U, 0U}},
+        {kChild, 5U, States::kDegraded, {0x2U, 0x1U}},
+        {kParent, 5U, States::kOff},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 3U, kHierarchy, 3U);
+
+    EXPECT_EQ(table.Find(kChild, 5U, 0x1U), States::kRunning);
+    EXPECT_EQ(table.Find(kChild, 5U, 0x3U), States::kRunning);
+    EXPECT_EQ(table.Find(kChild, 5U, 0x2U), States::kDegraded);
+    // Both child guards fail -> inherited unguarded parent rule
+    EXPECT_EQ(table.Find(kChild, 5U, 0x0U), States::kOff);
+}
+
+TEST(CompiledRuleTableTest, Guard_FailingGuardWithoutFallbackNoMatch)
+{
+    const TransitionRule rules[] = {
+        {kChild, 5U, States::kRunning, {0x4U, 0U}},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 1U, kHierarchy, 3U);
+
+    EXPECT_EQ(table.Find(kChild, 5U), CompiledRuleTable::kNoMatch);
+    EXPECT_EQ(table.Find(kChild, 5U, 0x4U), States::kRunning);
+}
+
+TEST(CompiledRuleTableTest, Guard_EvaluateGuard)
+{
+    EXPECT_TRUE(EvaluateGuard({0U, 0U}, 0U));
+    EXPECT_TRUE(EvaluateGuard({0x3U, 0U}, 0x7U));
+    EXPECT_FALSE(EvaluateGuard({0x3U, 0U}, 0x1U));
+    EXPECT_FALSE(EvaluateGuard({0U, 0x4U}, 0x7U));
+    EXPECT_TRUE(EvaluateGuard({0x1U, 0x4U}, 0x3U));
+}
+
+// ============================================================================
+// Key sets
+// ============================================================================
+
+TEST(CompiledRuleTableTest, KeySet_IncludesInheritedKeys)
+{
+    const TransitionRule rules[] = {
+        {kParent, 5U, States::kRunning},
+        {kChild, 0x80000000U, States::kOff},
+        {kSibling, 9U, States::kOff, {0x1U, 0U}},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 3U, kHierarchy, 3U);
+
+    const auto child = table.GetKeySet(kChild);
+    EXPECT_TRUE(child.Contains(5U));
+    EXPECT_TRUE(child.Contains(0x80000000U));
+    EXPECT_FALSE(child.Contains(9U));
+    EXPECT_FALSE(child.Contains(1234U));
+    EXPECT_EQ(child.Count(), 2U);
+    EXPECT_EQ(child.ToVector(), (std::vector<uint32_t>{5U, 0x80000000U}));
+
+    // Guarded rules are part of the set
+    EXPECT_TRUE(table.GetKeySet(kSibling).Contains(9U));
+
+    const auto unknown = table.GetKeySet(0xAAU);
+    EXPECT_FALSE(unknown.Contains(5U));
+    EXPECT_EQ(unknown.Count(), 0U);
+}
+
+TEST(CompiledRuleTableTest, KeySet_SpansMultipleWords)
+{
+    std::vector<TransitionRule> rules;
+    for (uint32_t key = 0; key < 130U; key++) {
+        rules.push_back({(key % 2U == 0U) ? kChild : kSibling, key, States::kRunning});
+    }
+
+    const auto table = CompiledRuleTable::FromTransitions(
+        rules.data(), rules.size(), nullptr, 0U);
+
+    const auto child = table.GetKeySet(kChild);
+    EXPECT_EQ(child.GetWordCount(), 3U);
+    EXPECT_EQ(child.Count(), 65U);
+    EXPECT_TRUE(child.Contains(128U));
+    EXPECT_FALSE(child.Contains(129U));
+    EXPECT_TRUE(table.GetKeySet(kSibling).Contains(129U));
+}
+
+TEST(CompiledRuleTableTest, KeySet_CandidateIndexAbove16Bits)
+{
+    // 200 states x 350 keys = 70000 candidates, past a 16-bit index
+    std::vector<TransitionRule> rules;
+    for (uint32_t state = 0; state < 200U; state++) {
+        for (uint32_t key = 0; key < 350U; key++) {
+            rules.push_back({state, key, (state + 1U) % 200U});
+        }
+    }
+
+    const auto table = CompiledRuleTable::FromTransitions(
+        rules.data(), rules.size(), nullptr, 0U);
+
+    EXPECT_EQ(table.Find(199U, 349U), 0U);
+    EXPECT_TRUE(table.GetKeySet(199U).Contains(349U));
+    EXPECT_EQ(table.GetKeySet(199U).Count(), 350U);
+    EXPECT_EQ(table.GetEdges().size(), rules.size());
+}
+
+TEST(CompiledRuleTableTest, KeySet_FromSortedKeys)
+{
+    const uint32_t keys[] = {3U, 9U, 0x80000000U};
+
+    const auto set = CompiledRuleTable::KeySet::FromSortedKeys(keys, 3U);
+
+    EXPECT_TRUE(set.Contains(9U));
+    EXPECT_FALSE(set.Contains(4U));
+    EXPECT_EQ(set.Count(), 3U);
+    EXPECT_EQ(set.ToVector(), (std::vector<uint32_t>{3U, 9U, 0x80000000U}));
+    EXPECT_EQ(set.GetWords(), nullptr);
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "controller_machine_config.h"
+#include "compiled_rule_table.h"
+#include "static_config.h"
+
+using ara::sm::CompiledRuleTable;
+
+namespace machine = ara::sm::generated::controller_machine;
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for tables generated by sm_config_compiler
+ *
+ * config/manifests/controller_machine.json describes the Controller of
+ * static_config; the generated tables must behave identically.
+ */
+
+namespace {
+
+bool SameText(const char* a, const char* b)
+{
+    if (a == nullptr || b == nullptr) {
+        return a == b;
+    }
+    return std::strcmp(a, b) == 0;
+}
+
+} // namespace
+
+TEST(ConfigCompilerTest, SymbolsKeepExplicitIds)
+{
+    EXPECT_EQ(machine::States::kRunning, States::kRunning);
+    EXPECT_EQ(machine::States::kUpdateSession, States::kUpdateSession);
+    EXPECT_EQ(machine::Triggers::kFinishUpdateRequest, Triggers::kFinishUpdateRequest);
+    EXPECT_EQ(machine::ExecutionErrors::kVerificationFailed, ExecutionErrors::kVerificationFailed);
+    EXPECT_EQ(machine::Conditions::kUpdateSessionActive, Conditions::kUpdateSessionActive);
+
+    EXPECT_EQ(machine::kStateCount, 12U);
+    EXPECT_EQ(machine::kStateIndex[States::kRunning], 2U);
+    EXPECT_EQ(machine::kStateIds[machine::kStateIndex[States::kAfterUpdate]], States::kAfterUpdate);
+    EXPECT_STREQ(machine::kStateNames[machine::kStateIndex[States::kShutdown]], "Shutdown");
+    EXPECT_EQ(machine::kStateIndex[0xFE], 0xFFU);
+}
+
+TEST(ConfigCompilerTest, TransitionsAndHierarchyMatchStaticConfig)
+{
+    ASSERT_EQ(machine::kTransitionsCount, kControllerTransitionsCount);
+    for (std::size_t i = 0; i < kControllerTransitionsCount; i++) {
+        EXPECT_EQ(machine::kTransitions[i].fromState, kControllerTransitions[i].fromState) << i;
+        EXPECT_EQ(machine::kTransitions[i].trigger, kControllerTransitions[i].trigger) << i;
+        EXPECT_EQ(machine::kTransitions[i].toState, kControllerTransitions[i].toState) << i;
+        EXPECT_EQ(machine::kTransitions[i].guard.allOf, kControllerTransitions[i].guard.allOf) << i;
+        EXPECT_EQ(machine::kTransitions[i].guard.noneOf, kControllerTransitions[i].guard.noneOf) << i;
+    }
+
+    ASSERT_EQ(machine::kStateHierarchyCount, kControllerStateHierarchyCount);
+    for (std::size_t i = 0; i < kControllerStateHierarchyCount; i++) {
+        EXPECT_EQ(machine::kStateHierarchy[i].state, kControllerStateHierarchy[i].state);
+        EXPECT_EQ(machine::kStateHierarchy[i].parentState, kControllerStateHierarchy[i].parentState);
+    }
+}
+
+TEST(ConfigCompilerTest, ActionTableMatchesStaticConfig)
+{
+    ASSERT_EQ(machine::kActionTableCount, kActionTableCount);
+    for (std::size_t i = 0; i < kActionTableCount; i++) {
+        const auto& generated = machine::kActionTable[i];
+        const auto& expected = kActionTable[i];
+        EXPECT_EQ(generated.state, expected.state);
+        EXPECT_EQ(generated.timeoutMs, expected.timeoutMs) << "state " << expected.state;
+        ASSERT_EQ(generated.actionCount, expected.actionCount) << "state " << expected.state;
+
+        for (std::size_t a = 0; a < expected.actionCount; a++) {
+            EXPECT_EQ(generated.actions[a].type, expected.actions[a].type);
+            EXPECT_TRUE(SameText(generated.actions[a].target, expected.actions[a].target));
+            EXPECT_TRUE(SameText(generated.actions[a].param, expected.actions[a].param));
+            EXPECT_EQ(generated.actions[a].sleepTimeMs, expected.actions[a].sleepTimeMs);
+            EXPECT_EQ(generated.actions[a].timeoutMs, expected.actions[a].timeoutMs);
+            EXPECT_EQ(generated.actions[a].dependsOn, expected.actions[a].dependsOn);
+        }
+
+        EXPECT_EQ(machine::kActionListIndex[machine::kStateIndex[expected.state]], i);
+    }
+    EXPECT_EQ(machine::kActionListIndex[machine::kStateIndex[States::kOff]], 0xFFU);
+}
+
+TEST(ConfigCompilerTest, DispatchTablesMatchStaticConfig)
+{
+    const auto transitions = CompiledRuleTable::FromTransitions(
+        kControllerTransitions, kControllerTransitionsCount,
+        kControllerStateHierarchy, kControllerStateHierarchyCount);
+    const auto recovery = CompiledRuleTable::FromErrorRecovery(
+        kControllerErrorRecovery, kControllerErrorRecoveryCount,
+        kControllerStateHierarchy, kControllerStateHierarchyCount);
+
+    for (std::size_t i = 0; i < machine::kStateCount; i++) {
+        const auto state = static_cast<uint8_t>(machine::kStateIds[i]);
+
+        for (uint32_t trigger = 0; trigger < 16U; trigger++) {
+            for (ConditionMask conditions = 0U; conditions < 4U; conditions++) {
+                EXPECT_EQ(machine::kTransitionHash.Find(state, trigger, conditions),
+                          transitions.Find(state, trigger, conditions));
+            }
+        }
+        for (uint32_t error = 0; error < 16U; error++) {
+            EXPECT_EQ(machine::kRecoveryHash.Find(state, error), recovery.Find(state, error));
+        }
+    }
+
+    static_assert(machine::kTransitionHash.Find(
+                      static_cast<uint8_t>(machine::States::kAfterUpdate),
+                      machine::Triggers::kGoToRunning) == machine::States::kRunning,
+                  "generated dispatch must be usable in constant expressions");
+}
@@ -0,0 +1,230 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "config_snapshot.h"
+#include "binary_config.h"
+#include "static_config.h"
+
+using ara::sm::BinaryConfigImage;
+using ara::sm::ConfigSnapshot;
+using ara::sm::ConfigTables;
+using ara::sm::StateManagementErrc;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for ConfigSnapshot (validated, self-contained table sets)
+ */
+
+namespace {
+
+ConfigTables ControllerTables()
+{
+    return {
+        "Controller",
+        kControllerTransitions, kControllerTransitionsCount,
+        kControllerErrorRecovery, kControllerErrorRecoveryCount,
+        kControllerStateHierarchy, kControllerStateHierarchyCount,
+        kActionTable, kActionTableCount
+    };
+}
+
+} // namespace
+
+// ============================================================================
+// Load
+// ============================================================================
+
+TEST(ConfigSnapshotTest, LoadStaticControllerTables)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load(ControllerTables()).HasValue());
+
+    EXPECT_TRUE(snapshot.IsLoaded());
+    EXPECT_EQ(snapshot.GetName(), "Controller");
+    EXPECT_EQ(snapshot.GetTransitionCount(), kControllerTransitionsCount);
+    EXPECT_EQ(snapshot.GetActionListCount(), kActionTableCount);
+
+    EXPECT_EQ(snapshot.FindTransition(States::kInitial, Triggers::kStartup, 0U),
+              States::kStartup);
+    EXPECT_EQ(snapshot.FindTransition(States::kRunning, 9999U, 0U),
+              ConfigSnapshot::kNoMatch);
+    // Inherited from kUpdateSession
+    EXPECT_EQ(snapshot.FindRecovery(States::kVerifyUpdate, ExecutionErrors::kCommunicationError),
+              States::kPrepareRollback);
+
+    EXPECT_TRUE(snapshot.GetAllowedTriggers(States::kInitial).Contains(Triggers::kStartup));
+    EXPECT_EQ(snapshot.GetPlanner().GetDistance(States::kInitial, States::kShutdown), 2U);
+
+    const auto* list = snapshot.FindActionList(States::kInitial);
+    ASSERT_NE(list, nullptr);
+    EXPECT_EQ(list->actionCount, kActionTable[0].actionCount);
+    EXPECT_EQ(snapshot.FindActionList(States::kOff), nullptr);
+}
+
+TEST(ConfigSnapshotTest, LoadCopiesTables)
+{
+    std::vector<TransitionRule> rules = {
+        {States::kOff, Triggers::kStartup, States::kRunning},
+    };
+    std::string target = "MachineFG";
+    const ActionItem actions[] = {
+        {ActionType::kSetFunctionGroupState, target.c_str(), "Running", 0U},
+    };
+    std::vector<ActionListEntry> lists = {{States::kRunning, actions, 1U}};
+
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Copy", rules.data(), rules.size(), nullptr, 0U,
+                               nullptr, 0U, lists.data(), lists.size()}).HasValue());
+
+    rules[0].toState = States::kOff;
+    target = "Overwritten";
+    lists.clear();
+
+    EXPECT_EQ(snapshot.FindTransition(States::kOff, Triggers::kStartup, 0U), States::kRunning);
+    const auto* list = snapshot.FindActionList(States::kRunning);
+    ASSERT_NE(list, nullptr);
+    EXPECT_STREQ(list->actions[0].target, "MachineFG");
+    EXPECT_STREQ(list->actions[0].param, "Running");
+}
+
+TEST(ConfigSnapshotTest, LoadLargeTableUsesVectorRules)
+{
+    // 200 states x 350 keys: more candidates than a 16-bit index holds
+    std::vector<TransitionRule> rules;
+    for (uint32_t state = 0; state < 200U; state++) {
+        for (uint32_t key = 0; key < 350U; key++) {
+            rules.push_back({state, 0x10000U + key, (state + 1U) % 200U});
+        }
+    }
+
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Large", rules.data(), rules.size(), nullptr, 0U,
+                               nullptr, 0U, nullptr, 0U}).HasValue());
+
+    EXPECT_EQ(snapshot.FindTransition(199U, 0x10000U + 349U, 0U), 0U);
+    const auto allowed = snapshot.GetAllowedTriggers(199U);
+    EXPECT_TRUE(allowed.Contains(0x10000U + 349U));
+    EXPECT_FALSE(allowed.Contains(0x10000U + 350U));
+    EXPECT_EQ(allowed.Count(), 350U);
+    EXPECT_EQ(snapshot.GetAllowedTriggers(200U).Count(), 0U);
+    EXPECT_EQ(snapshot.GetPlanner().GetDistance(0U, 199U), 199U);
+}
+
+TEST(ConfigSnapshotTest, LoadTwiceRejected)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load(ControllerTables()).HasValue());
+
+    auto r = snapshot.Load(ControllerTables());
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kOperationRejected);
+}
+
+TEST(ConfigSnapshotTest, LoadFromBinaryImage)
+{
+    const auto bytes = BinaryConfigImage::Build(
+        "Controller",
+        kControllerTransitions, kControllerTransitionsCount,
+        kControllerErrorRecovery, kControllerErrorRecoveryCount,
+        kControllerStateHierarchy, kControllerStateHierarchyCount,
+        kActionTable, kActionTableCount);
+
+    const std::string path = "config_snapshot_test.smcfg";
+    ASSERT_TRUE(BinaryConfigImage::WriteFile(path, bytes).HasValue());
+
+    auto image = std::make_shared<BinaryConfigImage>();
+    ASSERT_TRUE(image->Open(path).HasValue());
+
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load(image).HasValue());
+    image.reset();      // snapshot keeps the mapping alive
+    std::remove(path.c_str());
+
+    EXPECT_EQ(snapshot.GetName(), "Controller");
+    EXPECT_EQ(snapshot.FindTransition(States::kStartup, Triggers::kGoToRunning, 0U),
+              States::kRunning);
+
+    const auto* list = snapshot.FindActionList(States::kInitial);
+    ASSERT_NE(list, nullptr);
+    EXPECT_STREQ(list->actions[0].target, kActionTable[0].actions[0].target);
+}
+
+TEST(ConfigSnapshotTest, LoadClosedImageRejected)
+{
+    ConfigSnapshot snapshot;
+
+    auto r = snapshot.Load(std::make_shared<BinaryConfigImage>());
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kInvalidValue);
+    EXPECT_FALSE(snapshot.IsLoaded());
+}
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+TEST(ConfigSnapshotTest, Validate_MissingTable)
+{
+    ConfigTables tables = ControllerTables();
+    tables.transitions = nullptr;
+
+    EXPECT_FALSE(ConfigSnapshot::Validate(tables).HasValue());
+}
+
+TEST(ConfigSnapshotTest, Validate_StateOutOfRange)
+{
+    const TransitionRule rules[] = {{States::kOff, Triggers::kStartup, 0x1FFU}};
+
+    ConfigSnapshot snapshot;
+    auto r = snapshot.Load({"Bad", rules, 1U, nullptr, 0U, nullptr, 0U, nullptr, 0U});
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kInvalidValue);
+    EXPECT_FALSE(snapshot.IsLoaded());
+}
+
+TEST(ConfigSnapshotTest, Validate_CyclicHierarchy)
+{
+    const StateHierarchyRule cyclic[] = {
+        {States::kRunning, States::kOperational},
+        {States::kOperational, States::kRunning},
+    };
+
+    EXPECT_FALSE(ConfigSnapshot::Validate(
+        {"Cyclic", nullptr, 0U, nullptr, 0U, cyclic, 2U, nullptr, 0U}).HasValue());
+}
+
+TEST(ConfigSnapshotTest, Validate_DuplicateActionList)
+{
+    const ActionListEntry lists[] = {
+        {States::kInitial, kActionTable[0].actions, 1U},
+        {States::kInitial, kActionTable[0].actions, 1U},
+    };
+
+    EXPECT_FALSE(ConfigSnapshot::Validate(
+        {"Dup", nullptr, 0U, nullptr, 0U, nullptr, 0U, lists, 2U}).HasValue());
+}
+
+TEST(ConfigSnapshotTest, Validate_BadActionDependencies)
+{
+    const ActionItem syncAndDependency[] = {
+        {ActionType::kSetNetworkHandle, "VehicleNetwork", "NoCom", 0U, 0U, 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U, 0U, 0U},
+        {ActionType::kSetFunctionGroupState, "MachineFG", "Off", 0U, 0U, DependsOn(0)},
+    };
+    const ActionListEntry lists[] = {{States::kInitial, syncAndDependency, 3U}};
+
+    ConfigSnapshot snapshot;
+    auto r = snapshot.Load({"Bad", nullptr, 0U, nullptr, 0U, nullptr, 0U, lists, 1U});
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kInvalidValue);
+}
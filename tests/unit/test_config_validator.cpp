@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+
+#include "config_validator.h"
+#include "controller_machine_config.h"
+#include "static_config.h"
+
+using ara::sm::ActionCountsMatch;
+using ara::sm::ActionDependenciesValid;
+using ara::sm::ConfigDefect;
+using ara::sm::ConfigValidator;
+
+namespace machine = ara::sm::generated::controller_machine;
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for ConfigValidator (build-time table checks)
+ */
+
+namespace {
+
+// Empty table set; each case below overrides only the tables it needs
+struct NoTables {
+    static constexpr const TransitionRule* kTransitions = nullptr;
+    static constexpr std::size_t kTransitionsCount = 0U;
+    static constexpr const ErrorRecoveryRule* kErrorRecovery = nullptr;
+    static constexpr std::size_t kErrorRecoveryCount = 0U;
+    static constexpr const StateHierarchyRule* kStateHierarchy = nullptr;
+    static constexpr std::size_t kStateHierarchyCount = 0U;
+    static constexpr const ActionListEntry* kActionTable = nullptr;
+    static constexpr std::size_t kActionTableCount = 0U;
+};
+
+constexpr ActionItem kOneAction[] = {
+    {ActionType::kSetFunctionGroupState, "FG", "On", 0U},
+};
+constexpr ActionItem kTwoActions[] = {
+    {ActionType::kSetFunctionGroupState, "FG", "Off", 0U},
+    {ActionType::kSync, nullptr, nullptr, 0U},
+};
+
+// 0 -> 1 -> 2 -> 1; 3 and 4 children of composite 5, 4 entered from 3 by recovery
+struct Valid : NoTables {
+    static constexpr TransitionRule kRules[] = {
+        {0U, 1U, 1U},
+        {1U, 2U, 2U, {0x1U, 0U}},
+        {1U, 2U, 1U},
+        {2U, 1U, 1U},
+        {5U, 7U, 1U},
+    };
+    static constexpr ErrorRecoveryRule kRecovery[] = {
+        {1U, kExecutionErrorAny, 2U},
+        {5U, kExecutionErrorAny, 4U},
+    };
+    static constexpr StateHierarchyRule kHierarchy[] = {
+        {3U, 5U},
+        {4U, 5U},
+    };
+    static constexpr ActionListEntry kActions[] = {
+        {1U, kOneAction, 1U},
+        {2U, kTwoActions, 2U},
+    };
+
+    static constexpr const TransitionRule* kTransitions = kRules;
+    static constexpr std::size_t kTransitionsCount = 5U;
+    static constexpr const ErrorRecoveryRule* kErrorRecovery = kRecovery;
+    static constexpr std::size_t kErrorRecoveryCount = 2U;
+    static constexpr const StateHierarchyRule* kStateHierarchy = kHierarchy;
+    static constexpr std::size_t kStateHierarchyCount = 2U;
+    static constexpr const ActionListEntry* kActionTable = kActions;
+    static constexpr std::size_t kActionTableCount = 2U;
+};
+
+struct StateOutOfRange : NoTables {
+    static constexpr TransitionRule kRules[] = {{0U, 1U, 0xFFU}};
+    static constexpr const TransitionRule* kTransitions = kRules;
+    static constexpr std::size_t kTransitionsCount = 1U;
+};
+
+struct ShadowedTransition : NoTables {
+    static constexpr TransitionRule kRules[] = {
+        {0U, 1U, 0U},
+        {0U, 1U, 0U, {0x1U, 0U}},
+    };
+    static constexpr const TransitionRule* kTransitions = kRules;
+    static constexpr std::size_t kTransitionsCount = 2U;
+};
+
+struct SameGuardTwice : NoTables {
+    static constexpr TransitionRule kRules[] = {
+        {0U, 1U, 0U, {0x1U, 0U}},
+        {0U, 1U, 0U, {0x1U, 0U}},
+    };
+    static constexpr const TransitionRule* kTransitions = kRules;
+    static constexpr std::size_t kTransitionsCount = 2U;
+};
+
+struct DuplicateRecovery : NoTables {
+    static constexpr TransitionRule kRules[] = {{0U, 1U, 0U}};
+    static constexpr ErrorRecoveryRule kRecovery[] = {
+        {0U, kExecutionErrorAny, 0U},
+        {0U, kExecutionErrorAny, 0U},
+    };
+    static constexpr const TransitionRule* kTransitions = kRules;
+    static constexpr std::size_t kTransitionsCount = 1U;
+    static constexpr const ErrorRecoveryRule* kErrorRecovery = kRecovery;
+    static constexpr std::size_t kErrorRecoveryCount = 2U;
+};
+
+struct TwoParents : NoTables {
+    static constexpr StateHierarchyRule kHierarchy[] = {{1U, 5U}, {1U, 6U}};
+    static constexpr const StateHierarchyRule* kStateHierarchy = kHierarchy;
+    static constexpr std::size_t kStateHierarchyCount = 2U;
+};
+
+struct HierarchyCycle : NoTables {
+    static constexpr StateHierarchyRule kHierarchy[] = {{1U, 2U}, {2U, 1U}};
+    static constexpr const StateHierarchyRule* kStateHierarchy = kHierarchy;
+    static constexpr std::size_t kStateHierarchyCount = 2U;
+};
+
+struct ActionListOnComposite : NoTables {
+    static constexpr StateHierarchyRule kHierarchy[] = {{1U, 5U}};
+    static constexpr ActionListEntry kActions[] = {{5U, kOneAction, 1U}};
+    static constexpr const StateHierarchyRule* kStateHierarchy = kHierarchy;
+    static constexpr std::size_t kStateHierarchyCount = 1U;
+    static constexpr const ActionListEntry* kActionTable = kActions;
+    static constexpr std::size_t kActionTableCount = 1U;
+};
+
+struct MissingActionArray : NoTables {
+    static constexpr ActionListEntry kActions[] = {{1U, nullptr, 2U}};
+    static constexpr const ActionListEntry* kActionTable = kActions;
+    static constexpr std::size_t kActionTableCount = 1U;
+};
+
+struct DanglingTarget : NoTables {
+    static constexpr TransitionRule kRules[] = {{0U, 1U, 9U}};
+    static constexpr const TransitionRule* kTransitions = kRules;
+    static constexpr std::size_t kTransitionsCount = 1U;
+};
+
+struct CompositeTarget : NoTables {
+    static constexpr TransitionRule kRules[] = {{0U, 1U, 5U}};
+    static constexpr StateHierarchyRule kHierarchy[] = {{1U, 5U}};
+    static constexpr const TransitionRule* kTransitions = kRules;
+    static constexpr std::size_t kTransitionsCount = 1U;
+    static constexpr const StateHierarchyRule* kStateHierarchy = kHierarchy;
+    static constexpr std::size_t kStateHierarchyCount = 1U;
+};
+
+// 2 waits for 0 and 1
+constexpr ActionItem kJoin[] = {
+    {ActionType::kSetNetworkHandle, "Net", "NoCom", 0U, 0U, 0U},
+    {ActionType::kSleep, nullptr, nullptr, 100U, 0U, 0U},
+    {ActionType::kSetFunctionGroupState, "FG", "Off", 0U, 0U, DependsOn(0) | DependsOn(1)},
+};
+constexpr ActionItem kForwardDependency[] = {
+    {ActionType::kSetNetworkHandle, "Net", "NoCom", 0U, 0U, DependsOn(1)},
+    {ActionType::kSetFunctionGroupState, "FG", "Off", 0U, 0U, 0U},
+};
+constexpr ActionItem kSelfDependency[] = {
+    {ActionType::kSetFunctionGroupState, "FG", "Off", 0U, 0U, DependsOn(0)},
+};
+constexpr ActionItem kDependencyAndSync[] = {
+    {ActionType::kSetNetworkHandle, "Net", "NoCom", 0U, 0U, 0U},
+    {ActionType::kSync, nullptr, nullptr, 0U, 0U, 0U},
+    {ActionType::kSetFunctionGroupState, "FG", "Off", 0U, 0U, DependsOn(0)},
+};
+
+static_assert(ActionDependenciesValid(kJoin, 3U), "dependency list");
+
+constexpr uint32_t kInitialOnly[] = {0U};
+constexpr uint32_t kInitialAndThree[] = {0U, 3U};
+
+// Controller tables generated from the manifest
+using ControllerCheck = ConfigValidator<machine::Tables>;
+static_assert(ControllerCheck::IsWellFormed(), "generated Controller tables");
+
+static_assert(ConfigValidator<Valid>::FirstDefect() == ConfigDefect::kNone, "valid table set");
+
+} // namespace
+
+// ============================================================================
+// Structural checks
+// ============================================================================
+
+TEST(ConfigValidatorTest, ValidTableSet)
+{
+    EXPECT_TRUE(ConfigValidator<Valid>::IsWellFormed());
+    EXPECT_TRUE(ConfigValidator<NoTables>::IsWellFormed());
+}
+
+TEST(ConfigValidatorTest, StateOutOfRange)
+{
+    EXPECT_EQ(ConfigValidator<StateOutOfRange>::FirstDefect(), ConfigDefect::kStateOutOfRange);
+}
+
+TEST(ConfigValidatorTest, DuplicateTransitionKeys)
+{
+    EXPECT_EQ(ConfigValidator<ShadowedTransition>::FirstDefect(),
+              ConfigDefect::kDuplicateTransition);
+    EXPECT_EQ(ConfigValidator<SameGuardTwice>::FirstDefect(), ConfigDefect::kDuplicateTransition);
+}
+
+TEST(ConfigValidatorTest, DuplicateRecoveryKeys)
+{
+    EXPECT_EQ(ConfigValidator<DuplicateRecovery>::FirstDefect(), ConfigDefect::kDuplicateRecovery);
+}
+
+TEST(ConfigValidatorTest, MalformedHierarchy)
+{
+    EXPECT_EQ(ConfigValidator<TwoParents>::FirstDefect(), ConfigDefect::kBadHierarchy);
+    EXPECT_EQ(ConfigValidator<HierarchyCycle>::FirstDefect(), ConfigDefect::kBadHierarchy);
+}
+
+TEST(ConfigValidatorTest, MalformedActionTable)
+{
+    EXPECT_EQ(ConfigValidator<ActionListOnComposite>::FirstDefect(), ConfigDefect::kBadActionList);
+    EXPECT_EQ(ConfigValidator<MissingActionArray>::FirstDefect(), ConfigDefect::kBadActionList);
+}
+
+TEST(ConfigValidatorTest, DanglingStates)
+{
+    EXPECT_EQ(ConfigValidator<DanglingTarget>::FirstDefect(), ConfigDefect::kDanglingState);
+    EXPECT_EQ(ConfigValidator<CompositeTarget>::FirstDefect(), ConfigDefect::kDanglingState);
+}
+
+// ============================================================================
+// Reachability and action counts
+// ============================================================================
+
+TEST(ConfigValidatorTest, UnreachableStates)
+{
+    // 3 only has a parent and 4 is entered from 3
+    EXPECT_FALSE(ConfigValidator<Valid>::AllStatesReachable(kInitialOnly));
+    EXPECT_TRUE(ConfigValidator<Valid>::AllStatesReachable(kInitialAndThree));
+}
+
+TEST(ConfigValidatorTest, GeneratedControllerReachability)
+{
+    // ContinueUpdate is only entered after a restart during an update
+    const uint32_t controllerEntries[] = {States::kInitial, States::kContinueUpdate};
+    EXPECT_TRUE(ControllerCheck::AllStatesReachable(controllerEntries));
+    EXPECT_FALSE(ControllerCheck::AllStatesReachable(kInitialOnly));
+}
+
+TEST(ConfigValidatorTest, ActionCountsMatch)
+{
+    EXPECT_TRUE(ActionCountsMatch(Valid::kActions, 2U, kOneAction, kTwoActions));
+
+    // Wrong order, wrong count, wrong table size
+    EXPECT_FALSE(ActionCountsMatch(Valid::kActions, 2U, kTwoActions, kOneAction));
+    const ActionListEntry drifted[] = {{1U, kOneAction, 1U}, {2U, kTwoActions, 3U}};
+    EXPECT_FALSE(ActionCountsMatch(drifted, 2U, kOneAction, kTwoActions));
+    EXPECT_FALSE(ActionCountsMatch(Valid::kActions, 2U, kOneAction));
+}
+
+TEST(ConfigValidatorTest, ActionDependencies)
+{
+    EXPECT_TRUE(ActionDependenciesValid(kJoin, 3U));
+    EXPECT_TRUE(ActionDependenciesValid(kTwoActions, 2U));     // SYNC without dependencies
+
+    EXPECT_FALSE(ActionDependenciesValid(kForwardDependency, 2U));
+    EXPECT_FALSE(ActionDependenciesValid(kSelfDependency, 1U));
+    EXPECT_FALSE(ActionDependenciesValid(kDependencyAndSync, 3U));
+}
@@ -0,0 +1,642 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <csignal>
+#include <thread>
+
+#include "local_execution_manager.h"
+#include "config_snapshot.h"
+#include "static_config.h"
+
+using ara::sm::ConfigSnapshot;
+using ara::sm::LocalExecutionManager;
+using ara::sm::StateManagementErrc;
+
+using namespace ara::sm::config;
+using namespace std::chrono_literals;
+
+/**
+ * @brief Unit tests for LocalExecutionManager (Execution Management stand-in)
+ *
+ * Processes are /bin/sh one-liners; tests are skipped on hosts without
+ * pidfd/epoll support.
+ */
+
+namespace {
+
+constexpr const char* kReady = "printf R >&3; exec sleep 30";
+constexpr const char* kNeverReady = "exec sleep 30";
+constexpr const char* kParkable =
+    "[ -z \"$ARA_EM_RELEASE_FD\" ] || read -r _ <&4; printf R >&3; exec sleep 30";
+
+constexpr ProcessItem kTestProcesses[] = {
+    {"TestFG", "Running", "A", {"/bin/sh", "-c", kReady, nullptr}},
+    {"TestFG", "Running", "B", {"/bin/sh", "-c", kReady, nullptr}},
+    {"TestFG", "Running", "C", {"/bin/sh", "-c", "exit 0", nullptr}},
+    {"TestFG", "Degraded", "A", {"/bin/sh", "-c", kReady, nullptr}},
+    {"TestFG", "Failing", "Crash", {"/bin/sh", "-c", "exit 3", nullptr}},
+    {"TestFG", "Hanging", "Sleeper", {"/bin/sh", "-c", kNeverReady, nullptr}},
+    {"TestFG", "Missing", "Ghost", {"/nonexistent/ghost", nullptr}},
+    {"OtherFG", "Running", "D", {"/bin/sh", "-c", kReady, nullptr}},
+    {"PoolFG", "Running", "P", {"/bin/sh", "-c", kParkable, nullptr}},
+    {"PoolFG", "Running", "Q", {"/bin/sh", "-c", kParkable, nullptr}},
+    {"PoolFG", "Degraded", "P", {"/bin/sh", "-c", kParkable, nullptr}},
+};
+
+constexpr PrelaunchItem kTestPrelaunch[] = {
+    {"PoolFG", "Degraded", "Running"},
+};
+
+constexpr std::size_t kTestProcessCount = sizeof(kTestProcesses) / sizeof(ProcessItem);
+
+#define OPEN_OR_SKIP(em)                                                    \
+    if (!(em).Open().HasValue()) {                                          \
+        GTEST_SKIP() << "No pidfd/epoll support on this host";              \
+    }
+
+} // namespace
+
+// ============================================================================
+// Start and readiness
+// ============================================================================
+
+TEST(LocalExecutionManagerTest, StartsStateProcessesAndReports)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Running").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+
+    // One-shot C has exited, the daemons keep running
+    EXPECT_EQ(em.GetRunningCount(), 2U);
+    EXPECT_TRUE(em.IsRunning("TestFG", "A"));
+    EXPECT_TRUE(em.IsRunning("TestFG", "B"));
+    EXPECT_FALSE(em.IsRunning("TestFG", "C"));
+
+    ASSERT_EQ(em.GetReports().size(), 1U);
+    const auto& report = em.GetReports()[0];
+    EXPECT_EQ(report.functionGroup, "TestFG");
+    EXPECT_EQ(report.state, "Running");
+    EXPECT_EQ(report.processCount, 3U);
+    EXPECT_EQ(report.failedCount, 0U);
+    EXPECT_GT(report.latency.count(), 0);
+}
+
+TEST(LocalExecutionManagerTest, FunctionGroupsOfOneSyncStartTogether)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Running").HasValue());
+    ASSERT_TRUE(em.RequestFunctionGroupState("OtherFG", "Running").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+
+    ASSERT_EQ(em.GetReports().size(), 2U);
+    EXPECT_EQ(em.GetReports()[1].functionGroup, "OtherFG");
+    EXPECT_EQ(em.GetRunningCount(), 3U);
+}
+
+TEST(LocalExecutionManagerTest, StateChangeKeepsSharedProcesses)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Running").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+    ASSERT_TRUE(em.RequestFunctionGroupState("OtherFG", "Running").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+    em.ClearReports();
+
+    // A is configured in Degraded too, B is not; OtherFG is untouched
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Degraded").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+
+    EXPECT_TRUE(em.IsRunning("TestFG", "A"));
+    EXPECT_FALSE(em.IsRunning("TestFG", "B"));
+    EXPECT_TRUE(em.IsRunning("OtherFG", "D"));
+    ASSERT_EQ(em.GetReports().size(), 1U);
+    EXPECT_EQ(em.GetReports()[0].processCount, 0U);
+
+    em.StopAll();
+    EXPECT_EQ(em.GetRunningCount(), 0U);
+}
+
+// ============================================================================
+// Failures
+// ============================================================================
+
+TEST(LocalExecutionManagerTest, NonZeroExitFails)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Failing").HasValue());
+    auto result = em.WaitReady();
+
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), StateManagementErrc::kTransitionFailed);
+    EXPECT_EQ(em.GetReports()[0].failedCount, 1U);
+    EXPECT_EQ(em.GetRunningCount(), 0U);
+}
+
+TEST(LocalExecutionManagerTest, ReadyTimeout)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount, 100ms, 100ms);
+    OPEN_OR_SKIP(em);
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Hanging").HasValue());
+    EXPECT_FALSE(em.WaitReady().HasValue());
+    EXPECT_EQ(em.GetReports()[0].failedCount, 1U);
+
+    // Left running, stopped with the function group
+    EXPECT_TRUE(em.IsRunning("TestFG", "Sleeper"));
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Degraded").HasValue());
+    EXPECT_FALSE(em.IsRunning("TestFG", "Sleeper"));
+}
+
+TEST(LocalExecutionManagerTest, MissingExecutable)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    auto result = em.RequestFunctionGroupState("TestFG", "Missing");
+
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), StateManagementErrc::kOperationFailed);
+    EXPECT_FALSE(em.WaitReady().HasValue());
+}
+
+TEST(LocalExecutionManagerTest, NotOpen)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+
+    EXPECT_FALSE(em.RequestFunctionGroupState("TestFG", "Running").HasValue());
+    EXPECT_TRUE(em.WaitReady().HasValue());
+}
+
+// ============================================================================
+// Action lists
+// ============================================================================
+
+TEST(LocalExecutionManagerTest, ControllerBootSequence)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Controller",
+                               kControllerTransitions, kControllerTransitionsCount,
+                               kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                               kControllerStateHierarchy, kControllerStateHierarchyCount,
+                               kActionTable, kActionTableCount}).HasValue());
+
+    LocalExecutionManager em(kProcessTable, kProcessTableCount);
+    OPEN_OR_SKIP(em);
+
+    em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kInitial));
+    EXPECT_TRUE(em.IsRunning("MachineFG", "LogDaemon"));
+    EXPECT_FALSE(em.IsRunning("MachineFG", "PersistencyInit"));
+
+    em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kRunning));
+    EXPECT_TRUE(em.IsRunning("MachineFG", "LogDaemon"));
+    EXPECT_TRUE(em.IsRunning("MachineFG", "DiagnosticManager"));
+    EXPECT_TRUE(em.IsRunning("MachineFG", "PlatformHealth"));
+
+    ASSERT_EQ(em.GetReports().size(), 2U);
+    EXPECT_EQ(em.GetReports()[0].state, "Startup");
+    EXPECT_EQ(em.GetReports()[0].processCount, 2U);
+    EXPECT_EQ(em.GetReports()[1].state, "Running");
+    EXPECT_EQ(em.GetReports()[1].processCount, 2U);     // LogDaemon kept
+    EXPECT_EQ(em.GetReports()[1].failedCount, 0U);
+}
+
+TEST(LocalExecutionManagerTest, ItemActionList)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "InfotainmentFG", "Running", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+
+    LocalExecutionManager em(kProcessTable, kProcessTableCount);
+    OPEN_OR_SKIP(em);
+
+    em.ExecuteActionList(items, 2U);
+
+    EXPECT_TRUE(em.IsRunning("InfotainmentFG", "MediaPlayer"));
+    EXPECT_TRUE(em.IsRunning("InfotainmentFG", "Navigation"));
+    ASSERT_EQ(em.GetReports().size(), 1U);
+    EXPECT_EQ(em.GetReports()[0].failedCount, 0U);
+}
+
+// ============================================================================
+// Deadlines
+// ============================================================================
+
+TEST(LocalExecutionManagerTest, SyncTimeoutBoundsHungFunctionGroup)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "TestFG", "Hanging", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U, 100U},
+    };
+
+    // readyTimeout alone would wait 5 s
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    const auto begin = std::chrono::steady_clock::now();
+    em.ExecuteActionList(items, 2U);
+
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, 2s);
+    ASSERT_FALSE(em.GetListResult().HasValue());
+    EXPECT_EQ(em.GetListResult().Error(), StateManagementErrc::kTransitionFailed);
+    ASSERT_EQ(em.GetReports().size(), 1U);
+    EXPECT_EQ(em.GetReports()[0].failedCount, 1U);
+    EXPECT_EQ(em.GetFunctionGroupState("TestFG"), nullptr);
+}
+
+TEST(LocalExecutionManagerTest, ListDeadlineSkipsRestOfList)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "TestFG", "Hanging", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kSetFunctionGroupState, "OtherFG", "Running", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+    const ActionListEntry lists[] = {
+        {States::kInitial, items, 4U, 100U},
+    };
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Controller",
+                               kControllerTransitions, kControllerTransitionsCount,
+                               kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                               kControllerStateHierarchy, kControllerStateHierarchyCount,
+                               lists, 1U}).HasValue());
+
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    const auto begin = std::chrono::steady_clock::now();
+    em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kInitial));
+
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, 2s);
+    EXPECT_FALSE(em.GetListResult().HasValue());
+    EXPECT_FALSE(em.IsRunning("OtherFG", "D"));
+    ASSERT_EQ(em.GetReports().size(), 1U);
+    EXPECT_EQ(em.GetReports()[0].state, "Hanging");
+}
+
+TEST(LocalExecutionManagerTest, ControllerBootWithinDeadlines)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Controller",
+                               kControllerTransitions, kControllerTransitionsCount,
+                               kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                               kControllerStateHierarchy, kControllerStateHierarchyCount,
+                               kActionTable, kActionTableCount}).HasValue());
+
+    LocalExecutionManager em(kProcessTable, kProcessTableCount);
+    OPEN_OR_SKIP(em);
+
+    for (const uint32_t state : {States::kInitial, States::kStartup, States::kRunning}) {
+        em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(state));
+        EXPECT_TRUE(em.GetListResult().HasValue()) << "state " << state;
+    }
+}
+
+// ============================================================================
+// Dependency lists
+// ============================================================================
+
+TEST(LocalExecutionManagerTest, DependentStartsWhenDependencyReady)
+{
+    // PoolFG only waits for OtherFG; a SYNC would also wait for TestFG
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "TestFG", "Hanging", 0U, 0U, 0U},
+        {ActionType::kSetFunctionGroupState, "OtherFG", "Running", 0U, 0U, 0U},
+        {ActionType::kSetFunctionGroupState, "PoolFG", "Running", 0U, 0U, DependsOn(1)},
+    };
+    const ActionListEntry lists[] = {
+        {States::kInitial, items, 3U, 300U},
+    };
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Controller",
+                               kControllerTransitions, kControllerTransitionsCount,
+                               kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                               kControllerStateHierarchy, kControllerStateHierarchyCount,
+                               lists, 1U}).HasValue());
+    ASSERT_EQ(snapshot.FindResolvedActionList(States::kInitial)->plan.nodeCount, 3U);
+
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    const auto begin = std::chrono::steady_clock::now();
+    em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kInitial));
+
+    // TestFG never gets ready and fails the list at its deadline
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, 2s);
+    ASSERT_FALSE(em.GetListResult().HasValue());
+    EXPECT_TRUE(em.IsRunning("OtherFG", "D"));
+    EXPECT_TRUE(em.IsRunning("PoolFG", "P"));
+    EXPECT_TRUE(em.IsRunning("PoolFG", "Q"));
+
+    em.StopAll();
+}
+
+TEST(LocalExecutionManagerTest, ItemListWaitsForDependency)
+{
+    // No SYNC: the dependency adds one before PoolFG
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "TestFG", "Failing", 0U, 0U, 0U},
+        {ActionType::kSetFunctionGroupState, "PoolFG", "Running", 0U, 0U, DependsOn(0)},
+    };
+
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    ASSERT_FALSE(em.ExecuteActionList(items, 2U).HasValue());
+    EXPECT_FALSE(em.IsRunning("PoolFG", "P"));
+}
+
+TEST(LocalExecutionManagerTest, ControllerShutdownGraph)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Controller",
+                               kControllerTransitions, kControllerTransitionsCount,
+                               kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                               kControllerStateHierarchy, kControllerStateHierarchyCount,
+                               kActionTable, kActionTableCount}).HasValue());
+
+    LocalExecutionManager em(kProcessTable, kProcessTableCount);
+    OPEN_OR_SKIP(em);
+
+    // The Agent stop and the network shutdown overlap
+    const auto begin = std::chrono::steady_clock::now();
+    em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kShutdown));
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_TRUE(em.GetListResult().HasValue());
+    EXPECT_GE(elapsed, 500ms);
+    EXPECT_STREQ(em.GetFunctionGroupState("MachineFG"), "Shutdown");
+
+    em.StopAll();
+}
+
+// ============================================================================
+// Prelaunch
+// ============================================================================
+
+TEST(LocalExecutionManagerTest, PrelaunchedProcessesReleasedByRequest)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    ASSERT_TRUE(em.Prelaunch("PoolFG", "Running").HasValue());
+    EXPECT_EQ(em.GetParkedCount(), 2U);
+    EXPECT_TRUE(em.IsParked("PoolFG", "P"));
+    EXPECT_FALSE(em.IsRunning("PoolFG", "P"));
+
+    // Prelaunching again does not park a second copy
+    ASSERT_TRUE(em.Prelaunch("PoolFG", "Running").HasValue());
+    EXPECT_EQ(em.GetParkedCount(), 2U);
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("PoolFG", "Running").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+
+    EXPECT_EQ(em.GetParkedCount(), 0U);
+    EXPECT_TRUE(em.IsRunning("PoolFG", "P"));
+    EXPECT_TRUE(em.IsRunning("PoolFG", "Q"));
+    ASSERT_EQ(em.GetReports().size(), 1U);
+    EXPECT_EQ(em.GetReports()[0].processCount, 2U);
+    EXPECT_EQ(em.GetReports()[0].failedCount, 0U);
+}
+
+TEST(LocalExecutionManagerTest, PrelaunchTableParksNextState)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+    em.SetPrelaunchTable(kTestPrelaunch, 1U);
+
+    // Degraded is up: Running is prelaunched, P already runs
+    ASSERT_TRUE(em.RequestFunctionGroupState("PoolFG", "Degraded").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+    EXPECT_TRUE(em.IsRunning("PoolFG", "P"));
+    EXPECT_TRUE(em.IsParked("PoolFG", "Q"));
+    EXPECT_EQ(em.GetParkedCount(), 1U);
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("PoolFG", "Running").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+    EXPECT_TRUE(em.IsRunning("PoolFG", "Q"));
+    EXPECT_EQ(em.GetParkedCount(), 0U);
+
+    // Back to Degraded: Q stops and is parked again
+    ASSERT_TRUE(em.RequestFunctionGroupState("PoolFG", "Degraded").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+    EXPECT_FALSE(em.IsRunning("PoolFG", "Q"));
+    EXPECT_TRUE(em.IsParked("PoolFG", "Q"));
+}
+
+TEST(LocalExecutionManagerTest, UnlikelyParkedProcessesDropped)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+    em.SetPrelaunchTable(kTestPrelaunch, 1U);
+
+    ASSERT_TRUE(em.Prelaunch("PoolFG", "Running").HasValue());
+    ASSERT_TRUE(em.Prelaunch("OtherFG", "Running").HasValue());
+    EXPECT_EQ(em.GetParkedCount(), 3U);
+
+    // Nothing is prelaunched for PoolFG/Off; OtherFG is untouched
+    ASSERT_TRUE(em.RequestFunctionGroupState("PoolFG", "Off").HasValue());
+    EXPECT_EQ(em.GetParkedCount(), 1U);
+    EXPECT_TRUE(em.IsParked("OtherFG", "D"));
+
+    em.StopAll();
+    EXPECT_EQ(em.GetParkedCount(), 0U);
+}
+
+TEST(LocalExecutionManagerTest, PrelaunchWithoutReleaseProtocol)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    // A and B report at once, one-shot C exits while parked
+    ASSERT_TRUE(em.Prelaunch("TestFG", "Running").HasValue());
+    const auto deadline = std::chrono::steady_clock::now() + 1s;
+    while (em.GetParkedCount() != 2U && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(5ms);
+        em.Reap();
+    }
+    ASSERT_EQ(em.GetParkedCount(), 2U);
+    EXPECT_FALSE(em.IsParked("TestFG", "C"));
+
+    // A and B ready from the pending byte, C spawned again
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Running").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+    EXPECT_EQ(em.GetReports()[0].processCount, 3U);
+    EXPECT_EQ(em.GetReports()[0].failedCount, 0U);
+    EXPECT_EQ(em.GetRunningCount(), 2U);
+}
+
+TEST(LocalExecutionManagerTest, PrelaunchNotOpen)
+{
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+
+    EXPECT_FALSE(em.Prelaunch("PoolFG", "Running").HasValue());
+    EXPECT_EQ(em.GetParkedCount(), 0U);
+}
+
+// ============================================================================
+// Function Group state cache
+// ============================================================================
+
+TEST(LocalExecutionManagerTest, ControllerStartupListElided)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Controller",
+                               kControllerTransitions, kControllerTransitionsCount,
+                               kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                               kControllerStateHierarchy, kControllerStateHierarchyCount,
+                               kActionTable, kActionTableCount}).HasValue());
+
+    LocalExecutionManager em(kProcessTable, kProcessTableCount);
+    OPEN_OR_SKIP(em);
+
+    // Startup re-sets MachineFG to Startup after Initial did
+    em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kInitial));
+    em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kStartup));
+    em.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kRunning));
+
+    EXPECT_EQ(em.GetElidedCount("MachineFG"), 1U);
+    EXPECT_STREQ(em.GetFunctionGroupState("MachineFG"), "Running");
+    ASSERT_EQ(em.GetReports().size(), 2U);
+    EXPECT_EQ(em.GetReports()[0].state, "Startup");
+    EXPECT_EQ(em.GetReports()[1].state, "Running");
+}
+
+TEST(LocalExecutionManagerTest, StateRecordedOnceReady)
+{
+    const ActionItem hanging = {ActionType::kSetFunctionGroupState, "TestFG", "Hanging", 0U};
+
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Running").HasValue());
+    EXPECT_EQ(em.GetFunctionGroupState("TestFG"), nullptr);
+    ASSERT_TRUE(em.WaitReady().HasValue());
+    EXPECT_STREQ(em.GetFunctionGroupState("TestFG"), "Running");
+
+    // A request still starting is not elided
+    em.ExecuteAction(hanging);
+    em.ExecuteAction(hanging);
+    EXPECT_EQ(em.GetElidedCount(), 0U);
+    EXPECT_EQ(em.GetFunctionGroupState("TestFG"), nullptr);
+}
+
+TEST(LocalExecutionManagerTest, TerminatedProcessInvalidatesState)
+{
+    const ActionItem running[] = {
+        {ActionType::kSetFunctionGroupState, "TestFG", "Running", 0U},
+    };
+
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    em.ExecuteActionList(running, 1U);
+    em.ExecuteActionList(running, 1U);
+    EXPECT_EQ(em.GetElidedCount(), 1U);
+
+    // A crashed process takes the group out of its state: restarted
+    const int pid = em.GetPid("TestFG", "A");
+    kill(pid, SIGKILL);
+    const auto deadline = std::chrono::steady_clock::now() + 1s;
+    while (em.GetFunctionGroupState("TestFG") != nullptr &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(5ms);
+        em.Reap();
+    }
+    EXPECT_EQ(em.GetFunctionGroupState("TestFG"), nullptr);
+
+    em.ExecuteActionList(running, 1U);
+    EXPECT_EQ(em.GetElidedCount(), 1U);
+    EXPECT_TRUE(em.IsRunning("TestFG", "A"));
+    EXPECT_NE(em.GetPid("TestFG", "A"), pid);
+}
+
+TEST(LocalExecutionManagerTest, FailedStateNotCached)
+{
+    const ActionItem failing[] = {
+        {ActionType::kSetFunctionGroupState, "TestFG", "Failing", 0U},
+    };
+
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+
+    em.ExecuteActionList(failing, 1U);
+    EXPECT_EQ(em.GetFunctionGroupState("TestFG"), nullptr);
+
+    em.ExecuteActionList(failing, 1U);
+    EXPECT_EQ(em.GetElidedCount(), 0U);
+    EXPECT_EQ(em.GetReports().size(), 2U);
+}
+
+// ============================================================================
+// Failed segment compensation
+// ============================================================================
+
+TEST(LocalExecutionManagerTest, FailedSegmentCompensated)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetFunctionGroupState, "TestFG", "Degraded", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kSetFunctionGroupState, "OtherFG", "Running", 0U},
+        {ActionType::kSetFunctionGroupState, "TestFG", "Failing", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+    em.SetCompensationMode(ara::sm::CompensationMode::kFailedSegment);
+
+    const auto result = em.ExecuteActionList(items, 5U);
+
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), StateManagementErrc::kTransitionFailed);
+
+    // TestFG is back in Degraded and ready; OtherFG had no known state to go back to
+    EXPECT_EQ(em.GetCompensatedCount(), 1U);
+    EXPECT_STREQ(em.GetFunctionGroupState("TestFG"), "Degraded");
+    EXPECT_TRUE(em.IsRunning("TestFG", "A"));
+    EXPECT_TRUE(em.IsRunning("OtherFG", "D"));
+    EXPECT_EQ(em.GetReports().back().failedCount, 0U);
+
+    em.StopAll();
+}
+
+TEST(LocalExecutionManagerTest, RetryRedoesOnlyFailedSegment)
+{
+    const ActionItem failing[] = {
+        {ActionType::kSetFunctionGroupState, "OtherFG", "Running", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kSetFunctionGroupState, "TestFG", "Failing", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+    const ActionItem fixed[] = {
+        {ActionType::kSetFunctionGroupState, "OtherFG", "Running", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kSetFunctionGroupState, "TestFG", "Running", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+    };
+
+    LocalExecutionManager em(kTestProcesses, kTestProcessCount);
+    OPEN_OR_SKIP(em);
+    em.SetCompensationMode(ara::sm::CompensationMode::kFailedSegment);
+
+    ASSERT_FALSE(em.ExecuteActionList(failing, 4U).HasValue());
+    const int pid = em.GetPid("OtherFG", "D");
+
+    // The committed first segment is elided, OtherFG is not restarted
+    ASSERT_TRUE(em.ExecuteActionList(fixed, 4U).HasValue());
+    EXPECT_EQ(em.GetElidedCount("OtherFG"), 1U);
+    EXPECT_EQ(em.GetPid("OtherFG", "D"), pid);
+    EXPECT_TRUE(em.IsRunning("TestFG", "A"));
+
+    em.StopAll();
+}
@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+#include "machine_config.h"
+#include "binary_config.h"
+#include "state_machine.h"
+#include "static_config.h"
+
+using ara::sm::BinaryConfigImage;
+using ara::sm::ConfigTables;
+using ara::sm::IActionExecutor;
+using ara::sm::MachineConfig;
+using ara::sm::RuleMatcher;
+using ara::sm::StateMachine;
+using ara::sm::StateManagementErrc;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for MachineConfig (per-instance table binding)
+ */
+
+namespace {
+
+class CountingExecutor final : public IActionExecutor {
+public:
+    Result ExecuteActionList(const ActionItem* actions, size_t count) override
+    {
+        lastActions = actions;
+        lastCount = count;
+        ++listCalls;
+        return Result();
+    }
+
+    Result ExecuteAction(const ActionItem&) override { return Result(); }
+
+    const ActionItem* lastActions{nullptr};
+    size_t lastCount{0U};
+    int listCalls{0};
+};
+
+const ActionItem kOffActions[] = {
+    {ActionType::kSetFunctionGroupState, "NavigationFG", "Off", 0U},
+};
+
+const TransitionRule kNavigationRules[] = {
+    {States::kOff, Triggers::kStartup, States::kRunning},
+    {States::kRunning, Triggers::kShutdownRequest, States::kOff},
+};
+
+const ErrorRecoveryRule kNavigationRecovery[] = {
+    {States::kRunning, kExecutionErrorAny, States::kDegraded},
+};
+
+const ActionListEntry kNavigationActions[] = {
+    {States::kOff, kOffActions, 1U},
+};
+
+const TransitionRule kTelematicsRules[] = {
+    {States::kOff, Triggers::kStartup, States::kDegraded},
+};
+
+ConfigTables NavigationTables()
+{
+    return {"Navigation",
+            kNavigationRules, 2U,
+            kNavigationRecovery, 1U,
+            nullptr, 0U,
+            kNavigationActions, 1U};
+}
+
+} // namespace
+
+// ============================================================================
+// Per-instance binding
+// ============================================================================
+
+TEST(MachineConfigTest, AgentsUseTheirOwnTables)
+{
+    MachineConfig navigation;
+    MachineConfig telematics;
+    ASSERT_TRUE(navigation.Load(NavigationTables()).HasValue());
+    ASSERT_TRUE(telematics.Load({"Telematics", kTelematicsRules, 1U,
+                                 nullptr, 0U, nullptr, 0U, nullptr, 0U}).HasValue());
+
+    CountingExecutor exec;
+    StateMachine nav("Nav", StateMachine::Category::kAgent, navigation, &exec);
+    StateMachine tel("Tel", StateMachine::Category::kAgent, telematics);
+
+    EXPECT_EQ(&nav.GetConfig(), &navigation);
+    EXPECT_EQ(&tel.GetConfig(), &telematics);
+
+    nav.Start(static_cast<StateMachine::State>(States::kOff));
+    tel.Start(static_cast<StateMachine::State>(States::kOff));
+
+    ASSERT_TRUE(nav.RequestTransition(Triggers::kStartup).HasValue());
+    ASSERT_TRUE(tel.RequestTransition(Triggers::kStartup).HasValue());
+
+    EXPECT_EQ(static_cast<uint32_t>(nav.GetCurrentStateEnum()), States::kRunning);
+    EXPECT_EQ(static_cast<uint32_t>(tel.GetCurrentStateEnum()), States::kDegraded);
+
+    // Action list of the left state comes from the machine's own table
+    EXPECT_EQ(exec.lastActions, navigation.Read()->FindActionList(States::kOff)->actions);
+    EXPECT_EQ(exec.lastCount, 1U);
+}
+
+TEST(MachineConfigTest, ErrorRecoveryFromMachineTables)
+{
+    MachineConfig navigation;
+    ASSERT_TRUE(navigation.Load(NavigationTables()).HasValue());
+    StateMachine sm("Nav", StateMachine::Category::kAgent, navigation);
+
+    sm.Start(static_cast<StateMachine::State>(States::kRunning));
+    sm.HandleErrorNotification(ExecutionErrors::kProcessCrashed);
+
+    EXPECT_EQ(static_cast<uint32_t>(sm.GetCurrentStateEnum()), States::kDegraded);
+
+    // Non-mapped error falls back to Off
+    sm.HandleErrorNotification(ExecutionErrors::kProcessCrashed);
+    EXPECT_EQ(sm.GetCurrentStateEnum(), StateMachine::State::kOff);
+}
+
+TEST(MachineConfigTest, ReloadAppliesToBoundStateMachine)
+{
+    MachineConfig config;
+    ASSERT_TRUE(config.Load(NavigationTables()).HasValue());
+    StateMachine sm("Nav", StateMachine::Category::kAgent, config);
+    sm.Start(static_cast<StateMachine::State>(States::kOff));
+
+    ASSERT_TRUE(config.Load({"Telematics", kTelematicsRules, 1U,
+                             nullptr, 0U, nullptr, 0U, nullptr, 0U}).HasValue());
+
+    ASSERT_TRUE(sm.RequestTransition(Triggers::kStartup).HasValue());
+    EXPECT_EQ(static_cast<uint32_t>(sm.GetCurrentStateEnum()), States::kDegraded);
+}
+
+TEST(MachineConfigTest, InvalidLoadKeepsPreviousTables)
+{
+    MachineConfig config;
+    EXPECT_FALSE(config.IsLoaded());
+    ASSERT_TRUE(config.Load(NavigationTables()).HasValue());
+
+    const ErrorRecoveryRule bad[] = {{States::kRunning, kExecutionErrorAny, 0x300U}};
+    auto r = config.Load({"Bad", nullptr, 0U, bad, 1U, nullptr, 0U, nullptr, 0U});
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kInvalidValue);
+    EXPECT_TRUE(config.IsLoaded());
+    EXPECT_EQ(config.Read()->GetName(), "Navigation");
+}
+
+// ============================================================================
+// Sources
+// ============================================================================
+
+TEST(MachineConfigTest, LoadFileFromBinaryImage)
+{
+    const std::string path = "machine_config_test.smcfg";
+    ASSERT_TRUE(BinaryConfigImage::WriteFile(path, BinaryConfigImage::Build(
+        "Navigation",
+        kNavigationRules, 2U,
+        kNavigationRecovery, 1U,
+        nullptr, 0U,
+        kNavigationActions, 1U)).HasValue());
+
+    MachineConfig config;
+    ASSERT_TRUE(config.LoadFile(path).HasValue());
+    std::remove(path.c_str());
+
+    const auto snapshot = config.Read();
+    EXPECT_EQ(snapshot->GetName(), "Navigation");
+    EXPECT_EQ(snapshot->FindRecovery(States::kRunning, 0x1234U), States::kDegraded);
+    EXPECT_STREQ(snapshot->FindActionList(States::kOff)->actions[0].target, "NavigationFG");
+}
+
+TEST(MachineConfigTest, LoadFileMissing)
+{
+    MachineConfig config;
+
+    auto r = config.LoadFile("does_not_exist.smcfg");
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kOperationFailed);
+    EXPECT_FALSE(config.IsLoaded());
+}
+
+TEST(MachineConfigTest, DefaultConfigsPerCategory)
+{
+    StateMachine controller("C", StateMachine::Category::kController);
+    StateMachine agent("A", StateMachine::Category::kAgent);
+
+    EXPECT_EQ(&controller.GetConfig(),
+              &MachineConfig::GetDefault(StateMachine::Category::kController));
+    EXPECT_EQ(&agent.GetConfig(),
+              &MachineConfig::GetDefault(StateMachine::Category::kAgent));
+
+    EXPECT_EQ(controller.GetConfig().Read()->GetActionListCount(), kActionTableCount);
+    EXPECT_EQ(agent.GetConfig().Read()->GetActionListCount(), kInfotainmentActionTableCount);
+    EXPECT_EQ(agent.GetConfig().Read()->GetTransitionCount(), kInfotainmentTransitionsCount);
+}
+
+TEST(MachineConfigTest, DefaultConfigsUseGeneratedPerfectHash)
+{
+    const auto snapshot = MachineConfig::GetDefault(StateMachine::Category::kController).Read();
+
+    EXPECT_EQ(snapshot->GetTransitionEngine(), RuleMatcher::Engine::kPerfectHash);
+    EXPECT_EQ(snapshot->GetRecoveryEngine(), RuleMatcher::Engine::kPerfectHash);
+    EXPECT_EQ(snapshot->FindTransition(States::kInitial, Triggers::kStartup, 0U),
+              States::kStartup);
+    EXPECT_EQ(snapshot->FindRecovery(States::kVerifyUpdate, ExecutionErrors::kCommunicationError),
+              States::kPrepareRollback);
+
+    // Planner and allowed triggers are read back from the hash
+    EXPECT_TRUE(snapshot->GetAllowedTriggers(States::kInitial).Contains(Triggers::kStartup));
+    EXPECT_FALSE(snapshot->GetAllowedTriggers(States::kInitial).Contains(999U));
+    EXPECT_EQ(snapshot->GetPlanner().GetDistance(States::kInitial, States::kShutdown), 2U);
+
+    const auto agent = MachineConfig::GetDefault(StateMachine::Category::kAgent).Read();
+    EXPECT_EQ(agent->GetTransitionEngine(), RuleMatcher::Engine::kPerfectHash);
+}
+
+TEST(MachineConfigTest, LoadedTablesCompiledFromTheirRules)
+{
+    // New rules for Initial: the generated hash of the default tables must not answer
+    const TransitionRule rules[] = {
+        {States::kInitial, Triggers::kStartup, States::kShutdown},
+    };
+    MachineConfig machine;
+    ASSERT_TRUE(machine.Load({"Reloaded", rules, 1U,
+                              kControllerErrorRecovery, kControllerErrorRecoveryCount,
+                              kControllerStateHierarchy, kControllerStateHierarchyCount,
+                              kActionTable, kActionTableCount}).HasValue());
+
+    const auto snapshot = machine.Read();
+    EXPECT_NE(snapshot->GetTransitionEngine(), RuleMatcher::Engine::kPerfectHash);
+    EXPECT_NE(snapshot->GetRecoveryEngine(), RuleMatcher::Engine::kPerfectHash);
+    EXPECT_EQ(snapshot->FindTransition(States::kInitial, Triggers::kStartup, 0U),
+              States::kShutdown);
+    EXPECT_EQ(snapshot->GetTransitionCount(), 1U);
+}
@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "action_executor.h"
+#include "config_snapshot.h"
+#include "network_management.h"
+#include "static_config.h"
+
+using ara::sm::ActionExecutor;
+using ara::sm::ConfigSnapshot;
+using ara::sm::LocalNetworkManager;
+using ara::sm::NetworkManagementClient;
+using ara::sm::NmStateRequestEnum;
+using ara::sm::StateManagementErrc;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for the Network Management stand-in and its client
+ */
+
+namespace {
+
+/// Stand-in daemon with a connected client
+class NetworkManagementTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        if (!nm.Open().HasValue()) {
+            GTEST_SKIP() << "No socketpair support on this host";
+        }
+        client.Connect(nm.GetClientFd());
+    }
+
+    NmStateRequestEnum GetState(const char* handle) const
+    {
+        NmStateRequestEnum state = NmStateRequestEnum::kNoCom;
+        EXPECT_TRUE(nm.GetState(handle, state)) << handle;
+        return state;
+    }
+
+    LocalNetworkManager nm;
+    NetworkManagementClient client;
+};
+
+} // namespace
+
+// ============================================================================
+// Caching and batching
+// ============================================================================
+
+TEST_F(NetworkManagementTest, SegmentSentAsOneRequest)
+{
+    ASSERT_TRUE(client.Request("MediaNetwork", NmStateRequestEnum::kFullCom).HasValue());
+    ASSERT_TRUE(client.Request("DiagNetwork", NmStateRequestEnum::kFullCom).HasValue());
+    ASSERT_TRUE(client.Request("BodyNetwork", NmStateRequestEnum::kNoCom).HasValue());
+    EXPECT_EQ(client.GetPendingCount(), 3U);
+    EXPECT_EQ(nm.GetRequestCount(), 0U);
+
+    ASSERT_TRUE(client.Flush().HasValue());
+
+    EXPECT_EQ(nm.GetRequestCount(), 1U);
+    EXPECT_EQ(nm.GetUpdateCount(), 3U);
+    EXPECT_EQ(GetState("MediaNetwork"), NmStateRequestEnum::kFullCom);
+    EXPECT_EQ(GetState("BodyNetwork"), NmStateRequestEnum::kNoCom);
+    EXPECT_EQ(client.GetPendingCount(), 0U);
+}
+
+TEST_F(NetworkManagementTest, UnchangedStateSkipped)
+{
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    ASSERT_TRUE(client.Flush().HasValue());
+
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    EXPECT_EQ(client.GetPendingCount(), 0U);
+    ASSERT_TRUE(client.Flush().HasValue());
+
+    EXPECT_EQ(nm.GetRequestCount(), 1U);
+    EXPECT_EQ(client.GetRequestCount(), 2U);
+    EXPECT_EQ(client.GetSkippedCount(), 1U);
+}
+
+TEST_F(NetworkManagementTest, RepeatedInSegmentQueuedOnce)
+{
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    EXPECT_EQ(client.GetPendingCount(), 1U);
+    EXPECT_EQ(client.GetSkippedCount(), 1U);
+
+    // Last request in the segment wins
+    client.Request("MediaNetwork", NmStateRequestEnum::kNoCom);
+    EXPECT_EQ(client.GetPendingCount(), 1U);
+    ASSERT_TRUE(client.Flush().HasValue());
+    EXPECT_EQ(GetState("MediaNetwork"), NmStateRequestEnum::kNoCom);
+}
+
+TEST_F(NetworkManagementTest, SwitchedBackNotSent)
+{
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    ASSERT_TRUE(client.Flush().HasValue());
+
+    client.Request("MediaNetwork", NmStateRequestEnum::kNoCom);
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    ASSERT_TRUE(client.Flush().HasValue());
+
+    EXPECT_EQ(nm.GetRequestCount(), 1U);
+}
+
+TEST_F(NetworkManagementTest, InvalidateRequestsAgain)
+{
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    ASSERT_TRUE(client.Flush().HasValue());
+
+    client.Invalidate();
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    ASSERT_TRUE(client.Flush().HasValue());
+
+    EXPECT_EQ(nm.GetRequestCount(), 2U);
+}
+
+TEST_F(NetworkManagementTest, FailedRequestForgotten)
+{
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    nm.Close();
+
+    auto result = client.Flush();
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(result.Error(), StateManagementErrc::kOperationFailed);
+
+    // Not cached as FullCom: queued again
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    EXPECT_EQ(client.GetPendingCount(), 1U);
+}
+
+TEST(NetworkManagementStandaloneTest, LateReplyNotTakenForNext)
+{
+    LocalNetworkManager nm;
+    if (!nm.Open().HasValue()) {
+        GTEST_SKIP() << "No socketpair support on this host";
+    }
+    NetworkManagementClient client(std::chrono::milliseconds(60));
+    client.Connect(nm.GetClientFd());
+    nm.SetReplyDelay(std::chrono::milliseconds(100));
+
+    // Times out; its "OK" arrives while the next request waits
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    EXPECT_FALSE(client.Flush().HasValue());
+
+    // Its own reply is still 100 ms away: the late one must not count
+    client.Request("DiagNetwork", NmStateRequestEnum::kFullCom);
+    EXPECT_FALSE(client.Flush().HasValue());
+
+    nm.SetReplyDelay(std::chrono::milliseconds(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+
+    // Skips the late reply to the second request
+    client.Request("BodyNetwork", NmStateRequestEnum::kNoCom);
+    ASSERT_TRUE(client.Flush().HasValue());
+    NmStateRequestEnum state = NmStateRequestEnum::kFullCom;
+    EXPECT_TRUE(nm.GetState("BodyNetwork", state));
+    EXPECT_EQ(state, NmStateRequestEnum::kNoCom);
+    EXPECT_EQ(nm.GetRequestCount(), 3U);
+}
+
+TEST(NetworkManagementStandaloneTest, NotConnected)
+{
+    NetworkManagementClient client;
+
+    EXPECT_TRUE(client.Flush().HasValue());     // Nothing queued
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    EXPECT_FALSE(client.Flush().HasValue());
+    EXPECT_FALSE(client.Request(nullptr, NmStateRequestEnum::kNoCom).HasValue());
+}
+
+TEST(NetworkManagementStandaloneTest, RegisteredHandleIds)
+{
+    NetworkManagementClient client;
+
+    const auto media = client.RegisterHandle("MediaNetwork");
+    ASSERT_NE(media, ara::sm::kNoSymbol);
+    EXPECT_EQ(client.RegisterHandle("MediaNetwork"), media);
+    EXPECT_EQ(client.RegisterHandle(nullptr), ara::sm::kNoSymbol);
+
+    NmStateRequestEnum state = NmStateRequestEnum::kNoCom;
+    EXPECT_FALSE(client.GetState(media, state));
+    ASSERT_TRUE(client.Request(media, NmStateRequestEnum::kFullCom).HasValue());
+    EXPECT_TRUE(client.GetState(media, state));
+    EXPECT_EQ(state, NmStateRequestEnum::kFullCom);
+
+    // Same handle by name
+    client.Request("MediaNetwork", NmStateRequestEnum::kFullCom);
+    EXPECT_EQ(client.GetSkippedCount(), 1U);
+    EXPECT_FALSE(client.Request(static_cast<ara::sm::SymbolId>(media + 1U),
+                                NmStateRequestEnum::kNoCom).HasValue());
+}
+
+TEST(NetworkManagementStandaloneTest, ParseState)
+{
+    NmStateRequestEnum state = NmStateRequestEnum::kNoCom;
+
+    EXPECT_TRUE(NetworkManagementClient::ParseState("FullCom", state));
+    EXPECT_EQ(state, NmStateRequestEnum::kFullCom);
+    EXPECT_TRUE(NetworkManagementClient::ParseState("NoCom", state));
+    EXPECT_EQ(state, NmStateRequestEnum::kNoCom);
+    EXPECT_FALSE(NetworkManagementClient::ParseState("PartialCom", state));
+    EXPECT_FALSE(NetworkManagementClient::ParseState(nullptr, state));
+}
+
+// ============================================================================
+// Action lists
+// ============================================================================
+
+TEST_F(NetworkManagementTest, AgentStatesThroughExecutor)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load({"Infotainment",
+                               kInfotainmentTransitions, kInfotainmentTransitionsCount,
+                               kInfotainmentErrorRecovery, kInfotainmentErrorRecoveryCount,
+                               kInfotainmentStateHierarchy, kInfotainmentStateHierarchyCount,
+                               kInfotainmentActionTable, kInfotainmentActionTableCount}).HasValue());
+
+    ActionExecutor executor;
+    executor.SetNetworkManagement(&client);
+
+    // Running and Degraded both request MediaNetwork FullCom
+    executor.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kRunning));
+    executor.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kDegraded));
+    executor.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kRunning));
+    EXPECT_EQ(nm.GetRequestCount(), 1U);
+    EXPECT_EQ(GetState("MediaNetwork"), NmStateRequestEnum::kFullCom);
+
+    executor.ExecuteResolvedActionList(*snapshot.FindResolvedActionList(States::kOff));
+    EXPECT_EQ(nm.GetRequestCount(), 2U);
+    EXPECT_EQ(GetState("MediaNetwork"), NmStateRequestEnum::kNoCom);
+    EXPECT_EQ(client.GetSkippedCount(), 2U);
+}
+
+TEST_F(NetworkManagementTest, ItemActionListFlushedAtSync)
+{
+    const ActionItem items[] = {
+        {ActionType::kSetNetworkHandle, "MediaNetwork", "FullCom", 0U},
+        {ActionType::kSetNetworkHandle, "DiagNetwork", "FullCom", 0U},
+        {ActionType::kSync, nullptr, nullptr, 0U},
+        {ActionType::kSetNetworkHandle, "DiagNetwork", "NoCom", 0U},
+    };
+
+    ActionExecutor executor;
+    executor.SetNetworkManagement(&client);
+    executor.ExecuteActionList(items, 4U);
+
+    // One request per segment
+    EXPECT_EQ(nm.GetRequestCount(), 2U);
+    EXPECT_EQ(nm.GetUpdateCount(), 3U);
+    EXPECT_EQ(GetState("DiagNetwork"), NmStateRequestEnum::kNoCom);
+}
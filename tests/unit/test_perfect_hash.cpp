@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+#include "perfect_hash.h"
+#include "compiled_rule_table.h"
+#include "sm_perfect_hash_tables.h"
+#include "static_config.h"
+
+using ara::sm::CompiledRuleTable;
+using ara::sm::PerfectHashData;
+using ara::sm::PerfectHashTable;
+
+namespace generated = ara::sm::generated;
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for perfect hash dispatch (runtime and generated)
+ *
+ * AUTOSAR:
+ *  - SWS_SM_00603 – SWS_SM_00607
+ *  - SWS_SM_00601, SWS_SM_CONSTR_00014
+ */
+
+namespace {
+
+/// Every (state, key) the dense table knows about, plus misses
+void ExpectSameAsDense(const PerfectHashTable& hash, const CompiledRuleTable& dense,
+                       const std::vector<uint32_t>& extraKeys)
+{
+    std::vector<uint32_t> keys = extraKeys;
+    for (std::size_t i = 0; i < dense.GetKeyCount(); i++) {
+        keys.push_back(dense.GetKey(i));
+    }
+
+    for (uint32_t state = 0; state < 256U; state++) {
+        for (const uint32_t key : keys) {
+            for (ConditionMask conditions = 0U; conditions < 4U; conditions++) {
+                ASSERT_EQ(hash.Find(static_cast<uint8_t>(state), key, conditions),
+                          dense.Find(static_cast<uint8_t>(state), key, conditions))
+                    << "state=" << state << " key=" << key;
+            }
+        }
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// Runtime construction
+// ============================================================================
+
+TEST(PerfectHashTest, MinimalAndCollisionFreeOnSparseKeys)
+{
+    std::mt19937 rng(3U);
+    std::vector<TransitionRule> rules;
+    std::set<uint64_t> unique;
+    while (rules.size() < 3000U) {
+        const auto state = static_cast<uint32_t>(rng() % 100U);
+        const auto key = static_cast<uint32_t>(rng());
+        if (unique.insert(PerfectHashTable::PackKey(static_cast<uint8_t>(state), key)).second) {
+            rules.push_back({state, key, static_cast<uint32_t>(rng() % 100U)});
+        }
+    }
+
+    const auto dense = CompiledRuleTable::FromTransitions(rules.data(), rules.size(), nullptr, 0U);
+    const auto data = PerfectHashData::FromRuleTable(dense);
+
+    ASSERT_TRUE(data.IsValid());
+    EXPECT_EQ(data.GetSlotKeys().size(), rules.size());
+
+    const PerfectHashTable view = data.View();
+    for (const auto& rule : rules) {
+        EXPECT_EQ(view.Find(static_cast<uint8_t>(rule.fromState), rule.trigger), rule.toState);
+    }
+    EXPECT_EQ(view.Find(7U, 0x12345U), PerfectHashTable::kNoMatch);
+}
+
+TEST(PerfectHashTest, GuardsHierarchyAndWildcardMatchDense)
+{
+    const StateHierarchyRule hierarchy[] = {
+        {52U, 50U},
+    };
+    const TransitionRule transitions[] = {
+        {50U, 5U, States::kRunning},
+        {52U, 5U, States::kDegraded, {0x1U, 0U}},
+        {52U, 0x80000000U, States::kOff},
+    };
+    const ErrorRecoveryRule recovery[] = {
+        {50U, ExecutionErrors::kMemoryViolation, States::kRestart},
+        {52U, kExecutionErrorAny, States::kOff},
+        {52U, ExecutionErrors::kProcessCrashed, States::kDegraded},
+    };
+
+    const auto denseTransitions = CompiledRuleTable::FromTransitions(transitions, 3U, hierarchy, 1U);
+    const auto transitionHash = PerfectHashData::FromRuleTable(denseTransitions);
+    ASSERT_TRUE(transitionHash.IsValid());
+    ExpectSameAsDense(transitionHash.View(), denseTransitions, {6U, 0xFFFFFFFFU});
+
+    const auto denseRecovery = CompiledRuleTable::FromErrorRecovery(recovery, 3U, hierarchy, 1U);
+    const auto recoveryHash = PerfectHashData::FromRuleTable(denseRecovery);
+    ASSERT_TRUE(recoveryHash.IsValid());
+    ExpectSameAsDense(recoveryHash.View(), denseRecovery, {0xCAFEU});
+    EXPECT_EQ(recoveryHash.View().Find(52U, 0xCAFEU), States::kOff);
+}
+
+TEST(PerfectHashTest, EdgesMatchDense)
+{
+    const StateHierarchyRule hierarchy[] = {
+        {52U, 50U},
+    };
+    const TransitionRule transitions[] = {
+        {50U, 5U, States::kRunning},
+        {52U, 5U, States::kDegraded, {0x1U, 0U}},
+        {52U, 0x80000000U, States::kOff},
+        {50U, 2U, States::kOff},
+    };
+
+    const auto dense = CompiledRuleTable::FromTransitions(transitions, 4U, hierarchy, 1U);
+    const auto data = PerfectHashData::FromRuleTable(dense);
+    ASSERT_TRUE(data.IsValid());
+
+    const auto expected = dense.GetEdges();
+    const auto edges = data.View().GetEdges();
+
+    // Both ordered by state, then key, then resolution order
+    ASSERT_EQ(edges.size(), expected.size());
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        EXPECT_EQ(edges[i].fromState, expected[i].fromState) << i;
+        EXPECT_EQ(edges[i].key, expected[i].key) << i;
+        EXPECT_EQ(edges[i].toState, expected[i].toState) << i;
+        EXPECT_EQ(edges[i].guard.allOf, expected[i].guard.allOf) << i;
+        EXPECT_EQ(edges[i].last, expected[i].last) << i;
+    }
+}
+
+TEST(PerfectHashTest, EmptyTable)
+{
+    const auto dense = CompiledRuleTable::FromTransitions(nullptr, 0U, nullptr, 0U);
+    const auto data = PerfectHashData::FromRuleTable(dense);
+
+    ASSERT_TRUE(data.IsValid());
+    EXPECT_EQ(data.View().Find(0U, 1U), PerfectHashTable::kNoMatch);
+}
+
+// ============================================================================
+// Generated tables (static_config)
+// ============================================================================
+
+TEST(PerfectHashTest, GeneratedTablesMatchStaticConfig)
+{
+    ExpectSameAsDense(generated::kControllerTransitionHash,
+        CompiledRuleTable::FromTransitions(
+            kControllerTransitions, kControllerTransitionsCount,
+            kControllerStateHierarchy, kControllerStateHierarchyCount),
+        {0U, 999U});
+
+    ExpectSameAsDense(generated::kAgentTransitionHash,
+        CompiledRuleTable::FromTransitions(
+            kInfotainmentTransitions, kInfotainmentTransitionsCount,
+            kInfotainmentStateHierarchy, kInfotainmentStateHierarchyCount),
+        {0U, 999U});
+
+    ExpectSameAsDense(generated::kControllerRecoveryHash,
+        CompiledRuleTable::FromErrorRecovery(
+            kControllerErrorRecovery, kControllerErrorRecoveryCount,
+            kControllerStateHierarchy, kControllerStateHierarchyCount),
+        {0U, 0xDEADU});
+
+    ExpectSameAsDense(generated::kAgentRecoveryHash,
+        CompiledRuleTable::FromErrorRecovery(
+            kInfotainmentErrorRecovery, kInfotainmentErrorRecoveryCount,
+            kInfotainmentStateHierarchy, kInfotainmentStateHierarchyCount),
+        {0U, 0xDEADU});
+}
+
+TEST(PerfectHashTest, GeneratedLookupIsConstexpr)
+{
+    static_assert(generated::kControllerTransitionHash.Find(
+                      static_cast<uint8_t>(States::kInitial), Triggers::kStartup) ==
+                  States::kStartup,
+                  "generated table must be usable in constant expressions");
+
+    SUCCEED();
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <csignal>
+
+#include "process_supervisor.h"
+#include "local_execution_manager.h"
+#include "machine_config.h"
+#include "state_machine.h"
+#include "static_config.h"
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#endif
+
+using ara::sm::IActionExecutor;
+using ara::sm::LocalExecutionManager;
+using ara::sm::MachineConfig;
+using ara::sm::ProcessSupervisor;
+using ara::sm::StateMachine;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for ProcessSupervisor (pidfd/epoll crash detection)
+ */
+
+namespace {
+
+constexpr const char* kReady = "printf R >&3; exec sleep 30";
+
+constexpr ProcessItem kTestProcesses[] = {
+    {"TestFG", "Running", "A", {"/bin/sh", "-c", kReady, nullptr}},
+    {"TestFG", "Running", "B", {"/bin/sh", "-c", kReady, nullptr}},
+    {"TestFG", "Off", "B", {"/bin/sh", "-c", kReady, nullptr}},
+};
+
+constexpr std::size_t kTestProcessCount = sizeof(kTestProcesses) / sizeof(ProcessItem);
+
+const ErrorRecoveryRule kRecovery[] = {
+    {States::kRunning, ExecutionErrors::kProcessCrashed, States::kRestart},
+    {States::kRunning, ExecutionErrors::kMemoryViolation, States::kShutdown},
+};
+
+class NullExecutor final : public IActionExecutor {
+public:
+    Result ExecuteActionList(const ActionItem*, size_t) override { return Result(); }
+    Result ExecuteAction(const ActionItem&) override { return Result(); }
+};
+
+/// SM in Running, fed by a supervisor watching TestFG/Running
+class ProcessSupervisorTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        if (!supervisor.Open().HasValue() || !em.Open().HasValue()) {
+            GTEST_SKIP() << "No pidfd/epoll support on this host";
+        }
+        ASSERT_TRUE(config.Load({"Supervised", nullptr, 0U, kRecovery, 2U,
+                                 nullptr, 0U, nullptr, 0U}).HasValue());
+        sm.Start(static_cast<StateMachine::State>(States::kRunning));
+
+        em.SetSupervisor(&supervisor, &sm);
+        ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Running").HasValue());
+        ASSERT_TRUE(em.WaitReady().HasValue());
+    }
+
+    uint32_t GetState() const { return static_cast<uint32_t>(sm.GetCurrentStateEnum()); }
+
+    MachineConfig config;
+    NullExecutor executor;
+    StateMachine sm{"Supervised", StateMachine::Category::kController, config, &executor};
+    ProcessSupervisor supervisor;
+    LocalExecutionManager em{kTestProcesses, kTestProcessCount};
+};
+
+} // namespace
+
+// ============================================================================
+// Crash detection
+// ============================================================================
+
+TEST_F(ProcessSupervisorTest, ReadyProcessesAreWatched)
+{
+    EXPECT_EQ(supervisor.GetWatchCount(), 2U);
+    EXPECT_TRUE(supervisor.IsWatched(em.GetPid("TestFG", "A")));
+    EXPECT_TRUE(supervisor.IsWatched(em.GetPid("TestFG", "B")));
+}
+
+TEST_F(ProcessSupervisorTest, CrashDeliveredToOwner)
+{
+    const int pid = em.GetPid("TestFG", "A");
+    ASSERT_GT(pid, 0);
+
+    const auto begin = std::chrono::steady_clock::now();
+    kill(pid, SIGKILL);
+    ASSERT_EQ(supervisor.Dispatch(1000), 1U);
+    const auto latency = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_EQ(GetState(), States::kRestart);
+    EXPECT_FALSE(supervisor.IsWatched(pid));
+    EXPECT_EQ(supervisor.GetWatchCount(), 1U);
+    EXPECT_LT(latency, std::chrono::milliseconds(500));
+}
+
+TEST_F(ProcessSupervisorTest, MemoryViolationClassified)
+{
+    kill(em.GetPid("TestFG", "B"), SIGSEGV);
+    ASSERT_EQ(supervisor.Dispatch(1000), 1U);
+
+    EXPECT_EQ(GetState(), States::kShutdown);
+}
+
+TEST_F(ProcessSupervisorTest, ReapedByParentFirst)
+{
+    const int pid = em.GetPid("TestFG", "B");
+    kill(pid, SIGSEGV);
+
+    // Wait for the exit, then let the EM reap it before dispatching
+    siginfo_t info{};
+    ASSERT_EQ(waitid(P_PID, static_cast<id_t>(pid), &info, WEXITED | WNOWAIT), 0);
+    em.Reap();
+    EXPECT_FALSE(em.IsRunning("TestFG", "B"));
+
+    ASSERT_EQ(supervisor.Dispatch(1000), 1U);
+    EXPECT_EQ(GetState(), States::kShutdown);
+}
+
+TEST_F(ProcessSupervisorTest, PlannedStopNotReported)
+{
+    const int pidA = em.GetPid("TestFG", "A");
+    const int pidB = em.GetPid("TestFG", "B");
+
+    // A leaves TestFG, B stays (configured in Off as well)
+    ASSERT_TRUE(em.RequestFunctionGroupState("TestFG", "Off").HasValue());
+    ASSERT_TRUE(em.WaitReady().HasValue());
+
+    EXPECT_FALSE(supervisor.IsWatched(pidA));
+    EXPECT_TRUE(supervisor.IsWatched(pidB));
+    EXPECT_EQ(supervisor.Dispatch(50), 0U);
+    EXPECT_EQ(GetState(), States::kRunning);
+
+    em.StopAll();
+    EXPECT_EQ(supervisor.GetWatchCount(), 0U);
+    EXPECT_EQ(supervisor.Dispatch(0), 0U);
+}
+
+// ============================================================================
+// Watch bookkeeping
+// ============================================================================
+
+TEST_F(ProcessSupervisorTest, WatchTwiceRejected)
+{
+    const int pid = em.GetPid("TestFG", "A");
+
+    EXPECT_FALSE(supervisor.Watch(pid, "TestFG", "A", &sm).HasValue());
+    EXPECT_TRUE(supervisor.Unwatch(pid));
+    EXPECT_FALSE(supervisor.Unwatch(pid));
+    EXPECT_TRUE(supervisor.Watch(pid, "TestFG", "A", &sm).HasValue());
+}
+
+TEST(ProcessSupervisorStandaloneTest, ClassifyExit)
+{
+#if defined(__linux__)
+    EXPECT_EQ(ProcessSupervisor::ClassifyExit(CLD_KILLED, SIGSEGV), ExecutionErrors::kMemoryViolation);
+    EXPECT_EQ(ProcessSupervisor::ClassifyExit(CLD_DUMPED, SIGBUS), ExecutionErrors::kMemoryViolation);
+    EXPECT_EQ(ProcessSupervisor::ClassifyExit(CLD_KILLED, SIGKILL), ExecutionErrors::kProcessCrashed);
+    EXPECT_EQ(ProcessSupervisor::ClassifyExit(CLD_EXITED, SIGSEGV), ExecutionErrors::kProcessCrashed);
+    EXPECT_EQ(ProcessSupervisor::ClassifyExit(CLD_EXITED, 0), ExecutionErrors::kProcessCrashed);
+#endif
+}
+
+TEST(ProcessSupervisorStandaloneTest, NotOpen)
+{
+    ProcessSupervisor supervisor;
+
+    EXPECT_FALSE(supervisor.Watch(1, "FG", "P", nullptr).HasValue());
+    EXPECT_EQ(supervisor.Dispatch(0), 0U);
+    EXPECT_EQ(supervisor.GetFd(), -1);
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "rule_matcher.h"
+#include "vector_rule_table.h"
+#include "compiled_rule_table.h"
+#include "static_config.h"
+
+using ara::sm::CompiledRuleTable;
+using ara::sm::VectorRuleTable;
+using ara::sm::RuleMatcher;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for VectorRuleTable and RuleMatcher engine selection
+ *
+ * AUTOSAR:
+ *  - SWS_SM_00603 – SWS_SM_00607
+ *  - SWS_SM_00601, SWS_SM_CONSTR_00014
+ */
+
+namespace {
+
+constexpr uint32_t kParent = 50;
+constexpr uint32_t kChild = 52;
+
+const StateHierarchyRule kHierarchy[] = {
+    {kChild, kParent},
+};
+
+std::vector<VectorRuleTable::Isa> SupportedIsas()
+{
+    std::vector<VectorRuleTable::Isa> isas{VectorRuleTable::Isa::kScalar};
+    if (VectorRuleTable::DetectIsa() == VectorRuleTable::Isa::kAvx2) {
+        isas.push_back(VectorRuleTable::Isa::kAvx2);
+    }
+    return isas;
+}
+
+} // namespace
+
+// ============================================================================
+// VectorRuleTable
+// ============================================================================
+
+TEST(VectorRuleTableTest, InheritanceGuardsAndWildcard)
+{
+    const TransitionRule transitions[] = {
+        {kParent, 5U, States::kRunning},
+        {kChild, 5U, States::kDegraded, {0x1U, 0U}},
+        {kChild, 0x80000000U, States::kOff},
+    };
+    const ErrorRecoveryRule recovery[] = {
+        {kParent, ExecutionErrors::kMemoryViolation, States::kRestart},
+        {kChild, kExecutionErrorAny, States::kOff},
+        {kChild, ExecutionErrors::kProcessCrashed, States::kDegraded},
+    };
+
+    for (const auto isa : SupportedIsas()) {
+        auto table = VectorRuleTable::FromTransitions(transitions, 3U, kHierarchy, 1U);
+        ASSERT_TRUE(table.SelectIsa(isa));
+
+        EXPECT_EQ(table.Find(kChild, 5U, 0x1U), States::kDegraded);
+        EXPECT_EQ(table.Find(kChild, 5U, 0x0U), States::kRunning);
+        EXPECT_EQ(table.Find(kChild, 0x80000000U), States::kOff);
+        EXPECT_EQ(table.Find(kChild, 6U), VectorRuleTable::kNoMatch);
+        EXPECT_EQ(table.Find(0xAAU, 5U), VectorRuleTable::kNoMatch);
+
+        auto errors = VectorRuleTable::FromErrorRecovery(recovery, 3U, kHierarchy, 1U);
+        ASSERT_TRUE(errors.SelectIsa(isa));
+
+        EXPECT_EQ(errors.Find(kChild, ExecutionErrors::kProcessCrashed), States::kDegraded);
+        EXPECT_EQ(errors.Find(kChild, ExecutionErrors::kMemoryViolation), States::kOff);
+        EXPECT_EQ(errors.Find(kParent, ExecutionErrors::kMemoryViolation), States::kRestart);
+        EXPECT_EQ(errors.Find(kParent, 0xCAFEU), VectorRuleTable::kNoMatch);
+    }
+}
+
+TEST(VectorRuleTableTest, LastWildcardOfLevelWins)
+{
+    const ErrorRecoveryRule recovery[] = {
+        {kChild, kExecutionErrorAny, States::kOff},
+        {kChild, kExecutionErrorAny, States::kShutdown},
+    };
+
+    const auto table = VectorRuleTable::FromErrorRecovery(recovery, 2U, kHierarchy, 1U);
+    const auto dense = CompiledRuleTable::FromErrorRecovery(recovery, 2U, kHierarchy, 1U);
+
+    EXPECT_EQ(table.Find(kChild, 0xCAFEU), States::kShutdown);
+    EXPECT_EQ(table.Find(kChild, 0xCAFEU), dense.Find(kChild, 0xCAFEU));
+}
+
+TEST(VectorRuleTableTest, MatchesDenseTableOnRandomSparseTable)
+{
+    std::mt19937 rng(42U);
+    std::vector<uint32_t> keyPool;
+    for (int i = 0; i < 300; i++) {
+        keyPool.push_back(static_cast<uint32_t>(rng()));
+    }
+
+    std::vector<TransitionRule> rules;
+    for (int i = 0; i < 2000; i++) {
+        const auto from = static_cast<uint32_t>(rng() % 40U);
+        const uint32_t key = keyPool[rng() % keyPool.size()];
+        const auto to = static_cast<uint32_t>(rng() % 40U);
+        const TransitionGuard guard = (i % 7 == 0)
+            ? TransitionGuard{1U << (rng() % 3U), 0U}
+            : TransitionGuard{0U, 0U};
+        rules.push_back({from, key, to, guard});
+    }
+    const StateHierarchyRule hierarchy[] = {
+        {1U, 0U}, {2U, 1U}, {3U, 1U}, {10U, 3U},
+    };
+
+    const auto dense = CompiledRuleTable::FromTransitions(rules.data(), rules.size(), hierarchy, 4U);
+
+    for (const auto isa : SupportedIsas()) {
+        auto vector = VectorRuleTable::FromTransitions(rules.data(), rules.size(), hierarchy, 4U);
+        ASSERT_TRUE(vector.SelectIsa(isa));
+
+        for (uint32_t state = 0; state < 42U; state++) {
+            for (const uint32_t key : keyPool) {
+                for (ConditionMask conditions = 0U; conditions < 8U; conditions++) {
+                    ASSERT_EQ(vector.Find(static_cast<uint8_t>(state), key, conditions),
+                              dense.Find(static_cast<uint8_t>(state), key, conditions))
+                        << "state=" << state << " key=" << key;
+                }
+            }
+        }
+    }
+}
+
+TEST(VectorRuleTableTest, EdgesMatchDenseTable)
+{
+    std::mt19937 rng(7U);
+    std::vector<TransitionRule> rules;
+    for (int i = 0; i < 500; i++) {
+        const TransitionGuard guard = (i % 5 == 0)
+            ? TransitionGuard{1U, 0U}
+            : TransitionGuard{0U, 0U};
+        rules.push_back({static_cast<uint32_t>(rng() % 12U), static_cast<uint32_t>(rng() % 40U),
+                         static_cast<uint32_t>(rng() % 12U), guard});
+    }
+    const StateHierarchyRule hierarchy[] = {
+        {1U, 0U}, {2U, 1U}, {3U, 1U}, {20U, 3U},
+    };
+
+    auto byState = [](std::vector<CompiledRuleTable::Edge> edges) {
+        std::stable_sort(edges.begin(), edges.end(),
+            [](const CompiledRuleTable::Edge& a, const CompiledRuleTable::Edge& b) {
+                return a.fromState < b.fromState;
+            });
+        return edges;
+    };
+    const auto dense = byState(CompiledRuleTable::FromTransitions(
+        rules.data(), rules.size(), hierarchy, 4U).GetEdges());
+    const auto vector = VectorRuleTable::FromTransitions(
+        rules.data(), rules.size(), hierarchy, 4U).GetEdges();
+
+    ASSERT_EQ(vector.size(), dense.size());
+    for (std::size_t i = 0; i < dense.size(); i++) {
+        EXPECT_EQ(vector[i].fromState, dense[i].fromState) << i;
+        EXPECT_EQ(vector[i].key, dense[i].key) << i;
+        EXPECT_EQ(vector[i].toState, dense[i].toState) << i;
+        EXPECT_EQ(vector[i].guard.allOf, dense[i].guard.allOf) << i;
+        EXPECT_EQ(vector[i].last, dense[i].last) << i;
+    }
+}
+
+// ============================================================================
+// RuleMatcher
+// ============================================================================
+
+TEST(RuleMatcherTest, SelectEngineByShape)
+{
+    EXPECT_EQ(RuleMatcher::SelectEngine(16U, 20U, 30U), RuleMatcher::Engine::kDense);
+    EXPECT_EQ(RuleMatcher::SelectEngine(200U, 5000U, 5000U), RuleMatcher::Engine::kVector);
+    EXPECT_EQ(RuleMatcher::SelectEngine(2U, 2U, RuleMatcher::kDenseRuleLimit + 1U),
+              RuleMatcher::Engine::kVector);
+}
+
+TEST(RuleMatcherTest, LargeSparseTableUsesVectorEngine)
+{
+    std::vector<TransitionRule> rules;
+    for (uint32_t i = 0; i < 20000U; i++) {
+        rules.push_back({i % 200U, 0x10000U + i * 977U, (i + 1U) % 200U});
+    }
+
+    const auto matcher = RuleMatcher::FromTransitions(rules.data(), rules.size(), nullptr, 0U);
+
+    EXPECT_EQ(matcher.GetEngine(), RuleMatcher::Engine::kVector);
+    EXPECT_EQ(matcher.GetDenseTable(), nullptr);
+    EXPECT_EQ(matcher.Find(7U, 0x10000U + 207U * 977U), 8U);
+    EXPECT_EQ(matcher.Find(7U, 0x10000U + 208U * 977U), CompiledRuleTable::kNoMatch);
+}
+
+TEST(RuleMatcherTest, StaticConfigUsesDenseEngine)
+{
+    const auto matcher = RuleMatcher::FromTransitions(
+        kControllerTransitions, kControllerTransitionsCount,
+        kControllerStateHierarchy, kControllerStateHierarchyCount);
+
+    EXPECT_EQ(matcher.GetEngine(), RuleMatcher::Engine::kDense);
+    EXPECT_NE(matcher.GetDenseTable(), nullptr);
+    EXPECT_EQ(matcher.Find(States::kInitial, Triggers::kStartup), States::kStartup);
+}
@@ -3,6 +3,7 @@
 #include "state_machine.h"
 #include "transition_table.h"
 #include "static_config.h"
+#include "condition_word.h"
 
 using namespace ara::sm;
 
@@ -14,21 +15,30 @@ namespace {
 
 class FakeActionExecutor final : public IActionExecutor {
 public:
-    void ExecuteActionList(
-        const ara::sm::config::ActionItem*,
-        size_t) override
+    Result ExecuteActionList(
+        const ara::sm::config::ActionItem* actions,
+        size_t count) override
     {
         ++executeListCalls;
+        lastActions = actions;
+        lastCount = count;
+        const bool failing = fail || (failFrom != 0 && executeListCalls >= failFrom);
+        return failing ? Result(StateManagementErrc::kTransitionFailed) : Result();
     }
 
-    void ExecuteAction(
+    Result ExecuteAction(
         const ara::sm::config::ActionItem&) override
     {
         ++executeActionCalls;
+        return Result();
     }
 
     int executeListCalls{0};
     int executeActionCalls{0};
+    const ara::sm::config::ActionItem* lastActions{nullptr};
+    size_t lastCount{0U};
+    bool fail{false};           ///< Fail every action list
+    int failFrom{0};            ///< Fail from this list call on (0: never)
 };
 
 // ============================================================================
@@ -37,12 +47,12 @@ public:
 
 class RecoveryTriggerExecutor final : public IActionExecutor {
 public:
-    void ExecuteActionList(
+    Result ExecuteActionList(
         const ara::sm::config::ActionItem*,
         size_t) override
     {
         if (!armed)
-            return;
+            return Result();
 
         auto r = sm->RequestTransition(1);
 
@@ -52,10 +62,11 @@ public:
             StateManagementErrc::kRecoveryTransitionOngoing);
 
         hit = true;
+        return Result();
     }
 
-    void ExecuteAction(
-        const ara::sm::config::ActionItem&) override {}
+    Result ExecuteAction(
+        const ara::sm::config::ActionItem&) override { return Result(); }
 
     StateMachine* sm{nullptr};
     bool armed{false};
@@ -68,17 +79,18 @@ public:
 
 class InTransitionObserverExecutor final : public IActionExecutor {
 public:
-    void ExecuteActionList(
+    Result ExecuteActionList(
         const ara::sm::config::ActionItem*,
         size_t) override
     {
         // isInTransition_ == true
         EXPECT_EQ(sm->GetCurrentState(), kInTransitionStateName);
         hit = true;
+        return Result();
     }
 
-    void ExecuteAction(
-        const ara::sm::config::ActionItem&) override {}
+    Result ExecuteAction(
+        const ara::sm::config::ActionItem&) override { return Result(); }
 
     StateMachine* sm{nullptr};
     bool hit{false};
@@ -188,6 +200,42 @@ TEST(StateMachineTest, RequestTransitionSuccess)
     EXPECT_TRUE(r.HasValue());
 }
 
+TEST(StateMachineTest, FailedActionListKeepsState)
+{
+    FakeActionExecutor exec;
+    StateMachine sm("SM", StateMachine::Category::kController, &exec);
+
+    sm.Start(StateMachine::State::kInitial);
+    exec.fail = true;
+
+    auto r = sm.RequestTransition(1);
+
+    EXPECT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kTransitionFailed);
+    EXPECT_EQ(sm.GetCurrentStateEnum(), StateMachine::State::kInitial);
+    EXPECT_FALSE(sm.IsInTransition());
+
+    // Retried once the action list succeeds
+    exec.fail = false;
+    EXPECT_TRUE(sm.RequestTransition(1).HasValue());
+    EXPECT_NE(sm.GetCurrentStateEnum(), StateMachine::State::kInitial);
+}
+
+TEST(StateMachineTest, TransitionRunsTargetStateActionList)
+{
+    FakeActionExecutor exec;
+    StateMachine sm("SM", StateMachine::Category::kController, &exec);
+
+    sm.Start(static_cast<StateMachine::State>(config::States::kRunning));
+    ASSERT_TRUE(sm.RequestTransition(config::Triggers::kShutdownRequest).HasValue());
+
+    // Shutdown's list, not the one of Running
+    ASSERT_EQ(static_cast<uint32_t>(sm.GetCurrentStateEnum()), config::States::kShutdown);
+    ASSERT_NE(exec.lastActions, nullptr);
+    EXPECT_EQ(exec.lastCount, 4U);
+    EXPECT_EQ(exec.lastActions[0].type, config::ActionType::kStopStateMachine);
+}
+
 // ============================================================================
 // Error recovery — linie 84–85
 // ============================================================================
@@ -199,8 +247,9 @@ TEST(StateMachineTest, RequestTransitionBlockedDuringErrorRecovery)
     StateMachine sm("SM", StateMachine::Category::kController, &exec);
     exec.sm = &sm;
 
-    sm.Start(StateMachine::State::kInitial);
+    sm.Start(static_cast<StateMachine::State>(config::States::kRunning));
 
+    // Recovers into Shutdown, whose action list runs during recovery
     exec.armed = true;
     sm.HandleErrorNotification(123);
 
@@ -338,4 +387,129 @@ TEST(StateMachineTest, StateToStringExecutedForNoActionState)
     // TO JEST KLUCZ:
     // wymusza realne wywołanie StateToString(currentState_)
     EXPECT_EQ(sm.GetCurrentState(), "Shutdown");
-}
\ No newline at end of file
+}
+// ============================================================================
+// RequestTargetState — multi-hop
+// ============================================================================
+
+TEST(StateMachineTest, RequestTargetStateRunsShortestChain)
+{
+    FakeActionExecutor exec;
+    StateMachine sm("SM", StateMachine::Category::kController, &exec);
+
+    sm.Start(StateMachine::State::kInitial);
+
+    auto r = sm.RequestTargetState(config::States::kShutdown);
+
+    EXPECT_TRUE(r.HasValue());
+    EXPECT_EQ(static_cast<uint32_t>(sm.GetCurrentStateEnum()),
+              config::States::kShutdown);
+    EXPECT_EQ(exec.executeListCalls, 3);   // Start + 2 hops
+}
+
+TEST(StateMachineTest, RequestTargetStateGuardBlocksWholeChain)
+{
+    FakeActionExecutor exec;
+    StateMachine sm("SM", StateMachine::Category::kController, &exec);
+
+    sm.Start(StateMachine::State::kInitial);
+    ASSERT_TRUE(sm.RequestTargetState(config::States::kRunning).HasValue());
+
+    ConditionWord::Clear(config::Conditions::kUpdateAllowed |
+                         config::Conditions::kUpdateSessionActive);
+    const int callsBefore = exec.executeListCalls;
+
+    auto r = sm.RequestTargetState(config::States::kAfterUpdate);
+
+    EXPECT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kTransitionNotAllowed);
+    EXPECT_EQ(static_cast<uint32_t>(sm.GetCurrentStateEnum()),
+              config::States::kRunning);
+    EXPECT_EQ(exec.executeListCalls, callsBefore);
+
+    ConditionWord::Set(config::Conditions::kUpdateAllowed |
+                       config::Conditions::kUpdateSessionActive);
+
+    EXPECT_TRUE(sm.RequestTargetState(config::States::kAfterUpdate).HasValue());
+    EXPECT_EQ(static_cast<uint32_t>(sm.GetCurrentStateEnum()),
+              config::States::kAfterUpdate);
+
+    ConditionWord::Clear(config::Conditions::kUpdateAllowed |
+                         config::Conditions::kUpdateSessionActive);
+}
+
+TEST(StateMachineTest, RequestTargetStateInvalidIdRejected)
+{
+    FakeActionExecutor exec;
+    StateMachine sm("SM", StateMachine::Category::kController, &exec);
+
+    sm.Start(StateMachine::State::kInitial);
+
+    // Would alias kRunning if truncated to 8 bit
+    auto r = sm.RequestTargetState(256U + config::States::kRunning);
+
+    EXPECT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kTransitionNotAllowed);
+    EXPECT_EQ(static_cast<uint32_t>(sm.GetCurrentStateEnum()),
+              config::States::kInitial);
+    EXPECT_FALSE(sm.RequestTargetState(0xFFU).HasValue());
+}
+
+TEST(StateMachineTest, RequestTargetStateStopsAtFailedHop)
+{
+    FakeActionExecutor exec;
+    StateMachine sm("SM", StateMachine::Category::kController, &exec);
+
+    sm.Start(StateMachine::State::kInitial);
+    exec.failFrom = 3;      // Start and the first hop succeed
+
+    auto r = sm.RequestTargetState(config::States::kShutdown);
+
+    EXPECT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kTransitionFailed);
+    EXPECT_EQ(exec.executeListCalls, 3);
+    EXPECT_EQ(static_cast<uint32_t>(sm.GetCurrentStateEnum()),
+              config::States::kStartup);
+}
+
+TEST(StateMachineTest, RequestTargetStateUnreachableRejected)
+{
+    FakeActionExecutor exec;
+    StateMachine sm("SM", StateMachine::Category::kController, &exec);
+
+    sm.Start(StateMachine::State::kInitial);
+    ASSERT_TRUE(sm.RequestTargetState(config::States::kRestart).HasValue());
+
+    auto r = sm.RequestTargetState(config::States::kRunning);
+
+    EXPECT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kTransitionNotAllowed);
+}
+
+// ============================================================================
+// GetAllowedTriggers
+// ============================================================================
+
+TEST(StateMachineTest, AllowedTriggersFollowCurrentState)
+{
+    FakeActionExecutor exec;
+    StateMachine sm("SM", StateMachine::Category::kController, &exec);
+
+    sm.Start(StateMachine::State::kInitial);
+
+    auto allowed = sm.GetAllowedTriggers();
+    EXPECT_EQ(allowed.ToVector(),
+              (std::vector<uint32_t>{config::Triggers::kStartup,
+                                     config::Triggers::kGoToRunning}));
+
+    auto r = sm.RequestTransition(config::Triggers::kFinishUpdateRequest);
+    EXPECT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kTransitionNotAllowed);
+
+    ASSERT_TRUE(sm.RequestTransition(config::Triggers::kGoToRunning).HasValue());
+
+    allowed = sm.GetAllowedTriggers();
+    EXPECT_TRUE(allowed.Contains(config::Triggers::kShutdownRequest));
+    EXPECT_TRUE(allowed.Contains(config::Triggers::kPrepareUpdateRequest));
+    EXPECT_FALSE(allowed.Contains(config::Triggers::kStartup));
+}
@@ -57,17 +57,20 @@ TEST(StaticConfigTest, ControllerTransitionsFromRunning)
     EXPECT_EQ(kControllerTransitions[6].toState, States::kPrepareUpdate);
 }
 
+TEST(StaticConfigTest, ControllerUpdateSessionTransitions)
+{
+    // UpdateSession (parent) -> PrepareRollback
+    EXPECT_EQ(kControllerTransitions[7].fromState, States::kUpdateSession);
+    EXPECT_EQ(kControllerTransitions[7].trigger, Triggers::kPrepareRollbackRequest);
+    EXPECT_EQ(kControllerTransitions[7].toState, States::kPrepareRollback);
+}
+
 TEST(StaticConfigTest, ControllerUpdateCyclePrepareUpdate)
 {
     // PrepareUpdate -> VerifyUpdate
-    EXPECT_EQ(kControllerTransitions[7].fromState, States::kPrepareUpdate);
-    EXPECT_EQ(kControllerTransitions[7].trigger, Triggers::kVerifyUpdateRequest);
-    EXPECT_EQ(kControllerTransitions[7].toState, States::kVerifyUpdate);
-    
-    // PrepareUpdate -> PrepareRollback
     EXPECT_EQ(kControllerTransitions[8].fromState, States::kPrepareUpdate);
-    EXPECT_EQ(kControllerTransitions[8].trigger, Triggers::kPrepareRollbackRequest);
-    EXPECT_EQ(kControllerTransitions[8].toState, States::kPrepareRollback);
+    EXPECT_EQ(kControllerTransitions[8].trigger, Triggers::kVerifyUpdateRequest);
+    EXPECT_EQ(kControllerTransitions[8].toState, States::kVerifyUpdate);
 }
 
 TEST(StaticConfigTest, ControllerUpdateCycleVerifyUpdate)
@@ -76,45 +79,47 @@ TEST(StaticConfigTest, ControllerUpdateCycleVerifyUpdate)
     EXPECT_EQ(kControllerTransitions[9].fromState, States::kVerifyUpdate);
     EXPECT_EQ(kControllerTransitions[9].trigger, Triggers::kFinishUpdateRequest);
     EXPECT_EQ(kControllerTransitions[9].toState, States::kAfterUpdate);
-    
-    // VerifyUpdate -> PrepareRollback
-    EXPECT_EQ(kControllerTransitions[10].fromState, States::kVerifyUpdate);
-    EXPECT_EQ(kControllerTransitions[10].trigger, Triggers::kPrepareRollbackRequest);
-    EXPECT_EQ(kControllerTransitions[10].toState, States::kPrepareRollback);
 }
 
 TEST(StaticConfigTest, ControllerUpdateCyclePrepareRollback)
 {
     // PrepareRollback -> AfterUpdate
-    EXPECT_EQ(kControllerTransitions[11].fromState, States::kPrepareRollback);
-    EXPECT_EQ(kControllerTransitions[11].trigger, Triggers::kFinishUpdateRequest);
-    EXPECT_EQ(kControllerTransitions[11].toState, States::kAfterUpdate);
+    EXPECT_EQ(kControllerTransitions[10].fromState, States::kPrepareRollback);
+    EXPECT_EQ(kControllerTransitions[10].trigger, Triggers::kFinishUpdateRequest);
+    EXPECT_EQ(kControllerTransitions[10].toState, States::kAfterUpdate);
 }
 
 TEST(StaticConfigTest, ControllerTransitionsAfterUpdate)
 {
     // AfterUpdate -> Running
-    EXPECT_EQ(kControllerTransitions[12].fromState, States::kAfterUpdate);
-    EXPECT_EQ(kControllerTransitions[12].trigger, Triggers::kGoToRunning);
-    EXPECT_EQ(kControllerTransitions[12].toState, States::kRunning);
+    EXPECT_EQ(kControllerTransitions[11].fromState, States::kAfterUpdate);
+    EXPECT_EQ(kControllerTransitions[11].trigger, Triggers::kGoToRunning);
+    EXPECT_EQ(kControllerTransitions[11].toState, States::kRunning);
     
     // AfterUpdate -> Shutdown
-    EXPECT_EQ(kControllerTransitions[13].fromState, States::kAfterUpdate);
-    EXPECT_EQ(kControllerTransitions[13].trigger, Triggers::kShutdownRequest);
-    EXPECT_EQ(kControllerTransitions[13].toState, States::kShutdown);
+    EXPECT_EQ(kControllerTransitions[12].fromState, States::kAfterUpdate);
+    EXPECT_EQ(kControllerTransitions[12].trigger, Triggers::kShutdownRequest);
+    EXPECT_EQ(kControllerTransitions[12].toState, States::kShutdown);
 }
 
 TEST(StaticConfigTest, ControllerContinueUpdateTransitions)
 {
     // ContinueUpdate -> VerifyUpdate
-    EXPECT_EQ(kControllerTransitions[14].fromState, States::kContinueUpdate);
-    EXPECT_EQ(kControllerTransitions[14].trigger, Triggers::kVerifyUpdateRequest);
-    EXPECT_EQ(kControllerTransitions[14].toState, States::kVerifyUpdate);
-    
-    // ContinueUpdate -> PrepareRollback
-    EXPECT_EQ(kControllerTransitions[15].fromState, States::kContinueUpdate);
-    EXPECT_EQ(kControllerTransitions[15].trigger, Triggers::kPrepareRollbackRequest);
-    EXPECT_EQ(kControllerTransitions[15].toState, States::kPrepareRollback);
+    EXPECT_EQ(kControllerTransitions[13].fromState, States::kContinueUpdate);
+    EXPECT_EQ(kControllerTransitions[13].trigger, Triggers::kVerifyUpdateRequest);
+    EXPECT_EQ(kControllerTransitions[13].toState, States::kVerifyUpdate);
+}
+
+TEST(StaticConfigTest, ControllerStateHierarchy)
+{
+    // All update-cycle states share UpdateSession as parent
+    ASSERT_EQ(kControllerStateHierarchyCount, 3U);
+    EXPECT_EQ(kControllerStateHierarchy[0].state, States::kPrepareUpdate);
+    EXPECT_EQ(kControllerStateHierarchy[1].state, States::kVerifyUpdate);
+    EXPECT_EQ(kControllerStateHierarchy[2].state, States::kContinueUpdate);
+    for (size_t i = 0; i < kControllerStateHierarchyCount; ++i) {
+        EXPECT_EQ(kControllerStateHierarchy[i].parentState, States::kUpdateSession);
+    }
 }
 
 // ============================================================================
@@ -164,26 +169,28 @@ TEST(StaticConfigTest, ControllerErrorRecoveryFromVerifyUpdate)
     EXPECT_EQ(kControllerErrorRecovery[5].errorCode, ExecutionErrors::kUpdateFailed);
     EXPECT_EQ(kControllerErrorRecovery[5].toState, States::kPrepareRollback);
     
-    // VerifyUpdate + ANY -> PrepareRollback
-    EXPECT_EQ(kControllerErrorRecovery[6].fromState, States::kVerifyUpdate);
-    EXPECT_EQ(kControllerErrorRecovery[6].errorCode, kExecutionErrorAny);
-    EXPECT_EQ(kControllerErrorRecovery[6].toState, States::kPrepareRollback);
 }
 
-TEST(StaticConfigTest, ControllerErrorRecoveryFromPrepareUpdate)
+TEST(StaticConfigTest, ControllerErrorRecoveryFromUpdateSession)
 {
-    // PrepareUpdate + ANY -> PrepareRollback
-    EXPECT_EQ(kControllerErrorRecovery[7].fromState, States::kPrepareUpdate);
-    EXPECT_EQ(kControllerErrorRecovery[7].errorCode, kExecutionErrorAny);
-    EXPECT_EQ(kControllerErrorRecovery[7].toState, States::kPrepareRollback);
+    // UpdateSession (parent of PrepareUpdate/VerifyUpdate) + ANY -> PrepareRollback
+    EXPECT_EQ(kControllerErrorRecovery[6].fromState, States::kUpdateSession);
+    EXPECT_EQ(kControllerErrorRecovery[6].errorCode, kExecutionErrorAny);
+    EXPECT_EQ(kControllerErrorRecovery[6].toState, States::kPrepareRollback);
 }
 
-TEST(StaticConfigTest, ControllerErrorRecoveryGlobalCatchAll)
+TEST(StaticConfigTest, ControllerErrorRecoveryRunningCatchAllUnique)
 {
-    // Global catch-all (last entry)
-    EXPECT_EQ(kControllerErrorRecovery[8].fromState, States::kRunning);
-    EXPECT_EQ(kControllerErrorRecovery[8].errorCode, kExecutionErrorAny);
-    EXPECT_EQ(kControllerErrorRecovery[8].toState, States::kShutdown);
+    // Running catch-all is configured exactly once
+    size_t count = 0;
+    for (size_t i = 0; i < kControllerErrorRecoveryCount; ++i) {
+        if (kControllerErrorRecovery[i].fromState == States::kRunning &&
+            kControllerErrorRecovery[i].errorCode == kExecutionErrorAny) {
+            ++count;
+        }
+    }
+    EXPECT_EQ(count, 1U);
+    EXPECT_EQ(kControllerErrorRecoveryCount, 7U);
 }
 
 // ============================================================================
@@ -208,22 +215,25 @@ TEST(StaticConfigTest, InfotainmentTransitionsFromInitial)
     EXPECT_EQ(kInfotainmentTransitions[1].toState, States::kRunning);
 }
 
-TEST(StaticConfigTest, InfotainmentTransitionsFromRunning)
+TEST(StaticConfigTest, InfotainmentTransitionsFromOperational)
 {
-    // Running -> Off
-    EXPECT_EQ(kInfotainmentTransitions[2].fromState, States::kRunning);
+    // Operational (parent of Running/Degraded) -> Off
+    EXPECT_EQ(kInfotainmentTransitions[2].fromState, States::kOperational);
     EXPECT_EQ(kInfotainmentTransitions[2].trigger, Triggers::kShutdownRequest);
     EXPECT_EQ(kInfotainmentTransitions[2].toState, States::kOff);
     
+    // Operational (parent of Running/Degraded) -> PrepareUpdate
+    EXPECT_EQ(kInfotainmentTransitions[3].fromState, States::kOperational);
+    EXPECT_EQ(kInfotainmentTransitions[3].trigger, Triggers::kPrepareUpdateRequest);
+    EXPECT_EQ(kInfotainmentTransitions[3].toState, States::kPrepareUpdate);
+}
+
+TEST(StaticConfigTest, InfotainmentTransitionsFromRunning)
+{
     // Running -> Degraded
-    EXPECT_EQ(kInfotainmentTransitions[3].fromState, States::kRunning);
-    EXPECT_EQ(kInfotainmentTransitions[3].trigger, Triggers::kDegradeRequest);
-    EXPECT_EQ(kInfotainmentTransitions[3].toState, States::kDegraded);
-    
-    // Running -> PrepareUpdate
     EXPECT_EQ(kInfotainmentTransitions[4].fromState, States::kRunning);
-    EXPECT_EQ(kInfotainmentTransitions[4].trigger, Triggers::kPrepareUpdateRequest);
-    EXPECT_EQ(kInfotainmentTransitions[4].toState, States::kPrepareUpdate);
+    EXPECT_EQ(kInfotainmentTransitions[4].trigger, Triggers::kDegradeRequest);
+    EXPECT_EQ(kInfotainmentTransitions[4].toState, States::kDegraded);
 }
 
 TEST(StaticConfigTest, InfotainmentTransitionsFromDegraded)
@@ -232,11 +242,19 @@ TEST(StaticConfigTest, InfotainmentTransitionsFromDegraded)
     EXPECT_EQ(kInfotainmentTransitions[5].fromState, States::kDegraded);
     EXPECT_EQ(kInfotainmentTransitions[5].trigger, Triggers::kGoToRunning);
     EXPECT_EQ(kInfotainmentTransitions[5].toState, States::kRunning);
-    
-    // Degraded -> Off
-    EXPECT_EQ(kInfotainmentTransitions[6].fromState, States::kDegraded);
-    EXPECT_EQ(kInfotainmentTransitions[6].trigger, Triggers::kShutdownRequest);
-    EXPECT_EQ(kInfotainmentTransitions[6].toState, States::kOff);
+}
+
+TEST(StaticConfigTest, InfotainmentStateHierarchy)
+{
+    ASSERT_EQ(kInfotainmentStateHierarchyCount, 4U);
+    EXPECT_EQ(kInfotainmentStateHierarchy[0].state, States::kRunning);
+    EXPECT_EQ(kInfotainmentStateHierarchy[0].parentState, States::kOperational);
+    EXPECT_EQ(kInfotainmentStateHierarchy[1].state, States::kDegraded);
+    EXPECT_EQ(kInfotainmentStateHierarchy[1].parentState, States::kOperational);
+    EXPECT_EQ(kInfotainmentStateHierarchy[2].state, States::kPrepareUpdate);
+    EXPECT_EQ(kInfotainmentStateHierarchy[2].parentState, States::kUpdateSession);
+    EXPECT_EQ(kInfotainmentStateHierarchy[3].state, States::kVerifyUpdate);
+    EXPECT_EQ(kInfotainmentStateHierarchy[3].parentState, States::kUpdateSession);
 }
 
 // ============================================================================
@@ -375,7 +393,7 @@ TEST(StaticConfigTest, ControllerActionTableRunningActions)
 TEST(StaticConfigTest, ControllerActionTableShutdownActions)
 {
     EXPECT_EQ(kActionTable[3].state, States::kShutdown);
-    EXPECT_EQ(kActionTable[3].actionCount, 5);
+    EXPECT_EQ(kActionTable[3].actionCount, 4);
     
     const ActionItem* actions = kActionTable[3].actions;
     
@@ -61,6 +61,11 @@ TEST_F(StateIdToStringTest, ReturnsCorrectStringForDegraded) {
     EXPECT_STREQ("Degraded", StateIdToString(States::kDegraded));
 }
 
+TEST_F(StateIdToStringTest, ReturnsCorrectStringForCompositeStates) {
+    EXPECT_STREQ("UpdateSession", StateIdToString(States::kUpdateSession));
+    EXPECT_STREQ("Operational", StateIdToString(States::kOperational));
+}
+
 TEST_F(StateIdToStringTest, ReturnsCorrectStringForInTransition) {
     EXPECT_STREQ("InTransition", StateIdToString(States::kInTransition));
 }
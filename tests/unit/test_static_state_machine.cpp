@@ -0,0 +1,264 @@
+#include <gtest/gtest.h>
+
+#include "static_state_machine.h"
+#include "action_executor.h"
+#include "controller_machine_config.h"
+#include "compiled_rule_table.h"
+#include "condition_word.h"
+#include "static_config.h"
+
+#include <chrono>
+
+using ara::sm::CompiledRuleTable;
+using ara::sm::ConditionWord;
+using ara::sm::IActionExecutor;
+using ara::sm::StateManagementErrc;
+using ara::sm::StaticStateMachine;
+
+namespace machine = ara::sm::generated::controller_machine;
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for StaticStateMachine (compile-time specialized tables)
+ */
+
+namespace {
+
+using ControllerMachine = StaticStateMachine<machine::Tables>;
+
+// Resolved entirely by the compiler
+static_assert(ControllerMachine::FindTransition(States::kInitial, Triggers::kStartup) ==
+              States::kStartup, "direct transition");
+static_assert(ControllerMachine::FindTransition(States::kVerifyUpdate,
+                                                Triggers::kPrepareRollbackRequest) ==
+              States::kPrepareRollback, "inherited transition");
+static_assert(ControllerMachine::FindTransition(States::kRunning, Triggers::kPrepareUpdateRequest,
+                                                Conditions::kUpdateAllowed |
+                                                Conditions::kUpdateSessionActive) ==
+              States::kPrepareUpdate, "guarded transition");
+static_assert(ControllerMachine::FindTransition(States::kRunning,
+                                                Triggers::kPrepareUpdateRequest) ==
+              ControllerMachine::kNoMatch, "failing guard");
+static_assert(ControllerMachine::FindRecovery(States::kRunning, 0xBEEFU) == States::kShutdown,
+              "wildcard recovery");
+
+class FakeActionExecutor final : public IActionExecutor {
+public:
+    Result ExecuteActionList(const ActionItem* actions, size_t count) override
+    {
+        lastActions = actions;
+        lastCount = count;
+        ++listCalls;
+        return fail ? Result(StateManagementErrc::kTransitionFailed) : Result();
+    }
+
+    Result ExecuteAction(const ActionItem&) override { return Result(); }
+
+    const ActionItem* lastActions{nullptr};
+    size_t lastCount{0U};
+    int listCalls{0};
+    bool fail{false};           ///< Fail every action list
+};
+
+// Small table set: wildcard, hierarchy, guards and keys beyond direct indexing
+struct SparseTables {
+    static constexpr TransitionRule kTransitionRules[] = {
+        {1U, 0x80000000U, 2U},
+        {3U, 5U, 1U, {0x1U, 0U}},
+        {3U, 5U, 2U},
+        {4U, 7U, 1U},
+        {2U, 1U, 1U},
+    };
+    static constexpr ErrorRecoveryRule kRecoveryRules[] = {
+        {4U, kExecutionErrorAny, 1U},
+        {3U, 9U, 2U},
+    };
+    static constexpr StateHierarchyRule kHierarchy[] = {
+        {3U, 4U},
+        {1U, 4U},
+    };
+
+    static constexpr const TransitionRule* kTransitions = kTransitionRules;
+    static constexpr std::size_t kTransitionsCount = 5U;
+    static constexpr const ErrorRecoveryRule* kErrorRecovery = kRecoveryRules;
+    static constexpr std::size_t kErrorRecoveryCount = 2U;
+    static constexpr const StateHierarchyRule* kStateHierarchy = kHierarchy;
+    static constexpr std::size_t kStateHierarchyCount = 2U;
+    static constexpr const ActionListEntry* kActionTable = nullptr;
+    static constexpr std::size_t kActionTableCount = 0U;
+};
+
+using SparseMachine = StaticStateMachine<SparseTables>;
+
+// SparseTables with an action list bounded to 50 ms
+struct DeadlineTables : SparseTables {
+    static constexpr ActionItem kSlowActions[] = {
+        {ActionType::kSleep, nullptr, nullptr, 2000U},
+        {ActionType::kSetFunctionGroupState, "FG1", "Running", 0U},
+    };
+    static constexpr ActionListEntry kActions[] = {
+        {2U, kSlowActions, 2U, 50U},
+    };
+    static constexpr const ActionListEntry* kActionTable = kActions;
+    static constexpr std::size_t kActionTableCount = 1U;
+};
+
+} // namespace
+
+// ============================================================================
+// Equivalence with the runtime engine
+// ============================================================================
+
+TEST(StaticStateMachineTest, MatchesCompiledRuleTable)
+{
+    const auto transitions = CompiledRuleTable::FromTransitions(
+        machine::kTransitions, machine::kTransitionsCount,
+        machine::kStateHierarchy, machine::kStateHierarchyCount);
+    const auto recovery = CompiledRuleTable::FromErrorRecovery(
+        machine::kErrorRecovery, machine::kErrorRecoveryCount,
+        machine::kStateHierarchy, machine::kStateHierarchyCount);
+
+    for (uint32_t state = 0; state < 64U; state++) {
+        const auto s = static_cast<uint8_t>(state);
+        for (uint32_t key = 0; key < 32U; key++) {
+            for (ConditionMask conditions = 0; conditions < 4U; conditions++) {
+                EXPECT_EQ(ControllerMachine::FindTransition(s, key, conditions),
+                          transitions.Find(s, key, conditions))
+                    << "state=" << state << " trigger=" << key;
+            }
+            EXPECT_EQ(ControllerMachine::FindRecovery(s, key), recovery.Find(s, key))
+                << "state=" << state << " error=" << key;
+            EXPECT_EQ(ControllerMachine::IsTriggerAllowed(s, key),
+                      transitions.GetKeySet(s).Contains(key));
+        }
+        EXPECT_EQ(ControllerMachine::FindRecovery(s, kExecutionErrorAny),
+                  recovery.Find(s, kExecutionErrorAny));
+    }
+}
+
+TEST(StaticStateMachineTest, SparseKeysHierarchyAndGuards)
+{
+    EXPECT_EQ(SparseMachine::FindTransition(1U, 0x80000000U), 2U);
+    EXPECT_EQ(SparseMachine::FindTransition(1U, 7U), 1U);          // inherited
+    EXPECT_EQ(SparseMachine::FindTransition(3U, 5U, 0x1U), 1U);
+    EXPECT_EQ(SparseMachine::FindTransition(3U, 5U, 0x0U), 2U);
+    EXPECT_EQ(SparseMachine::FindTransition(3U, 0x80000001U), SparseMachine::kNoMatch);
+
+    EXPECT_EQ(SparseMachine::FindRecovery(3U, 9U), 2U);
+    EXPECT_EQ(SparseMachine::FindRecovery(3U, 10U), 1U);           // parent wildcard
+    EXPECT_EQ(SparseMachine::FindRecovery(2U, 9U), SparseMachine::kNoMatch);
+    EXPECT_EQ(SparseMachine::FindActionList(1U), nullptr);
+}
+
+// ============================================================================
+// Request API
+// ============================================================================
+
+TEST(StaticStateMachineTest, RequestTransitionRunsActionList)
+{
+    FakeActionExecutor exec;
+    ControllerMachine sm(&exec);
+
+    ASSERT_TRUE(sm.Start(States::kInitial).HasValue());
+    EXPECT_TRUE(sm.IsRunning());
+
+    auto r = sm.RequestTransition(Triggers::kStartup);
+
+    EXPECT_TRUE(r.HasValue());
+    EXPECT_EQ(sm.GetCurrentState(), States::kStartup);
+    EXPECT_EQ(exec.listCalls, 2);
+    EXPECT_EQ(exec.lastActions, ControllerMachine::FindActionList(States::kStartup)->actions);
+}
+
+TEST(StaticStateMachineTest, RequestTransitionNotAllowed)
+{
+    ControllerMachine sm(nullptr, States::kRunning);
+
+    auto r = sm.RequestTransition(Triggers::kStartup);
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kTransitionNotAllowed);
+    EXPECT_EQ(sm.GetCurrentState(), States::kRunning);
+}
+
+TEST(StaticStateMachineTest, GuardUsesConditionWord)
+{
+    ControllerMachine sm(nullptr, States::kRunning);
+
+    EXPECT_FALSE(sm.RequestTransition(Triggers::kPrepareUpdateRequest).HasValue());
+
+    ConditionWord::Set(Conditions::kUpdateAllowed | Conditions::kUpdateSessionActive);
+    auto r = sm.RequestTransition(Triggers::kPrepareUpdateRequest);
+    ConditionWord::Clear(Conditions::kUpdateAllowed | Conditions::kUpdateSessionActive);
+
+    EXPECT_TRUE(r.HasValue());
+    EXPECT_EQ(sm.GetCurrentState(), States::kPrepareUpdate);
+}
+
+TEST(StaticStateMachineTest, RequestTransitionBlockedByUpdate)
+{
+    ControllerMachine sm(nullptr, States::kInitial);
+    sm.SetImpactedByUpdate(true);
+
+    auto r = sm.RequestTransition(Triggers::kStartup);
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kUpdateInProgress);
+    EXPECT_TRUE(sm.IsImpactedByUpdate());
+}
+
+TEST(StaticStateMachineTest, ErrorRecoveryAndFallback)
+{
+    ControllerMachine sm(nullptr, States::kRunning);
+
+    sm.HandleErrorNotification(ExecutionErrors::kProcessCrashed, States::kOff);
+    EXPECT_EQ(sm.GetCurrentState(), States::kRestart);
+
+    sm.HandleErrorNotification(ExecutionErrors::kProcessCrashed, States::kOff);
+    EXPECT_EQ(sm.GetCurrentState(), States::kOff);
+
+    sm.SetImpactedByUpdate(true);
+    sm.HandleErrorNotification(ExecutionErrors::kProcessCrashed, States::kShutdown);
+    EXPECT_EQ(sm.GetCurrentState(), States::kOff);
+}
+
+TEST(StaticStateMachineTest, StopTransitionsToOffState)
+{
+    ControllerMachine sm;
+
+    EXPECT_TRUE(sm.Stop(States::kOff).HasValue());
+    EXPECT_EQ(sm.GetCurrentState(), States::kInitial);
+
+    sm.Start(States::kRunning);
+    EXPECT_TRUE(sm.Stop(States::kOff).HasValue());
+    EXPECT_FALSE(sm.IsRunning());
+    EXPECT_EQ(sm.GetCurrentState(), States::kOff);
+}
+
+TEST(StaticStateMachineTest, FailedStopKeepsRunning)
+{
+    FakeActionExecutor executor;
+    ControllerMachine sm(&executor);
+    sm.Start(States::kRunning);
+
+    executor.fail = true;
+    EXPECT_FALSE(sm.Stop(States::kShutdown).HasValue());
+    EXPECT_TRUE(sm.IsRunning());
+    EXPECT_EQ(sm.GetCurrentState(), States::kRunning);
+}
+
+TEST(StaticStateMachineTest, ActionListDeadline)
+{
+    ara::sm::ActionExecutor executor;
+    StaticStateMachine<DeadlineTables> sm(&executor, 1U);
+
+    const auto begin = std::chrono::steady_clock::now();
+    auto r = sm.RequestTransition(0x80000000U);
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    ASSERT_FALSE(r.HasValue());
+    EXPECT_EQ(r.Error(), StateManagementErrc::kTransitionFailed);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1000));
+    EXPECT_EQ(sm.GetCurrentState(), 1U);
+    EXPECT_EQ(executor.GetFunctionGroupState("FG1"), nullptr);
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "symbol_table.h"
+#include "config_snapshot.h"
+#include "i_action_executor.h"
+#include "static_config.h"
+
+using ara::sm::ConfigSnapshot;
+using ara::sm::ConfigTables;
+using ara::sm::IActionExecutor;
+using ara::sm::kNoSymbol;
+using ara::sm::ResolvedActionList;
+using ara::sm::SymbolId;
+using ara::sm::SymbolKind;
+using ara::sm::SymbolTable;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for SymbolTable (interned action names)
+ */
+
+namespace {
+
+class ItemExecutor final : public IActionExecutor {
+public:
+    Result ExecuteActionList(const ActionItem* actions, size_t count) override
+    {
+        lastActions = actions;
+        lastCount = count;
+        return Result();
+    }
+
+    Result ExecuteAction(const ActionItem&) override { return Result(); }
+
+    const ActionItem* lastActions{nullptr};
+    size_t lastCount{0U};
+};
+
+ConfigTables ControllerTables()
+{
+    return {
+        "Controller",
+        kControllerTransitions, kControllerTransitionsCount,
+        kControllerErrorRecovery, kControllerErrorRecoveryCount,
+        kControllerStateHierarchy, kControllerStateHierarchyCount,
+        kActionTable, kActionTableCount
+    };
+}
+
+} // namespace
+
+// ============================================================================
+// Interning
+// ============================================================================
+
+TEST(SymbolTableTest, InternIsDensePerKind)
+{
+    SymbolTable symbols;
+
+    EXPECT_EQ(symbols.Intern(SymbolKind::kFunctionGroup, "MachineFG"), 0U);
+    EXPECT_EQ(symbols.Intern(SymbolKind::kFunctionGroup, "InfotainmentFG"), 1U);
+    EXPECT_EQ(symbols.Intern(SymbolKind::kNetworkHandle, "VehicleNetwork"), 0U);
+
+    // Same name in another kind is another symbol
+    EXPECT_EQ(symbols.Intern(SymbolKind::kFunctionGroupState, "Off"), 0U);
+    EXPECT_EQ(symbols.Intern(SymbolKind::kStateMachineState, "Off"), 0U);
+
+    EXPECT_EQ(symbols.GetCount(SymbolKind::kFunctionGroup), 2U);
+    EXPECT_EQ(symbols.GetCount(SymbolKind::kStateMachine), 0U);
+}
+
+TEST(SymbolTableTest, InternDeduplicates)
+{
+    SymbolTable symbols;
+    const std::string name = "MachineFG";
+
+    const SymbolId first = symbols.Intern(SymbolKind::kFunctionGroup, "MachineFG");
+    const SymbolId second = symbols.Intern(SymbolKind::kFunctionGroup, name.c_str());
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(symbols.GetCount(SymbolKind::kFunctionGroup), 1U);
+    EXPECT_NE(symbols.GetName(SymbolKind::kFunctionGroup, first), name.c_str());
+    EXPECT_STREQ(symbols.GetName(SymbolKind::kFunctionGroup, first), "MachineFG");
+}
+
+TEST(SymbolTableTest, NullAndEmptyNames)
+{
+    SymbolTable symbols;
+
+    EXPECT_EQ(symbols.Intern(SymbolKind::kFunctionGroup, nullptr), kNoSymbol);
+    EXPECT_EQ(symbols.Intern(SymbolKind::kFunctionGroup, ""), kNoSymbol);
+    EXPECT_EQ(symbols.GetName(SymbolKind::kFunctionGroup, kNoSymbol), nullptr);
+    EXPECT_EQ(symbols.GetCount(SymbolKind::kFunctionGroup), 0U);
+}
+
+TEST(SymbolTableTest, FindDoesNotIntern)
+{
+    SymbolTable symbols;
+    symbols.Intern(SymbolKind::kStateMachine, "InfotainmentSM");
+
+    EXPECT_EQ(symbols.Find(SymbolKind::kStateMachine, "InfotainmentSM"), 0U);
+    EXPECT_EQ(symbols.Find(SymbolKind::kStateMachine, "NavigationSM"), kNoSymbol);
+    EXPECT_EQ(symbols.Find(SymbolKind::kFunctionGroup, "InfotainmentSM"), kNoSymbol);
+    EXPECT_EQ(symbols.GetCount(SymbolKind::kStateMachine), 1U);
+}
+
+TEST(SymbolTableTest, KindsOfActionTypes)
+{
+    EXPECT_EQ(SymbolTable::TargetKind(ActionType::kSetFunctionGroupState),
+              SymbolKind::kFunctionGroup);
+    EXPECT_EQ(SymbolTable::ParamKind(ActionType::kSetFunctionGroupState),
+              SymbolKind::kFunctionGroupState);
+    EXPECT_EQ(SymbolTable::TargetKind(ActionType::kStopStateMachine), SymbolKind::kStateMachine);
+    EXPECT_EQ(SymbolTable::ParamKind(ActionType::kStopStateMachine), SymbolKind::kCount);
+    EXPECT_EQ(SymbolTable::ParamKind(ActionType::kSetNetworkHandle), SymbolKind::kNetworkState);
+    EXPECT_EQ(SymbolTable::TargetKind(ActionType::kSleep), SymbolKind::kCount);
+}
+
+// ============================================================================
+// Snapshot and executor
+// ============================================================================
+
+TEST(SymbolTableTest, SnapshotResolvesActionLists)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load(ControllerTables()).HasValue());
+
+    const ResolvedActionList* list = snapshot.FindResolvedActionList(States::kRunning);
+    ASSERT_NE(list, nullptr);
+    EXPECT_EQ(list->actionCount, snapshot.FindActionList(States::kRunning)->actionCount);
+    EXPECT_EQ(list->items, snapshot.FindActionList(States::kRunning)->actions);
+    EXPECT_EQ(list->symbols, &snapshot.GetSymbols());
+
+    const SymbolTable& symbols = snapshot.GetSymbols();
+    EXPECT_EQ(list->actions[0].target, symbols.Find(SymbolKind::kFunctionGroup, "MachineFG"));
+    EXPECT_EQ(list->actions[1].GetParam(), symbols.Find(SymbolKind::kNetworkState, "FullCom"));
+
+    // Every Controller action targets MachineFG, InfotainmentSM or VehicleNetwork
+    EXPECT_EQ(symbols.GetCount(SymbolKind::kFunctionGroup), 1U);
+    EXPECT_EQ(symbols.GetCount(SymbolKind::kStateMachine), 1U);
+    EXPECT_EQ(symbols.GetCount(SymbolKind::kNetworkHandle), 1U);
+
+    EXPECT_EQ(snapshot.FindResolvedActionList(States::kOff), nullptr);
+}
+
+TEST(SymbolTableTest, DefaultExecutorGetsOriginalItems)
+{
+    ConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load(ControllerTables()).HasValue());
+    const ResolvedActionList* list = snapshot.FindResolvedActionList(States::kShutdown);
+    ASSERT_NE(list, nullptr);
+
+    ItemExecutor exec;
+    static_cast<IActionExecutor&>(exec).ExecuteResolvedActionList(*list);
+
+    EXPECT_EQ(exec.lastActions, list->items);
+    EXPECT_EQ(exec.lastCount, list->actionCount);
+}
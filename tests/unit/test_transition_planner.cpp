@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include "transition_planner.h"
+#include "machine_config.h"
+#include "static_config.h"
+
+using ara::sm::CompiledRuleTable;
+using ara::sm::TransitionPlanner;
+using ara::sm::MachineConfig;
+using ara::sm::TransitionRequestType;
+using ara::sm::StateMachine;
+
+using namespace ara::sm::config;
+
+/**
+ * @brief Unit tests for TransitionPlanner (multi-hop shortest paths)
+ *
+ * AUTOSAR:
+ *  - SWS_SM_00603 – SWS_SM_00607
+ */
+
+namespace {
+
+constexpr uint8_t kA = 60;
+constexpr uint8_t kB = 61;
+constexpr uint8_t kC = 62;
+constexpr uint8_t kD = 63;
+
+} // namespace
+
+// ============================================================================
+// Synthetic tables
+// ============================================================================
+
+TEST(TransitionPlannerTest, ShortcutPreferredOverLongChain)
+{
+    const TransitionRule rules[] = {
+        {kA, 1U, kB},
+        {kB, 2U, kC},
+        {kC, 3U, kD},
+        {kA, 4U, kC},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 4U, nullptr, 0U);
+    const auto planner = TransitionPlanner::Build(table);
+
+    EXPECT_EQ(planner.GetDistance(kA, kD), 2U);
+
+    TransitionRequestType triggers[4];
+    ASSERT_EQ(planner.Plan(kA, kD, triggers, 4U), 2U);
+    EXPECT_EQ(triggers[0], 4U);
+    EXPECT_EQ(triggers[1], 3U);
+}
+
+TEST(TransitionPlannerTest, UnreachableAndSameState)
+{
+    const TransitionRule rules[] = {
+        {kA, 1U, kB},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 1U, nullptr, 0U);
+    const auto planner = TransitionPlanner::Build(table);
+
+    TransitionRequestType triggers[4];
+    EXPECT_EQ(planner.GetDistance(kB, kA), TransitionPlanner::kUnreachable);
+    EXPECT_EQ(planner.Plan(kB, kA, triggers, 4U), 0U);
+    EXPECT_EQ(planner.GetDistance(kA, kA), 0U);
+    EXPECT_EQ(planner.GetDistance(kA, 0xEEU), TransitionPlanner::kUnreachable);
+}
+
+TEST(TransitionPlannerTest, PathLongerThanCapacityRejected)
+{
+    const TransitionRule rules[] = {
+        {kA, 1U, kB},
+        {kB, 2U, kC},
+        {kC, 3U, kD},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 3U, nullptr, 0U);
+    const auto planner = TransitionPlanner::Build(table);
+
+    TransitionRequestType triggers[2];
+    EXPECT_EQ(planner.Plan(kA, kD, triggers, 2U), 0U);
+}
+
+TEST(TransitionPlannerTest, InheritedTransitionsAreEdges)
+{
+    const StateHierarchyRule hierarchy[] = {
+        {kB, kC},
+    };
+    const TransitionRule rules[] = {
+        {kA, 1U, kB},
+        {kC, 2U, kD},
+    };
+
+    const auto table = CompiledRuleTable::FromTransitions(rules, 2U, hierarchy, 1U);
+    const auto planner = TransitionPlanner::Build(table);
+
+    TransitionRequestType triggers[4];
+    ASSERT_EQ(planner.Plan(kA, kD, triggers, 4U), 2U);
+    EXPECT_EQ(triggers[0], 1U);
+    EXPECT_EQ(triggers[1], 2U);
+}
+
+// ============================================================================
+// Static configuration
+// ============================================================================
+
+TEST(TransitionPlannerTest, Controller_InitialToShutdown)
+{
+    const auto snapshot = MachineConfig::GetDefault(StateMachine::Category::kController).Read();
+    const auto& planner = snapshot->GetPlanner();
+
+    TransitionRequestType triggers[4];
+    ASSERT_EQ(planner.Plan(States::kInitial, States::kShutdown, triggers, 4U), 2U);
+    EXPECT_EQ(triggers[0], Triggers::kStartup);
+    EXPECT_EQ(triggers[1], Triggers::kShutdownRequest);
+}
+
+TEST(TransitionPlannerTest, Controller_RunningToAfterUpdateIncludesGuardedEdge)
+{
+    const auto snapshot = MachineConfig::GetDefault(StateMachine::Category::kController).Read();
+    const auto& planner = snapshot->GetPlanner();
+
+    TransitionRequestType triggers[4];
+    ASSERT_EQ(planner.Plan(States::kRunning, States::kAfterUpdate, triggers, 4U), 3U);
+    EXPECT_EQ(triggers[0], Triggers::kPrepareUpdateRequest);
+    EXPECT_EQ(triggers[1], Triggers::kVerifyUpdateRequest);
+    EXPECT_EQ(triggers[2], Triggers::kFinishUpdateRequest);
+
+    EXPECT_EQ(planner.GetDistance(States::kRestart, States::kRunning),
+              TransitionPlanner::kUnreachable);
+}
@@ -3,10 +3,12 @@
 #include "transition_table.h"
 #include "static_config.h"
 #include "state_machine.h"
+#include "condition_word.h"
 
 using ara::sm::TransitionTable;
 using ara::sm::TransitionRequestType;
 using ara::sm::StateMachine;
+using ara::sm::ConditionWord;
 
 using namespace ara::sm::config;
 
@@ -141,3 +143,38 @@ TEST(TransitionTableTest, GetNextState_Agent_NotFound_ReturnsCurrent)
 
     EXPECT_EQ(next, current);
 }
+
+// ============================================================================
+// Guarded transition — Controller Running -> PrepareUpdate
+// ============================================================================
+
+TEST(TransitionTableTest, GuardedTransition_RequiresConditionBits)
+{
+    const ConditionMask required =
+        Conditions::kUpdateAllowed | Conditions::kUpdateSessionActive;
+
+    ConditionWord::Clear(required);
+    EXPECT_FALSE(TransitionTable::IsTransitionAllowed(
+        static_cast<uint8_t>(States::kRunning),
+        Triggers::kPrepareUpdateRequest,
+        StateMachine::Category::kController));
+
+    ConditionWord::Set(Conditions::kUpdateAllowed);
+    EXPECT_FALSE(TransitionTable::IsTransitionAllowed(
+        static_cast<uint8_t>(States::kRunning),
+        Triggers::kPrepareUpdateRequest,
+        StateMachine::Category::kController));
+
+    ConditionWord::Set(Conditions::kUpdateSessionActive);
+    EXPECT_TRUE(TransitionTable::IsTransitionAllowed(
+        static_cast<uint8_t>(States::kRunning),
+        Triggers::kPrepareUpdateRequest,
+        StateMachine::Category::kController));
+    EXPECT_EQ(TransitionTable::GetNextState(
+        static_cast<uint8_t>(States::kRunning),
+        Triggers::kPrepareUpdateRequest,
+        StateMachine::Category::kController),
+        static_cast<uint8_t>(States::kPrepareUpdate));
+
+    ConditionWord::Clear(required);
+}
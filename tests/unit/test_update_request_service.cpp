@@ -2,6 +2,7 @@
 
 #include "update_request_service.h"
 #include "state_machine.h"
+#include "condition_word.h"
 
 using namespace ara::sm;
 
@@ -310,3 +311,21 @@ TEST_F(UpdateRequestServiceFixture, SetUpdateAllowed_IsCovered)
     service.SetUpdateAllowed(UpdateAllowedType::kUpdateNotAllowed);
     EXPECT_FALSE(service.RequestUpdateSession().HasValue());
 }
+
+TEST_F(UpdateRequestServiceFixture, UpdateFlagsArePublishedToConditionWord)
+{
+    UpdateRequestService service;
+
+    service.SetUpdateAllowed(UpdateAllowedType::kUpdateAllowed);
+    EXPECT_TRUE(ConditionWord::IsSet(config::Conditions::kUpdateAllowed));
+    EXPECT_FALSE(ConditionWord::IsSet(config::Conditions::kUpdateSessionActive));
+
+    ASSERT_TRUE(service.RequestUpdateSession().HasValue());
+    EXPECT_TRUE(ConditionWord::IsSet(config::Conditions::kUpdateSessionActive));
+
+    ASSERT_TRUE(service.StopUpdateSession().HasValue());
+    EXPECT_FALSE(ConditionWord::IsSet(config::Conditions::kUpdateSessionActive));
+
+    service.SetUpdateAllowed(UpdateAllowedType::kUpdateNotAllowed);
+    EXPECT_FALSE(ConditionWord::IsSet(config::Conditions::kUpdateAllowed));
+}
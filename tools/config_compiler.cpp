@@ -0,0 +1,697 @@
+/**
+ * @file config_compiler.cpp
+ * @brief Build-time compiler from JSON machine manifests to constexpr tables
+ *
+ *   sm_config_compiler <manifest.json> <output header> [<output image>]
+ *
+ * Reads a declarative manifest (states, triggers, conditions, execution
+ * errors, state hierarchy, transitions, error recovery rules, action
+ * lists with their timeouts and dependencies), validates it and writes a
+ * header with:
+ *  - dense symbolic IDs (explicit "id" values are kept),
+ *  - constexpr rule, hierarchy and action tables with computed counts,
+ *  - a state -> dense index map and a dense index -> action list index,
+ *  - perfect hash dispatch tables for transitions and error recovery.
+ *
+ * With a third argument the same tables are also written as a binary
+ * configuration image (see BinaryConfigImage) for deployment without
+ * recompiling.
+ *
+ * Nothing in the output needs runtime initialization. Any validation
+ * error fails the build with a list of all problems found.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "binary_config.h"
+#include "compiled_rule_table.h"
+#include "perfect_hash.h"
+#include "static_config.h"
+#include "json_reader.h"
+
+using namespace ara::sm;
+using ara::sm::tools::JsonReader;
+using ara::sm::tools::JsonValue;
+
+namespace {
+
+// ============================================================================
+// Symbols
+// ============================================================================
+
+struct Symbol {
+    std::string name;
+    uint32_t id;
+    bool composite;
+};
+
+class SymbolSpace {
+public:
+    SymbolSpace(const char* kind, uint32_t maxId) : kind_(kind), maxId_(maxId) {}
+
+    void Add(const std::string& name, const JsonValue* id, bool composite,
+             std::vector<std::string>& errors)
+    {
+        if (index_.count(name) != 0U) {
+            errors.push_back(std::string("duplicate ") + kind_ + " '" + name + "'");
+            return;
+        }
+
+        uint32_t value = nextId_;
+        if (id != nullptr && id->kind == JsonValue::Kind::kNumber) {
+            value = static_cast<uint32_t>(id->number);
+        }
+        if (value > maxId_) {
+            errors.push_back(std::string(kind_) + " '" + name + "' id out of range");
+        }
+        for (const auto& symbol : symbols_) {
+            if (symbol.id == value) {
+                errors.push_back(std::string(kind_) + " '" + name + "' reuses id of '" +
+                                 symbol.name + "'");
+            }
+        }
+
+        index_[name] = symbols_.size();
+        symbols_.push_back({name, value, composite});
+        nextId_ = value + 1U;
+    }
+
+    bool Resolve(const std::string& name, uint32_t& id, std::vector<std::string>& errors,
+                 const std::string& where) const
+    {
+        const auto it = index_.find(name);
+        if (it == index_.end()) {
+            errors.push_back(where + ": unknown " + kind_ + " '" + name + "'");
+            return false;
+        }
+        id = symbols_[it->second].id;
+        return true;
+    }
+
+    const Symbol* Get(const std::string& name) const
+    {
+        const auto it = index_.find(name);
+        return (it == index_.end()) ? nullptr : &symbols_[it->second];
+    }
+
+    const std::vector<Symbol>& All() const { return symbols_; }
+
+private:
+    const char* kind_;
+    uint32_t maxId_;
+    uint32_t nextId_ = 0U;
+    std::vector<Symbol> symbols_;
+    std::map<std::string, std::size_t> index_;
+};
+
+// ============================================================================
+// Manifest model
+// ============================================================================
+
+struct Action {
+    config::ActionType type;
+    std::string target;
+    bool hasTarget;
+    std::string param;
+    bool hasParam;
+    uint32_t sleepMs;
+    uint32_t timeoutMs;
+    uint32_t dependsOn;
+};
+
+struct ActionList {
+    std::string state;
+    uint32_t stateId;
+    std::vector<Action> actions;
+    uint32_t timeoutMs;
+};
+
+struct Manifest {
+    std::string name;
+    SymbolSpace states{"state", 254U};
+    SymbolSpace triggers{"trigger", 0xFFFFFFFEU};
+    SymbolSpace errors{"execution error", 0xFFFFFFFEU};
+    SymbolSpace conditions{"condition", 31U};
+    std::vector<config::StateHierarchyRule> hierarchy;
+    std::vector<config::TransitionRule> transitions;
+    std::vector<config::ErrorRecoveryRule> recovery;
+    std::vector<ActionList> actionLists;
+};
+
+bool IsIdentifier(const std::string& name)
+{
+    if (name.empty() || !(std::isalpha(static_cast<unsigned char>(name[0])) != 0)) {
+        return false;
+    }
+    for (const char c : name) {
+        if (std::isalnum(static_cast<unsigned char>(c)) == 0 && c != '_') {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string Text(const JsonValue& object, const char* member)
+{
+    const JsonValue* value = object.Find(member);
+    return (value != nullptr && value->kind == JsonValue::Kind::kString) ? value->text : "";
+}
+
+const std::vector<JsonValue>& Items(const JsonValue& root, const char* member)
+{
+    static const std::vector<JsonValue> kEmpty;
+    const JsonValue* value = root.Find(member);
+    return (value != nullptr && value->kind == JsonValue::Kind::kArray) ? value->items : kEmpty;
+}
+
+void ReadSymbols(const JsonValue& root, const char* member, SymbolSpace& space,
+                 std::vector<std::string>& errors)
+{
+    for (const auto& item : Items(root, member)) {
+        const std::string name = (item.kind == JsonValue::Kind::kString) ? item.text : Text(item, "name");
+        if (!IsIdentifier(name)) {
+            errors.push_back(std::string(member) + ": invalid name '" + name + "'");
+            continue;
+        }
+        const JsonValue* composite = item.Find("composite");
+        space.Add(name, item.Find("id"), composite != nullptr && composite->boolean, errors);
+    }
+}
+
+config::ConditionMask ReadMask(const JsonValue* list, const Manifest& manifest,
+                               std::vector<std::string>& errors, const std::string& where)
+{
+    config::ConditionMask mask = 0U;
+    if (list == nullptr) {
+        return mask;
+    }
+    for (const auto& item : list->items) {
+        uint32_t bit = 0U;
+        if (manifest.conditions.Resolve(item.text, bit, errors, where)) {
+            mask |= 1U << bit;
+        }
+    }
+    return mask;
+}
+
+bool ReadActionType(const std::string& text, config::ActionType& type)
+{
+    static const std::map<std::string, config::ActionType> kTypes = {
+        {"SetFunctionGroupState", config::ActionType::kSetFunctionGroupState},
+        {"StartStateMachine", config::ActionType::kStartStateMachine},
+        {"StopStateMachine", config::ActionType::kStopStateMachine},
+        {"Sync", config::ActionType::kSync},
+        {"Sleep", config::ActionType::kSleep},
+        {"SetNetworkHandle", config::ActionType::kSetNetworkHandle},
+    };
+    const auto it = kTypes.find(text);
+    if (it == kTypes.end()) {
+        return false;
+    }
+    type = it->second;
+    return true;
+}
+
+// ============================================================================
+// Read + validate
+// ============================================================================
+
+void ReadManifest(const JsonValue& root, Manifest& manifest, std::vector<std::string>& errors)
+{
+    manifest.name = Text(root, "name");
+    if (!IsIdentifier(manifest.name)) {
+        errors.push_back("manifest 'name' must be an identifier");
+    }
+
+    ReadSymbols(root, "states", manifest.states, errors);
+    ReadSymbols(root, "triggers", manifest.triggers, errors);
+    ReadSymbols(root, "errors", manifest.errors, errors);
+    ReadSymbols(root, "conditions", manifest.conditions, errors);
+
+    if (manifest.states.Get("Initial") == nullptr) {
+        errors.push_back("states: mandatory state 'Initial' missing");
+    }
+
+    // Hierarchy
+    std::map<uint32_t, uint32_t> parents;
+    for (const auto& item : Items(root, "hierarchy")) {
+        const std::string where = "hierarchy '" + Text(item, "state") + "'";
+        uint32_t child = 0U;
+        uint32_t parent = 0U;
+        if (!manifest.states.Resolve(Text(item, "state"), child, errors, where) ||
+            !manifest.states.Resolve(Text(item, "parent"), parent, errors, where)) {
+            continue;
+        }
+        if (!manifest.states.Get(Text(item, "parent"))->composite) {
+            errors.push_back(where + ": parent '" + Text(item, "parent") + "' is not composite");
+        }
+        if (!parents.emplace(child, parent).second) {
+            errors.push_back(where + ": state has more than one parent");
+            continue;
+        }
+        manifest.hierarchy.push_back({child, parent});
+    }
+    for (const auto& link : parents) {
+        uint32_t level = link.first;
+        for (std::size_t depth = 0; parents.count(level) != 0U; depth++) {
+            level = parents[level];
+            if (level == link.first || depth > CompiledRuleTable::kMaxHierarchyDepth) {
+                errors.push_back("hierarchy: cycle or too deep at state id " +
+                                 std::to_string(link.first));
+                break;
+            }
+        }
+    }
+
+    // Transitions
+    std::map<std::pair<uint32_t, uint32_t>, std::size_t> unguarded;
+    for (const auto& item : Items(root, "transitions")) {
+        const std::string where = "transition " + Text(item, "from") + " --" +
+                                  Text(item, "trigger") + "--> " + Text(item, "to");
+        config::TransitionRule rule{0U, 0U, 0U, {0U, 0U}};
+        bool ok = manifest.states.Resolve(Text(item, "from"), rule.fromState, errors, where);
+        ok = manifest.triggers.Resolve(Text(item, "trigger"), rule.trigger, errors, where) && ok;
+        ok = manifest.states.Resolve(Text(item, "to"), rule.toState, errors, where) && ok;
+        if (!ok) {
+            continue;
+        }
+        if (manifest.states.Get(Text(item, "to"))->composite) {
+            errors.push_back(where + ": composite state cannot be a target");
+        }
+        if (const JsonValue* guard = item.Find("guard")) {
+            rule.guard.allOf = ReadMask(guard->Find("allOf"), manifest, errors, where);
+            rule.guard.noneOf = ReadMask(guard->Find("noneOf"), manifest, errors, where);
+        }
+
+        const auto key = std::make_pair(rule.fromState, rule.trigger);
+        if (unguarded.count(key) != 0U) {
+            errors.push_back(where + ": unreachable, shadowed by an earlier unguarded rule");
+        }
+        if (rule.guard.allOf == 0U && rule.guard.noneOf == 0U) {
+            unguarded.emplace(key, manifest.transitions.size());
+        }
+        manifest.transitions.push_back(rule);
+    }
+
+    // Error recovery
+    std::map<std::pair<uint32_t, uint32_t>, bool> recoveryKeys;
+    for (const auto& item : Items(root, "errorRecovery")) {
+        const std::string where = "errorRecovery " + Text(item, "from") + " --" +
+                                  Text(item, "error") + "--> " + Text(item, "to");
+        config::ErrorRecoveryRule rule{0U, 0U, 0U};
+        bool ok = manifest.states.Resolve(Text(item, "from"), rule.fromState, errors, where);
+        if (Text(item, "error") == "ANY") {
+            rule.errorCode = config::kExecutionErrorAny;
+        } else {
+            ok = manifest.errors.Resolve(Text(item, "error"), rule.errorCode, errors, where) && ok;
+        }
+        ok = manifest.states.Resolve(Text(item, "to"), rule.toState, errors, where) && ok;
+        if (!ok) {
+            continue;
+        }
+        if (!recoveryKeys.emplace(std::make_pair(rule.fromState, rule.errorCode), true).second) {
+            errors.push_back(where + ": unreachable, duplicate of an earlier rule");
+        }
+        manifest.recovery.push_back(rule);
+    }
+
+    // Action lists
+    const JsonValue* actions = root.Find("actions");
+    if (actions != nullptr) {
+        for (const auto& member : actions->members) {
+            ActionList list;
+            list.state = member.first;
+            list.timeoutMs = 0U;
+            const std::string where = "actions '" + member.first + "'";
+            if (!manifest.states.Resolve(member.first, list.stateId, errors, where)) {
+                continue;
+            }
+            if (manifest.states.Get(member.first)->composite) {
+                errors.push_back(where + ": composite state has no action list");
+            }
+            for (const auto& item : member.second.items) {
+                Action action{config::ActionType::kSync, "", false, "", false, 0U, 0U, 0U};
+                if (!ReadActionType(Text(item, "type"), action.type)) {
+                    errors.push_back(where + ": unknown action type '" + Text(item, "type") + "'");
+                    continue;
+                }
+                const JsonValue* target = item.Find("target");
+                const JsonValue* param = item.Find("param");
+                const JsonValue* sleep = item.Find("sleepMs");
+                const JsonValue* timeout = item.Find("timeoutMs");
+                action.hasTarget = (target != nullptr && !target->IsNull());
+                action.target = action.hasTarget ? target->text : "";
+                action.hasParam = (param != nullptr && !param->IsNull());
+                action.param = action.hasParam ? param->text : "";
+                action.sleepMs = (sleep != nullptr) ? static_cast<uint32_t>(sleep->number) : 0U;
+                action.timeoutMs = (timeout != nullptr) ? static_cast<uint32_t>(timeout->number) : 0U;
+
+                const bool needsTarget = action.type != config::ActionType::kSync &&
+                                         action.type != config::ActionType::kSleep;
+                const bool needsParam = action.type == config::ActionType::kSetFunctionGroupState ||
+                                        action.type == config::ActionType::kSetNetworkHandle;
+                if (needsTarget && action.target.empty()) {
+                    errors.push_back(where + ": " + Text(item, "type") + " needs a target");
+                }
+                if (needsParam && action.param.empty()) {
+                    errors.push_back(where + ": " + Text(item, "type") + " needs a param");
+                }
+                if (action.type == config::ActionType::kSleep && action.sleepMs == 0U) {
+                    errors.push_back(where + ": Sleep needs sleepMs > 0");
+                }
+                if (action.type != config::ActionType::kSync && action.timeoutMs != 0U) {
+                    errors.push_back(where + ": timeoutMs is only allowed on Sync");
+                }
+
+                // "dependsOn": [<index of an earlier item>, ...]
+                const JsonValue* dependsOn = item.Find("dependsOn");
+                const std::size_t index = list.actions.size();
+                if (dependsOn != nullptr) {
+                    for (const auto& dependency : dependsOn->items) {
+                        const auto d = static_cast<std::size_t>(dependency.number);
+                        if (d >= index || d >= 32U) {
+                            errors.push_back(where + ": item " + std::to_string(index) +
+                                             " depends on item " + std::to_string(d) +
+                                             " (must be earlier and below 32)");
+                            continue;
+                        }
+                        action.dependsOn |= config::DependsOn(static_cast<uint32_t>(d));
+                    }
+                }
+                list.actions.push_back(action);
+            }
+
+            const bool hasDependencies = std::any_of(list.actions.begin(), list.actions.end(),
+                [](const Action& a) { return a.dependsOn != 0U; });
+            const bool hasSync = std::any_of(list.actions.begin(), list.actions.end(),
+                [](const Action& a) { return a.type == config::ActionType::kSync; });
+            if (hasDependencies && hasSync) {
+                errors.push_back(where + ": Sync is not allowed in a list with dependsOn");
+            }
+            manifest.actionLists.push_back(list);
+        }
+    }
+
+    // Action list deadlines: "listTimeoutsMs": { "<state>": ms }
+    const JsonValue* listTimeouts = root.Find("listTimeoutsMs");
+    if (listTimeouts != nullptr) {
+        for (const auto& member : listTimeouts->members) {
+            auto list = std::find_if(manifest.actionLists.begin(), manifest.actionLists.end(),
+                                     [&member](const ActionList& l) { return l.state == member.first; });
+            if (list == manifest.actionLists.end()) {
+                errors.push_back("listTimeoutsMs '" + member.first + "': state has no action list");
+                continue;
+            }
+            list->timeoutMs = static_cast<uint32_t>(member.second.number);
+        }
+    }
+}
+
+// ============================================================================
+// Emit
+// ============================================================================
+
+std::string Quote(const std::string& text, bool present)
+{
+    if (!present) {
+        return "nullptr";
+    }
+    std::string out = "\"";
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+        }
+        out.push_back(c);
+    }
+    return out + "\"";
+}
+
+const char* ActionTypeName(config::ActionType type)
+{
+    switch (type) {
+        case config::ActionType::kSetFunctionGroupState: return "kSetFunctionGroupState";
+        case config::ActionType::kStartStateMachine: return "kStartStateMachine";
+        case config::ActionType::kStopStateMachine: return "kStopStateMachine";
+        case config::ActionType::kSync: return "kSync";
+        case config::ActionType::kSleep: return "kSleep";
+        default: return "kSetNetworkHandle";
+    }
+}
+
+void EmitSymbols(std::ostream& out, const char* space, const SymbolSpace& symbols, const char* type)
+{
+    out << "namespace " << space << " {\n";
+    for (const auto& symbol : symbols.All()) {
+        out << "    constexpr " << type << " k" << symbol.name << " = " << symbol.id << "U;\n";
+    }
+    out << "} // namespace " << space << "\n\n";
+}
+
+bool Emit(std::ostream& out, const Manifest& m)
+{
+    const auto& states = m.states.All();
+
+    out << "// Generated by sm_config_compiler - do not edit\n\n"
+        << "#ifndef ARA_SM_GENERATED_" << m.name << "_H\n"
+        << "#define ARA_SM_GENERATED_" << m.name << "_H\n\n"
+        << "#include <cstdint>\n#include <cstddef>\n"
+        << "#include \"static_config.h\"\n#include \"perfect_hash.h\"\n\n"
+        << "namespace ara {\nnamespace sm {\nnamespace generated {\nnamespace " << m.name << " {\n\n";
+
+    EmitSymbols(out, "States", m.states, "uint32_t");
+    EmitSymbols(out, "Triggers", m.triggers, "TransitionRequestType");
+    EmitSymbols(out, "ExecutionErrors", m.errors, "ExecutionErrorType");
+
+    out << "namespace Conditions {\n";
+    for (const auto& symbol : m.conditions.All()) {
+        out << "    constexpr config::ConditionMask k" << symbol.name << " = 1U << " << symbol.id << ";\n";
+    }
+    out << "} // namespace Conditions\n\n";
+
+    // Dense state index
+    out << "constexpr std::size_t kStateCount = " << states.size() << "U;\n\n"
+        << "constexpr uint32_t kStateIds[] = {";
+    for (std::size_t i = 0; i < states.size(); i++) {
+        out << (i % 8U == 0U ? "\n    " : " ") << states[i].id << "U,";
+    }
+    out << "\n};\n\nconstexpr const char* kStateNames[] = {";
+    for (std::size_t i = 0; i < states.size(); i++) {
+        out << "\n    \"" << states[i].name << "\",";
+    }
+    out << "\n};\n\n";
+
+    uint8_t stateIndex[256];
+    std::fill(stateIndex, stateIndex + 256, 0xFFU);
+    for (std::size_t i = 0; i < states.size(); i++) {
+        stateIndex[states[i].id] = static_cast<uint8_t>(i);
+    }
+    out << "/// state id -> dense index (0xFF = not a state)\nconstexpr uint8_t kStateIndex[256] = {";
+    for (std::size_t i = 0; i < 256U; i++) {
+        out << (i % 16U == 0U ? "\n    " : " ") << static_cast<int>(stateIndex[i]) << ",";
+    }
+    out << "\n};\n\n";
+
+    // Rule tables
+    out << "constexpr config::StateHierarchyRule kStateHierarchy[] = {\n";
+    for (const auto& rule : m.hierarchy) {
+        out << "    {" << rule.state << "U, " << rule.parentState << "U},\n";
+    }
+    if (m.hierarchy.empty()) {
+        out << "    {0U, 0U},\n";
+    }
+    out << "};\nconstexpr std::size_t kStateHierarchyCount = " << m.hierarchy.size() << "U;\n\n";
+
+    out << "constexpr config::TransitionRule kTransitions[] = {\n";
+    for (const auto& rule : m.transitions) {
+        out << "    {" << rule.fromState << "U, " << rule.trigger << "U, " << rule.toState
+            << "U, {0x" << std::hex << rule.guard.allOf << "U, 0x" << rule.guard.noneOf
+            << std::dec << "U}},\n";
+    }
+    if (m.transitions.empty()) {
+        out << "    {0U, 0U, 0U, {0U, 0U}},\n";
+    }
+    out << "};\nconstexpr std::size_t kTransitionsCount = " << m.transitions.size() << "U;\n\n";
+
+    out << "constexpr config::ErrorRecoveryRule kErrorRecovery[] = {\n";
+    for (const auto& rule : m.recovery) {
+        out << "    {" << rule.fromState << "U, 0x" << std::hex << rule.errorCode << std::dec
+            << "U, " << rule.toState << "U},\n";
+    }
+    if (m.recovery.empty()) {
+        out << "    {0U, 0U, 0U},\n";
+    }
+    out << "};\nconstexpr std::size_t kErrorRecoveryCount = " << m.recovery.size() << "U;\n\n";
+
+    // Actions: one pool, lists are slices of it
+    std::size_t total = 0U;
+    out << "constexpr config::ActionItem kActions[] = {\n";
+    for (const auto& list : m.actionLists) {
+        out << "    // " << list.state << "\n";
+        for (const auto& action : list.actions) {
+            out << "    {config::ActionType::" << ActionTypeName(action.type) << ", "
+                << Quote(action.target, action.hasTarget) << ", "
+                << Quote(action.param, action.hasParam) << ", " << action.sleepMs << "U, "
+                << action.timeoutMs << "U, 0x" << std::hex << action.dependsOn << std::dec << "U},\n";
+            total++;
+        }
+    }
+    if (total == 0U) {
+        out << "    {config::ActionType::kSync, nullptr, nullptr, 0U, 0U, 0x0U},\n";
+    }
+    out << "};\n\nconstexpr config::ActionListEntry kActionTable[] = {\n";
+    std::size_t offset = 0U;
+    uint8_t actionListIndex[256];
+    std::fill(actionListIndex, actionListIndex + 256, 0xFFU);
+    for (std::size_t i = 0; i < m.actionLists.size(); i++) {
+        const auto& list = m.actionLists[i];
+        out << "    {States::k" << list.state << ", kActions + " << offset << ", "
+            << list.actions.size() << "U, " << list.timeoutMs << "U},\n";
+        offset += list.actions.size();
+        actionListIndex[stateIndex[list.stateId]] = static_cast<uint8_t>(i);
+    }
+    if (m.actionLists.empty()) {
+        out << "    {0U, nullptr, 0U, 0U},\n";
+    }
+    out << "};\nconstexpr std::size_t kActionTableCount = " << m.actionLists.size() << "U;\n\n";
+
+    out << "/// dense state index -> kActionTable index (0xFF = none)\n"
+        << "constexpr uint8_t kActionListIndex[] = {";
+    for (std::size_t i = 0; i < states.size(); i++) {
+        out << (i % 16U == 0U ? "\n    " : " ") << static_cast<int>(actionListIndex[i]) << ",";
+    }
+    out << "\n};\n\n";
+
+    // Table set type for StaticStateMachine<Tables>
+    out << "/// Table set for StaticStateMachine<Tables>\n"
+        << "struct Tables {\n"
+        << "    static constexpr const config::TransitionRule* kTransitions = "
+        << m.name << "::kTransitions;\n"
+        << "    static constexpr std::size_t kTransitionsCount = " << m.name << "::kTransitionsCount;\n"
+        << "    static constexpr const config::ErrorRecoveryRule* kErrorRecovery = "
+        << m.name << "::kErrorRecovery;\n"
+        << "    static constexpr std::size_t kErrorRecoveryCount = " << m.name << "::kErrorRecoveryCount;\n"
+        << "    static constexpr const config::StateHierarchyRule* kStateHierarchy = "
+        << m.name << "::kStateHierarchy;\n"
+        << "    static constexpr std::size_t kStateHierarchyCount = " << m.name << "::kStateHierarchyCount;\n"
+        << "    static constexpr const config::ActionListEntry* kActionTable = "
+        << m.name << "::kActionTable;\n"
+        << "    static constexpr std::size_t kActionTableCount = " << m.name << "::kActionTableCount;\n"
+        << "};\n\n";
+
+    // Prebuilt dispatch
+    const PerfectHashData transitions = PerfectHashData::FromRuleTable(
+        CompiledRuleTable::FromTransitions(m.transitions.data(), m.transitions.size(),
+                                           m.hierarchy.data(), m.hierarchy.size()));
+    const PerfectHashData recovery = PerfectHashData::FromRuleTable(
+        CompiledRuleTable::FromErrorRecovery(m.recovery.data(), m.recovery.size(),
+                                             m.hierarchy.data(), m.hierarchy.size()));
+    if (!transitions.IsValid() || !recovery.IsValid()) {
+        std::cerr << "[sm_config_compiler] Failed to build dispatch tables" << std::endl;
+        return false;
+    }
+    transitions.Emit(out, "kTransitionHash");
+    recovery.Emit(out, "kRecoveryHash");
+
+    out << "} // namespace " << m.name << "\n} // namespace generated\n"
+        << "} // namespace sm\n} // namespace ara\n\n"
+        << "#endif // ARA_SM_GENERATED_" << m.name << "_H\n";
+
+    return true;
+}
+
+bool WriteImage(const std::string& path, const Manifest& m)
+{
+    // ActionListEntry needs contiguous ActionItem arrays; strings stay in the manifest
+    std::vector<std::vector<config::ActionItem>> items;
+    for (const auto& list : m.actionLists) {
+        std::vector<config::ActionItem> converted;
+        for (const auto& action : list.actions) {
+            converted.push_back({action.type,
+                                 action.hasTarget ? action.target.c_str() : nullptr,
+                                 action.hasParam ? action.param.c_str() : nullptr,
+                                 action.sleepMs, action.timeoutMs, action.dependsOn});
+        }
+        items.push_back(std::move(converted));
+    }
+
+    std::vector<config::ActionListEntry> table;
+    for (std::size_t i = 0; i < m.actionLists.size(); i++) {
+        table.push_back({m.actionLists[i].stateId, items[i].data(), items[i].size(),
+                         m.actionLists[i].timeoutMs});
+    }
+
+    const std::vector<uint8_t> image = BinaryConfigImage::Build(
+        m.name,
+        m.transitions.data(), m.transitions.size(),
+        m.recovery.data(), m.recovery.size(),
+        m.hierarchy.data(), m.hierarchy.size(),
+        table.data(), table.size());
+
+    return BinaryConfigImage::WriteFile(path, image).HasValue();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3 && argc != 4) {
+        std::cerr << "usage: sm_config_compiler <manifest.json> <output header> [<output image>]"
+                  << std::endl;
+        return 1;
+    }
+
+    std::ifstream in(argv[1]);
+    if (!in) {
+        std::cerr << "[sm_config_compiler] Cannot open " << argv[1] << std::endl;
+        return 1;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string text = buffer.str();
+
+    Manifest manifest;
+    std::vector<std::string> errors;
+    try {
+        ReadManifest(JsonReader(text).Parse(), manifest, errors);
+    } catch (const std::exception& e) {
+        errors.push_back(e.what());
+    }
+
+    if (!errors.empty()) {
+        for (const auto& error : errors) {
+            std::cerr << argv[1] << ": error: " << error << std::endl;
+        }
+        return 1;
+    }
+
+    // Write to a string first so a failure leaves no partial header behind
+    std::ostringstream header;
+    if (!Emit(header, manifest)) {
+        return 1;
+    }
+
+    std::ofstream out(argv[2]);
+    if (!out) {
+        std::cerr << "[sm_config_compiler] Cannot open " << argv[2] << std::endl;
+        return 1;
+    }
+    out << header.str();
+
+    if (argc == 4 && !WriteImage(argv[3], manifest)) {
+        return 1;
+    }
+
+    std::cout << "[sm_config_compiler] " << manifest.name << ": "
+              << manifest.states.All().size() << " states, "
+              << manifest.transitions.size() << " transitions, "
+              << manifest.recovery.size() << " recovery rules, "
+              << manifest.actionLists.size() << " action lists" << std::endl;
+    return 0;
+}
@@ -0,0 +1,204 @@
+#ifndef ARA_SM_TOOLS_JSON_READER_H
+#define ARA_SM_TOOLS_JSON_READER_H
+
+/**
+ * @file json_reader.h
+ * @brief Minimal JSON reader for build-time tools
+ *
+ * Just enough JSON for configuration manifests: objects (member order
+ * kept), arrays, strings (basic escapes), unsigned integers, booleans
+ * and null. Errors throw std::runtime_error with line information.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ara {
+namespace sm {
+namespace tools {
+
+class JsonValue {
+public:
+    enum class Kind : uint8_t { kNull, kBool, kNumber, kString, kArray, kObject };
+
+    Kind kind = Kind::kNull;
+    bool boolean = false;
+    uint64_t number = 0U;
+    std::string text;
+    std::vector<JsonValue> items;                           ///< kArray
+    std::vector<std::pair<std::string, JsonValue>> members; ///< kObject
+
+    /// Member lookup (nullptr if absent or not an object)
+    const JsonValue* Find(const std::string& name) const
+    {
+        for (const auto& member : members) {
+            if (member.first == name) {
+                return &member.second;
+            }
+        }
+        return nullptr;
+    }
+
+    bool IsNull() const { return kind == Kind::kNull; }
+};
+
+class JsonReader {
+public:
+    explicit JsonReader(const std::string& input) : input_(input) {}
+
+    JsonValue Parse()
+    {
+        JsonValue value = ParseValue();
+        SkipSpace();
+        if (pos_ != input_.size()) {
+            Fail("trailing characters");
+        }
+        return value;
+    }
+
+private:
+    [[noreturn]] void Fail(const std::string& what) const
+    {
+        std::size_t line = 1U;
+        for (std::size_t i = 0; i < pos_ && i < input_.size(); i++) {
+            if (input_[i] == '\n') {
+                line++;
+            }
+        }
+        throw std::runtime_error("JSON line " + std::to_string(line) + ": " + what);
+    }
+
+    void SkipSpace()
+    {
+        while (pos_ < input_.size()) {
+            const char c = input_[pos_];
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+                pos_++;
+            } else {
+                break;
+            }
+        }
+    }
+
+    void Expect(char c)
+    {
+        SkipSpace();
+        if (pos_ >= input_.size() || input_[pos_] != c) {
+            Fail(std::string("expected '") + c + "'");
+        }
+        pos_++;
+    }
+
+    bool Consume(char c)
+    {
+        SkipSpace();
+        if (pos_ < input_.size() && input_[pos_] == c) {
+            pos_++;
+            return true;
+        }
+        return false;
+    }
+
+    bool ConsumeWord(const char* word)
+    {
+        const std::string w(word);
+        if (input_.compare(pos_, w.size(), w) == 0) {
+            pos_ += w.size();
+            return true;
+        }
+        return false;
+    }
+
+    std::string ParseString()
+    {
+        Expect('"');
+        std::string out;
+        while (pos_ < input_.size() && input_[pos_] != '"') {
+            char c = input_[pos_++];
+            if (c == '\\') {
+                if (pos_ >= input_.size()) {
+                    Fail("unterminated escape");
+                }
+                c = input_[pos_++];
+                switch (c) {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case '"': case '\\': case '/': break;
+                    default: Fail("unsupported escape");
+                }
+            }
+            out.push_back(c);
+        }
+        if (pos_ >= input_.size()) {
+            Fail("unterminated string");
+        }
+        pos_++;
+        return out;
+    }
+
+    JsonValue ParseValue()
+    {
+        SkipSpace();
+        if (pos_ >= input_.size()) {
+            Fail("unexpected end of input");
+        }
+
+        JsonValue value;
+        const char c = input_[pos_];
+
+        if (c == '{') {
+            value.kind = JsonValue::Kind::kObject;
+            pos_++;
+            if (!Consume('}')) {
+                do {
+                    SkipSpace();
+                    std::string name = ParseString();
+                    Expect(':');
+                    value.members.emplace_back(std::move(name), ParseValue());
+                } while (Consume(','));
+                Expect('}');
+            }
+        } else if (c == '[') {
+            value.kind = JsonValue::Kind::kArray;
+            pos_++;
+            if (!Consume(']')) {
+                do {
+                    value.items.push_back(ParseValue());
+                } while (Consume(','));
+                Expect(']');
+            }
+        } else if (c == '"') {
+            value.kind = JsonValue::Kind::kString;
+            value.text = ParseString();
+        } else if (c >= '0' && c <= '9') {
+            value.kind = JsonValue::Kind::kNumber;
+            const char* begin = input_.c_str() + pos_;
+            char* end = nullptr;
+            value.number = std::strtoull(begin, &end, 0);   // decimal or 0x...
+            pos_ += static_cast<std::size_t>(end - begin);
+        } else if (ConsumeWord("true")) {
+            value.kind = JsonValue::Kind::kBool;
+            value.boolean = true;
+        } else if (ConsumeWord("false")) {
+            value.kind = JsonValue::Kind::kBool;
+        } else if (!ConsumeWord("null")) {
+            Fail("unexpected character");
+        }
+
+        return value;
+    }
+
+    const std::string& input_;
+    std::size_t pos_ = 0U;
+};
+
+} // namespace tools
+} // namespace sm
+} // namespace ara
+
+#endif // ARA_SM_TOOLS_JSON_READER_H
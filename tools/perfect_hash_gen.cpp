@@ -0,0 +1,79 @@
+/**
+ * @file perfect_hash_gen.cpp
+ * @brief Build-time generator of perfect hash dispatch tables
+ *
+ * Compiles the transition and error recovery tables of static_config
+ * (hierarchy resolved), builds a minimal perfect hash per table and
+ * writes them as constexpr arrays:
+ *
+ *   perfect_hash_gen <output header>
+ *
+ * Invoked by CMake; the generated header is part of ara_sm.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "compiled_rule_table.h"
+#include "perfect_hash.h"
+#include "static_config.h"
+
+using namespace ara::sm;
+
+namespace {
+
+bool WriteTable(std::ostream& out, const std::string& name, const CompiledRuleTable& table)
+{
+    const PerfectHashData data = PerfectHashData::FromRuleTable(table);
+    if (!data.IsValid()) {
+        std::cerr << "[perfect_hash_gen] Failed to build " << name << std::endl;
+        return false;
+    }
+
+    data.Emit(out, name);
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        std::cerr << "usage: perfect_hash_gen <output header>" << std::endl;
+        return 1;
+    }
+
+    std::ofstream out(argv[1]);
+    if (!out) {
+        std::cerr << "[perfect_hash_gen] Cannot open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    out << "// Generated by perfect_hash_gen from static_config - do not edit\n\n"
+        << "#ifndef ARA_SM_PERFECT_HASH_TABLES_H\n"
+        << "#define ARA_SM_PERFECT_HASH_TABLES_H\n\n"
+        << "#include <cstdint>\n"
+        << "#include \"perfect_hash.h\"\n\n"
+        << "namespace ara {\nnamespace sm {\nnamespace generated {\n\n";
+
+    bool ok = true;
+    ok = WriteTable(out, "kControllerTransitionHash", CompiledRuleTable::FromTransitions(
+        config::kControllerTransitions, config::kControllerTransitionsCount,
+        config::kControllerStateHierarchy, config::kControllerStateHierarchyCount)) && ok;
+    ok = WriteTable(out, "kAgentTransitionHash", CompiledRuleTable::FromTransitions(
+        config::kInfotainmentTransitions, config::kInfotainmentTransitionsCount,
+        config::kInfotainmentStateHierarchy, config::kInfotainmentStateHierarchyCount)) && ok;
+    ok = WriteTable(out, "kControllerRecoveryHash", CompiledRuleTable::FromErrorRecovery(
+        config::kControllerErrorRecovery, config::kControllerErrorRecoveryCount,
+        config::kControllerStateHierarchy, config::kControllerStateHierarchyCount)) && ok;
+    ok = WriteTable(out, "kAgentRecoveryHash", CompiledRuleTable::FromErrorRecovery(
+        config::kInfotainmentErrorRecovery, config::kInfotainmentErrorRecoveryCount,
+        config::kInfotainmentStateHierarchy, config::kInfotainmentStateHierarchyCount)) && ok;
+
+    out << "} // namespace generated\n} // namespace sm\n} // namespace ara\n\n"
+        << "#endif // ARA_SM_PERFECT_HASH_TABLES_H\n";
+
+    return ok ? 0 : 1;
+}